@@ -20,9 +20,17 @@ static RTC_SLOW_ATTR ulp_var_t ulp_read_cmd[HULP_I2C_CMD_BUF_SIZE(6)] = {
         HULP_I2C_CMD_HDR_NO_PTR(SLAVE_ADDR, 6),
 };
 static RTC_DATA_ATTR ulp_var_t last_temp;
+static RTC_DATA_ATTR ulp_var_t ulp_sleep_ctx[HULP_SLEEP_CONT_WORDS];
+
+static const uint32_t ULP_WAKE_PERIODS_US[] = {
+        10 * 1000 * 1000,       // 0: between measurements
+        13 * 1000,              // 1: for the measurement to complete
+};
 
 void init_ulp() {
     enum {
+        LABEL_ENTRY,
+        LABEL_MEASURED,
         LABEL_I2C_READ,
         LABEL_I2C_READ_RETURN,
         LABEL_I2C_WRITE,
@@ -33,6 +41,8 @@ void init_ulp() {
     };
 
     const ulp_insn_t program[] = {
+            M_LABEL(LABEL_ENTRY),
+
             // write i2c to request measurement
             I_MOVO(R1, ulp_write_cmd),
             M_MOVL(R3, LABEL_I2C_WRITE_RETURN),
@@ -40,8 +50,8 @@ void init_ulp() {
             M_LABEL(LABEL_I2C_WRITE_RETURN),
             M_BGE(LABEL_I2C_ERROR, 1),
 
-            // delay 13ms to get result
-            M_DELAY_US_5000_20000(13000),
+            // sleep 13ms to get result
+            M_SLEEP_CONT(LABEL_MEASURED, LABEL_ENTRY, ulp_sleep_ctx, 1, 0),
 
             // read i2c
             I_MOVO(R1, ulp_read_cmd),
@@ -91,7 +101,8 @@ void init_ulp() {
 
     vTaskDelay(1000 / portTICK_PERIOD_MS);
 
-    ESP_ERROR_CHECK(hulp_ulp_load(program, sizeof(program), 10ULL * 1000 * 1000, 0));
+    ESP_ERROR_CHECK(hulp_ulp_load(program, sizeof(program), ULP_WAKE_PERIODS_US[0], 0));
+    ESP_ERROR_CHECK(hulp_set_wake_periods(ULP_WAKE_PERIODS_US, sizeof(ULP_WAKE_PERIODS_US) / sizeof(ULP_WAKE_PERIODS_US[0])));
     ESP_ERROR_CHECK(hulp_ulp_run(0));
 }
 
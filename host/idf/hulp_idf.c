@@ -0,0 +1,734 @@
+#include "hulp_idf.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp32/clk.h"
+#include "esp32/rom/ets_sys.h"
+#include "esp32/ulp.h"
+#include "driver/gpio.h"
+#include "driver/rtc_cntl.h"
+#include "driver/rtc_io.h"
+#include "driver/touch_pad.h"
+#include "soc/rtc.h"
+#include "soc/rtc_cntl_reg.h"
+#include "soc/rtc_io_reg.h"
+#include "soc/sens_reg.h"
+#include "soc/touch_sensor_periph.h"
+
+#include "sdkconfig.h"
+
+static const char* TAG = "HULP-IDF";
+
+#define HULP_IDF_NUM_PERIPHS 4
+#define HULP_IDF_PERIPH_SIZE 0x400
+#define HULP_IDF_MAX_RTC_ISRS 8
+
+#define RTC_ULP_TRIG_EN BIT(9)
+
+// ULP reserved area, at the start of RTC slow memory (see hulp_rtc_slow.ld)
+__attribute__((section(".rtc.reserved"))) uint32_t hulp_host_rtc_slow_mem[CONFIG_ESP32_ULP_COPROC_RESERVE_MEM / sizeof(uint32_t)];
+
+static uint32_t s_regs[HULP_IDF_NUM_PERIPHS * HULP_IDF_PERIPH_SIZE / sizeof(uint32_t)];
+
+static struct {
+    uint32_t slow_hz;
+    uint32_t fast_hz;
+    bool clk_8m_en;
+    bool clk_8md256_en;
+    uint64_t time_us;
+    esp_sleep_wakeup_cause_t wakeup_cause;
+    esp_reset_reason_t reset_reason;
+    esp_sleep_pd_option_t pd_options[ESP_PD_DOMAIN_MAX];
+    struct {
+        intr_handler_t handler;
+        void* arg;
+        uint32_t mask;
+    } rtc_isrs[HULP_IDF_MAX_RTC_ISRS];
+} s_idf = {
+    .slow_hz = HULP_IDF_SLOW_CLK_HZ_DEFAULT,
+    .fast_hz = HULP_IDF_FAST_CLK_HZ_DEFAULT,
+    .reset_reason = ESP_RST_POWERON,
+};
+
+// GPIO to RTCIO, as per rtc_io_num_map
+static const int s_rtc_io_num_map[SOC_GPIO_PIN_COUNT] = {
+    RTCIO_GPIO0_CHANNEL, -1, RTCIO_GPIO2_CHANNEL, -1, RTCIO_GPIO4_CHANNEL, -1, -1, -1, -1, -1,
+    -1, -1, RTCIO_GPIO12_CHANNEL, RTCIO_GPIO13_CHANNEL, RTCIO_GPIO14_CHANNEL, RTCIO_GPIO15_CHANNEL, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, RTCIO_GPIO25_CHANNEL, RTCIO_GPIO26_CHANNEL, RTCIO_GPIO27_CHANNEL, -1, -1,
+    -1, -1, RTCIO_GPIO32_CHANNEL, RTCIO_GPIO33_CHANNEL, RTCIO_GPIO34_CHANNEL, RTCIO_GPIO35_CHANNEL, RTCIO_GPIO36_CHANNEL, RTCIO_GPIO37_CHANNEL, RTCIO_GPIO38_CHANNEL, RTCIO_GPIO39_CHANNEL,
+};
+
+#define RTC_IO_DESC_PAD(reg, pad, hold_force, rtcio) \
+    {reg, RTC_IO_##pad##_MUX_SEL_M, RTC_IO_##pad##_FUN_SEL_S, RTC_IO_##pad##_FUN_IE_M, RTC_IO_##pad##_RUE_M, RTC_IO_##pad##_RDE_M, \
+    RTC_IO_##pad##_SLP_SEL_M, RTC_IO_##pad##_SLP_IE_M, RTC_IO_##pad##_SLP_OE_M, RTC_IO_##pad##_HOLD_M, hold_force, RTC_IO_##pad##_DRV_V, RTC_IO_##pad##_DRV_S, rtcio}
+
+#define RTC_IO_DESC_TOUCH(n, rtcio) \
+    RTC_IO_DESC_PAD(RTC_IO_TOUCH_PAD##n##_REG, TOUCH_PAD##n, RTC_CNTL_TOUCH_PAD##n##_HOLD_FORCE_M, RTCIO_CHANNEL_##rtcio##_GPIO_NUM)
+
+const rtc_io_desc_t rtc_io_desc[SOC_RTCIO_PIN_COUNT] = {
+    {RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE1_MUX_SEL_M, RTC_IO_SENSE1_FUN_SEL_S, RTC_IO_SENSE1_FUN_IE_M, 0, 0,
+        RTC_IO_SENSE1_SLP_SEL_M, RTC_IO_SENSE1_SLP_IE_M, 0, RTC_IO_SENSE1_HOLD_M, RTC_CNTL_SENSE1_HOLD_FORCE_M, 0, 0, RTCIO_CHANNEL_0_GPIO_NUM},
+    {RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE2_MUX_SEL_M, RTC_IO_SENSE2_FUN_SEL_S, RTC_IO_SENSE2_FUN_IE_M, 0, 0,
+        RTC_IO_SENSE2_SLP_SEL_M, RTC_IO_SENSE2_SLP_IE_M, 0, RTC_IO_SENSE2_HOLD_M, RTC_CNTL_SENSE2_HOLD_FORCE_M, 0, 0, RTCIO_CHANNEL_1_GPIO_NUM},
+    {RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE3_MUX_SEL_M, RTC_IO_SENSE3_FUN_SEL_S, RTC_IO_SENSE3_FUN_IE_M, 0, 0,
+        RTC_IO_SENSE3_SLP_SEL_M, RTC_IO_SENSE3_SLP_IE_M, 0, RTC_IO_SENSE3_HOLD_M, RTC_CNTL_SENSE3_HOLD_FORCE_M, 0, 0, RTCIO_CHANNEL_2_GPIO_NUM},
+    {RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE4_MUX_SEL_M, RTC_IO_SENSE4_FUN_SEL_S, RTC_IO_SENSE4_FUN_IE_M, 0, 0,
+        RTC_IO_SENSE4_SLP_SEL_M, RTC_IO_SENSE4_SLP_IE_M, 0, RTC_IO_SENSE4_HOLD_M, RTC_CNTL_SENSE4_HOLD_FORCE_M, 0, 0, RTCIO_CHANNEL_3_GPIO_NUM},
+    {RTC_IO_ADC_PAD_REG, RTC_IO_ADC1_MUX_SEL_M, RTC_IO_ADC1_FUN_SEL_S, RTC_IO_ADC1_FUN_IE_M, 0, 0,
+        RTC_IO_ADC1_SLP_SEL_M, RTC_IO_ADC1_SLP_IE_M, 0, RTC_IO_ADC1_HOLD_M, RTC_CNTL_ADC1_HOLD_FORCE_M, 0, 0, RTCIO_CHANNEL_4_GPIO_NUM},
+    {RTC_IO_ADC_PAD_REG, RTC_IO_ADC2_MUX_SEL_M, RTC_IO_ADC2_FUN_SEL_S, RTC_IO_ADC2_FUN_IE_M, 0, 0,
+        RTC_IO_ADC2_SLP_SEL_M, RTC_IO_ADC2_SLP_IE_M, 0, RTC_IO_ADC2_HOLD_M, RTC_CNTL_ADC2_HOLD_FORCE_M, 0, 0, RTCIO_CHANNEL_5_GPIO_NUM},
+    RTC_IO_DESC_PAD(RTC_IO_PAD_DAC1_REG, PDAC1, RTC_CNTL_PDAC1_HOLD_FORCE_M, RTCIO_CHANNEL_6_GPIO_NUM),
+    RTC_IO_DESC_PAD(RTC_IO_PAD_DAC2_REG, PDAC2, RTC_CNTL_PDAC2_HOLD_FORCE_M, RTCIO_CHANNEL_7_GPIO_NUM),
+    RTC_IO_DESC_PAD(RTC_IO_XTAL_32K_PAD_REG, X32N, RTC_CNTL_X32N_HOLD_FORCE_M, RTCIO_CHANNEL_8_GPIO_NUM),
+    RTC_IO_DESC_PAD(RTC_IO_XTAL_32K_PAD_REG, X32P, RTC_CNTL_X32P_HOLD_FORCE_M, RTCIO_CHANNEL_9_GPIO_NUM),
+    RTC_IO_DESC_TOUCH(0, 10),
+    RTC_IO_DESC_TOUCH(1, 11),
+    RTC_IO_DESC_TOUCH(2, 12),
+    RTC_IO_DESC_TOUCH(3, 13),
+    RTC_IO_DESC_TOUCH(4, 14),
+    RTC_IO_DESC_TOUCH(5, 15),
+    RTC_IO_DESC_TOUCH(6, 16),
+    RTC_IO_DESC_TOUCH(7, 17),
+};
+
+const int touch_sensor_channel_io_map[SOC_TOUCH_SENSOR_NUM] = {
+    TOUCH_PAD_NUM0_GPIO_NUM,
+    TOUCH_PAD_NUM1_GPIO_NUM,
+    TOUCH_PAD_NUM2_GPIO_NUM,
+    TOUCH_PAD_NUM3_GPIO_NUM,
+    TOUCH_PAD_NUM4_GPIO_NUM,
+    TOUCH_PAD_NUM5_GPIO_NUM,
+    TOUCH_PAD_NUM6_GPIO_NUM,
+    TOUCH_PAD_NUM7_GPIO_NUM,
+    TOUCH_PAD_NUM8_GPIO_NUM,
+    TOUCH_PAD_NUM9_GPIO_NUM,
+};
+
+void hulp_idf_reset(void)
+{
+    memset(s_regs, 0, sizeof(s_regs));
+    memset(hulp_host_rtc_slow_mem, 0, sizeof(hulp_host_rtc_slow_mem));
+    memset(&s_idf, 0, sizeof(s_idf));
+    s_idf.slow_hz = HULP_IDF_SLOW_CLK_HZ_DEFAULT;
+    s_idf.fast_hz = HULP_IDF_FAST_CLK_HZ_DEFAULT;
+    s_idf.reset_reason = ESP_RST_POWERON;
+}
+
+void hulp_idf_set_clocks(uint32_t slow_hz, uint32_t fast_hz)
+{
+    s_idf.slow_hz = slow_hz;
+    s_idf.fast_hz = fast_hz;
+}
+
+void hulp_idf_set_wakeup_cause(esp_sleep_wakeup_cause_t cause)
+{
+    s_idf.wakeup_cause = cause;
+}
+
+void hulp_idf_set_reset_reason(esp_reset_reason_t reason)
+{
+    s_idf.reset_reason = reason;
+}
+
+void hulp_idf_advance_us(uint64_t us)
+{
+    s_idf.time_us += us;
+}
+
+int hulp_idf_raise_rtc_intr(uint32_t mask)
+{
+    REG_SET_BIT(RTC_CNTL_INT_RAW_REG, mask);
+    uint32_t status = REG_READ(RTC_CNTL_INT_RAW_REG) & REG_READ(RTC_CNTL_INT_ENA_REG);
+    REG_WRITE(RTC_CNTL_INT_ST_REG, status);
+    int called = 0;
+    for(int i = 0; i < HULP_IDF_MAX_RTC_ISRS; ++i)
+    {
+        if(s_idf.rtc_isrs[i].handler && (s_idf.rtc_isrs[i].mask & status))
+        {
+            s_idf.rtc_isrs[i].handler(s_idf.rtc_isrs[i].arg);
+            ++called;
+        }
+    }
+    // As by the RTC interrupt's dispatcher, after the handlers
+    REG_CLR_BIT(RTC_CNTL_INT_RAW_REG, status);
+    REG_CLR_BIT(RTC_CNTL_INT_ST_REG, status);
+    return called;
+}
+
+volatile uint32_t* hulp_host_reg(uint32_t addr)
+{
+    if(addr < DR_REG_RTCCNTL_BASE || addr >= DR_REG_RTCCNTL_BASE + sizeof(s_regs) || (addr % sizeof(uint32_t)))
+    {
+        ESP_LOGE(TAG, "[%s] 0x%08x is not an RTC peripheral register", __func__, (unsigned)addr);
+        abort();
+    }
+    return &s_regs[(addr - DR_REG_RTCCNTL_BASE) / sizeof(uint32_t)];
+}
+
+/* Clocks and time */
+
+static uint32_t hulp_idf_period_cal(uint32_t hz)
+{
+    return (uint32_t)((1000000ULL << RTC_CLK_CAL_FRACT) / hz);
+}
+
+uint32_t esp_clk_slowclk_cal_get(void)
+{
+    return hulp_idf_period_cal(s_idf.slow_hz);
+}
+
+uint32_t rtc_clk_cal(rtc_cal_sel_t cal_clk, uint32_t slow_clk_cycles)
+{
+    if(cal_clk == RTC_CAL_8MD256)
+    {
+        return s_idf.clk_8md256_en ? hulp_idf_period_cal(s_idf.fast_hz / 256) : 0;
+    }
+    return hulp_idf_period_cal(s_idf.slow_hz);
+}
+
+uint64_t rtc_time_us_to_slowclk(uint64_t time_in_us, uint32_t period)
+{
+    return (time_in_us << RTC_CLK_CAL_FRACT) / period;
+}
+
+uint64_t rtc_time_slowclk_to_us(uint64_t rtc_cycles, uint32_t period)
+{
+    return (rtc_cycles * period) >> RTC_CLK_CAL_FRACT;
+}
+
+uint64_t rtc_time_get(void)
+{
+    uint64_t ticks = s_idf.time_us * s_idf.slow_hz / 1000000;
+    // As latched by RTC_CNTL_TIME_UPDATE
+    REG_WRITE(RTC_CNTL_TIME0_REG, (uint32_t)ticks);
+    REG_WRITE(RTC_CNTL_TIME1_REG, (uint32_t)(ticks >> 32) & RTC_CNTL_TIME_HI);
+    REG_SET_BIT(RTC_CNTL_TIME_UPDATE_REG, RTC_CNTL_TIME_VALID);
+    return ticks;
+}
+
+void rtc_clk_8m_enable(bool clk_8m_en, bool d256_en)
+{
+    s_idf.clk_8m_en = clk_8m_en;
+    s_idf.clk_8md256_en = clk_8m_en && d256_en;
+}
+
+bool rtc_clk_8m_enabled(void)
+{
+    return s_idf.clk_8m_en;
+}
+
+bool rtc_clk_8md256_enabled(void)
+{
+    return s_idf.clk_8md256_en;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return (int64_t)s_idf.time_us;
+}
+
+uint32_t esp_log_timestamp(void)
+{
+    return (uint32_t)(s_idf.time_us / 1000);
+}
+
+void ets_delay_us(uint32_t us)
+{
+    s_idf.time_us += us;
+}
+
+int ets_printf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int ret = vprintf(fmt, args);
+    va_end(args);
+    return ret;
+}
+
+/* System and sleep */
+
+esp_reset_reason_t esp_reset_reason(void)
+{
+    return s_idf.reset_reason;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause(void)
+{
+    return s_idf.wakeup_cause;
+}
+
+esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain, esp_sleep_pd_option_t option)
+{
+    if(domain >= ESP_PD_DOMAIN_MAX)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_idf.pd_options[domain] = option;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_ulp_wakeup(void)
+{
+    REG_SET_FIELD(RTC_CNTL_WAKEUP_STATE_REG, RTC_CNTL_WAKEUP_ENA, REG_GET_FIELD(RTC_CNTL_WAKEUP_STATE_REG, RTC_CNTL_WAKEUP_ENA) | RTC_ULP_TRIG_EN);
+    return ESP_OK;
+}
+
+esp_err_t rtc_isr_register(intr_handler_t handler, void* handler_arg, uint32_t rtc_intr_mask)
+{
+    if(!handler)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for(int i = 0; i < HULP_IDF_MAX_RTC_ISRS; ++i)
+    {
+        if(!s_idf.rtc_isrs[i].handler)
+        {
+            s_idf.rtc_isrs[i].handler = handler;
+            s_idf.rtc_isrs[i].arg = handler_arg;
+            s_idf.rtc_isrs[i].mask = rtc_intr_mask;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t rtc_isr_deregister(intr_handler_t handler, void* handler_arg)
+{
+    for(int i = 0; i < HULP_IDF_MAX_RTC_ISRS; ++i)
+    {
+        if(s_idf.rtc_isrs[i].handler == handler && s_idf.rtc_isrs[i].arg == handler_arg)
+        {
+            s_idf.rtc_isrs[i].handler = NULL;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_INVALID_STATE;
+}
+
+/* ULP */
+
+typedef struct {
+    uint32_t magic;
+    uint16_t text_offset;
+    uint16_t text_size;
+    uint16_t data_size;
+    uint16_t bss_size;
+} ulp_binary_header_t;
+
+#define ULP_BINARY_MAGIC_ESP32 (0x00706c75)
+
+esp_err_t ulp_load_binary(uint32_t load_addr, const uint8_t* program_binary, size_t program_size)
+{
+    size_t program_size_bytes = program_size * sizeof(uint32_t);
+    size_t load_addr_bytes = load_addr * sizeof(uint32_t);
+    if(program_size_bytes < sizeof(ulp_binary_header_t))
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if(load_addr_bytes > CONFIG_ESP32_ULP_COPROC_RESERVE_MEM)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if(load_addr_bytes + program_size_bytes > CONFIG_ESP32_ULP_COPROC_RESERVE_MEM)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    ulp_binary_header_t header;
+    memcpy(&header, program_binary, sizeof(header));
+    if(header.magic != ULP_BINARY_MAGIC_ESP32)
+    {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    size_t total_size = (size_t)header.text_offset + header.text_size + header.data_size;
+    if(total_size != program_size_bytes)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    size_t text_data_size = header.text_size + header.data_size;
+    uint8_t* base = (uint8_t*)RTC_SLOW_MEM + load_addr_bytes;
+    memcpy(base, program_binary + header.text_offset, text_data_size);
+    memset(base + text_data_size, 0, header.bss_size);
+    return ESP_OK;
+}
+
+/**
+ * Label resolution as per ESP-IDF's ulp_process_macros_and_load: labels are PCs relative to the start of the program,
+ * macros take no words and each M_BRANCH/M_LABELPC patches the instruction that follows it.
+ */
+esp_err_t ulp_process_macros_and_load(uint32_t load_addr, const ulp_insn_t* program, size_t* psize)
+{
+    const size_t ulp_mem_end = CONFIG_ESP32_ULP_COPROC_RESERVE_MEM / sizeof(ulp_insn_t);
+    size_t num_macros = 0;
+    for(size_t i = 0; i < *psize; ++i)
+    {
+        num_macros += (program[i].macro.opcode == OPCODE_MACRO);
+    }
+    size_t num_words = *psize - num_macros;
+    if(load_addr > ulp_mem_end)
+    {
+        ESP_LOGW(TAG, "invalid load address %u, max is %u", (unsigned)load_addr, (unsigned)ulp_mem_end);
+        return ESP_ERR_ULP_INVALID_LOAD_ADDR;
+    }
+    if(num_words + load_addr > ulp_mem_end)
+    {
+        ESP_LOGE(TAG, "program too big: %u words, max is %u words", (unsigned)num_words, (unsigned)ulp_mem_end);
+        return ESP_ERR_ULP_SIZE_TOO_BIG;
+    }
+
+    // Labels first, as branches may be forwards
+    struct { uint16_t label; uint16_t pc; } *labels = calloc(num_macros ? num_macros : 1, sizeof(*labels));
+    if(!labels)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    size_t num_labels = 0;
+    uint16_t pc = 0;
+    for(size_t i = 0; i < *psize; ++i)
+    {
+        if(program[i].macro.opcode != OPCODE_MACRO)
+        {
+            ++pc;
+            continue;
+        }
+        if(program[i].macro.sub_opcode != SUB_OPCODE_MACRO_LABEL)
+        {
+            continue;
+        }
+        for(size_t l = 0; l < num_labels; ++l)
+        {
+            if(labels[l].label == program[i].macro.label)
+            {
+                ESP_LOGE(TAG, "label %u is already defined", program[i].macro.label);
+                free(labels);
+                return ESP_ERR_ULP_DUPLICATE_LABEL;
+            }
+        }
+        labels[num_labels].label = program[i].macro.label;
+        labels[num_labels].pc = pc;
+        ++num_labels;
+    }
+
+    ulp_insn_t* dest = (ulp_insn_t*)RTC_SLOW_MEM + load_addr;
+    esp_err_t err = ESP_OK;
+    pc = 0;
+    for(size_t i = 0; i < *psize && err == ESP_OK; ++i)
+    {
+        ulp_insn_t insn = program[i];
+        if(insn.macro.opcode != OPCODE_MACRO)
+        {
+            dest[pc++] = insn;
+            continue;
+        }
+        if(insn.macro.sub_opcode == SUB_OPCODE_MACRO_LABEL)
+        {
+            continue;
+        }
+        size_t l = 0;
+        while(l < num_labels && labels[l].label != insn.macro.label)
+        {
+            ++l;
+        }
+        if(l == num_labels || i + 1 >= *psize)
+        {
+            ESP_LOGE(TAG, "undefined label %u", insn.macro.label);
+            err = ESP_ERR_ULP_UNDEFINED_LABEL;
+            break;
+        }
+        // Patch the next instruction, which is copied on the next iteration
+        ulp_insn_t* next = (ulp_insn_t*)&program[i + 1];
+        ulp_insn_t patched = *next;
+        if(insn.macro.sub_opcode == SUB_OPCODE_MACRO_LABELPC)
+        {
+            patched.alu_imm.imm = labels[l].pc;
+        }
+        else if(patched.b.opcode == OPCODE_BRANCH && patched.b.sub_opcode == SUB_OPCODE_BX)
+        {
+            patched.bx.addr = labels[l].pc;
+        }
+        else
+        {
+            int32_t offset = (int32_t)labels[l].pc - pc;
+            uint32_t abs_offset = (uint32_t)abs(offset);
+            if(abs_offset > 127)
+            {
+                ESP_LOGE(TAG, "branch to label %u out of range (offset %d)", insn.macro.label, (int)offset);
+                err = ESP_ERR_ULP_BRANCH_OUT_OF_RANGE;
+                break;
+            }
+            patched.b.offset = abs_offset;
+            patched.b.sign = offset < 0;
+        }
+        dest[pc++] = patched;
+        ++i;
+    }
+    free(labels);
+    return err;
+}
+
+esp_err_t ulp_run(uint32_t entry_point)
+{
+    CLEAR_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN);
+    ets_delay_us(10);
+    REG_SET_FIELD(SENS_SAR_START_FORCE_REG, SENS_PC_INIT, entry_point);
+    CLEAR_PERI_REG_MASK(SENS_SAR_START_FORCE_REG, SENS_ULP_CP_FORCE_START_TOP);
+    SET_PERI_REG_MASK(RTC_CNTL_OPTIONS0_REG, RTC_CNTL_BIAS_I2C_FOLW_8M);
+    SET_PERI_REG_MASK(RTC_CNTL_OPTIONS0_REG, RTC_CNTL_BIAS_CORE_FOLW_8M);
+    SET_PERI_REG_MASK(RTC_CNTL_OPTIONS0_REG, RTC_CNTL_BIAS_SLEEP_FOLW_8M);
+    SET_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN);
+    return ESP_OK;
+}
+
+esp_err_t ulp_set_wakeup_period(size_t period_index, uint32_t period_us)
+{
+    if(period_index > 4)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint64_t period_cycles = rtc_time_us_to_slowclk(period_us, esp_clk_slowclk_cal_get());
+    uint64_t min_sleep_period_cycles = ULP_FSM_PREPARE_SLEEP_CYCLES + ULP_FSM_WAKEUP_SLEEP_CYCLES +
+        REG_GET_FIELD(RTC_CNTL_TIMER2_REG, RTC_CNTL_ULPCP_TOUCH_START_WAIT);
+    if(period_cycles < min_sleep_period_cycles)
+    {
+        ESP_LOGW(TAG, "Sleep period clipped to minimum of %u cycles", (unsigned)min_sleep_period_cycles);
+        period_cycles = 0;
+    }
+    else
+    {
+        period_cycles -= min_sleep_period_cycles;
+    }
+    REG_WRITE(SENS_ULP_CP_SLEEP_CYC0_REG + period_index * sizeof(uint32_t), (uint32_t)period_cycles);
+    return ESP_OK;
+}
+
+/* GPIO */
+
+int rtc_io_number_get(gpio_num_t gpio_num)
+{
+    return (gpio_num >= 0 && gpio_num < SOC_GPIO_PIN_COUNT) ? s_rtc_io_num_map[gpio_num] : -1;
+}
+
+bool rtc_gpio_is_valid_gpio(gpio_num_t gpio_num)
+{
+    return rtc_io_number_get(gpio_num) >= 0;
+}
+
+static const rtc_io_desc_t* hulp_idf_rtc_io_desc(gpio_num_t gpio_num)
+{
+    int rtcio = rtc_io_number_get(gpio_num);
+    return rtcio < 0 ? NULL : &rtc_io_desc[rtcio];
+}
+
+esp_err_t rtc_gpio_init(gpio_num_t gpio_num)
+{
+    const rtc_io_desc_t* desc = hulp_idf_rtc_io_desc(gpio_num);
+    if(!desc)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    SET_PERI_REG_MASK(desc->reg, desc->mux);
+    SET_PERI_REG_BITS(desc->reg, RTC_IO_TOUCH_PAD1_FUN_SEL_V, 0, desc->func);
+    return ESP_OK;
+}
+
+esp_err_t rtc_gpio_deinit(gpio_num_t gpio_num)
+{
+    const rtc_io_desc_t* desc = hulp_idf_rtc_io_desc(gpio_num);
+    if(!desc)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    CLEAR_PERI_REG_MASK(desc->reg, desc->mux);
+    return ESP_OK;
+}
+
+uint32_t rtc_gpio_get_level(gpio_num_t gpio_num)
+{
+    int rtcio = rtc_io_number_get(gpio_num);
+    return rtcio < 0 ? 0 : (REG_GET_FIELD(RTC_GPIO_IN_REG, RTC_GPIO_IN_NEXT) >> rtcio) & 1;
+}
+
+esp_err_t rtc_gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    int rtcio = rtc_io_number_get(gpio_num);
+    if(rtcio < 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if(level)
+    {
+        REG_SET_BIT(RTC_GPIO_OUT_REG, BIT(RTC_GPIO_OUT_DATA_S + rtcio));
+    }
+    else
+    {
+        REG_CLR_BIT(RTC_GPIO_OUT_REG, BIT(RTC_GPIO_OUT_DATA_S + rtcio));
+    }
+    return ESP_OK;
+}
+
+esp_err_t rtc_gpio_set_direction(gpio_num_t gpio_num, rtc_gpio_mode_t mode)
+{
+    int rtcio = rtc_io_number_get(gpio_num);
+    if(rtcio < 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const rtc_io_desc_t* desc = &rtc_io_desc[rtcio];
+    bool input = (mode == RTC_GPIO_MODE_INPUT_ONLY || mode == RTC_GPIO_MODE_INPUT_OUTPUT || mode == RTC_GPIO_MODE_INPUT_OUTPUT_OD);
+    bool output = (mode == RTC_GPIO_MODE_OUTPUT_ONLY || mode == RTC_GPIO_MODE_INPUT_OUTPUT ||
+        mode == RTC_GPIO_MODE_OUTPUT_OD || mode == RTC_GPIO_MODE_INPUT_OUTPUT_OD);
+    bool open_drain = (mode == RTC_GPIO_MODE_OUTPUT_OD || mode == RTC_GPIO_MODE_INPUT_OUTPUT_OD);
+    if(input)
+    {
+        SET_PERI_REG_MASK(desc->reg, desc->ie);
+    }
+    else
+    {
+        CLEAR_PERI_REG_MASK(desc->reg, desc->ie);
+    }
+    if(output)
+    {
+        REG_SET_BIT(RTC_GPIO_ENABLE_REG, BIT(RTC_GPIO_ENABLE_S + rtcio));
+    }
+    else
+    {
+        REG_CLR_BIT(RTC_GPIO_ENABLE_REG, BIT(RTC_GPIO_ENABLE_S + rtcio));
+    }
+    REG_SET_FIELD(RTC_GPIO_PIN0_REG + rtcio * sizeof(uint32_t), RTC_GPIO_PIN0_PAD_DRIVER, open_drain ? 1 : 0);
+    return ESP_OK;
+}
+
+static esp_err_t hulp_idf_rtc_gpio_set_mask(gpio_num_t gpio_num, size_t field_offset, bool set)
+{
+    const rtc_io_desc_t* desc = hulp_idf_rtc_io_desc(gpio_num);
+    if(!desc)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint32_t mask = *(const uint32_t*)((const uint8_t*)desc + field_offset);
+    if(set)
+    {
+        SET_PERI_REG_MASK(desc->reg, mask);
+    }
+    else
+    {
+        CLEAR_PERI_REG_MASK(desc->reg, mask);
+    }
+    return ESP_OK;
+}
+
+esp_err_t rtc_gpio_pullup_en(gpio_num_t gpio_num)
+{
+    return hulp_idf_rtc_gpio_set_mask(gpio_num, offsetof(rtc_io_desc_t, pullup), true);
+}
+
+esp_err_t rtc_gpio_pullup_dis(gpio_num_t gpio_num)
+{
+    return hulp_idf_rtc_gpio_set_mask(gpio_num, offsetof(rtc_io_desc_t, pullup), false);
+}
+
+esp_err_t rtc_gpio_pulldown_en(gpio_num_t gpio_num)
+{
+    return hulp_idf_rtc_gpio_set_mask(gpio_num, offsetof(rtc_io_desc_t, pulldown), true);
+}
+
+esp_err_t rtc_gpio_pulldown_dis(gpio_num_t gpio_num)
+{
+    return hulp_idf_rtc_gpio_set_mask(gpio_num, offsetof(rtc_io_desc_t, pulldown), false);
+}
+
+esp_err_t rtc_gpio_hold_en(gpio_num_t gpio_num)
+{
+    return hulp_idf_rtc_gpio_set_mask(gpio_num, offsetof(rtc_io_desc_t, hold), true);
+}
+
+esp_err_t rtc_gpio_hold_dis(gpio_num_t gpio_num)
+{
+    return hulp_idf_rtc_gpio_set_mask(gpio_num, offsetof(rtc_io_desc_t, hold), false);
+}
+
+esp_err_t rtc_gpio_isolate(gpio_num_t gpio_num)
+{
+    if(!rtc_gpio_is_valid_gpio(gpio_num))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    rtc_gpio_pullup_dis(gpio_num);
+    rtc_gpio_pulldown_dis(gpio_num);
+    rtc_gpio_set_direction(gpio_num, RTC_GPIO_MODE_DISABLED);
+    return rtc_gpio_hold_en(gpio_num);
+}
+
+esp_err_t gpio_set_pull_mode(gpio_num_t gpio_num, gpio_pull_mode_t pull)
+{
+    if(gpio_num < 0 || gpio_num >= SOC_GPIO_PIN_COUNT || pull > GPIO_FLOATING)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if(!rtc_gpio_is_valid_gpio(gpio_num))
+    {
+        // Digital GPIOs are not modelled
+        return ESP_OK;
+    }
+    bool up = (pull == GPIO_PULLUP_ONLY || pull == GPIO_PULLUP_PULLDOWN);
+    bool down = (pull == GPIO_PULLDOWN_ONLY || pull == GPIO_PULLUP_PULLDOWN);
+    up ? rtc_gpio_pullup_en(gpio_num) : rtc_gpio_pullup_dis(gpio_num);
+    down ? rtc_gpio_pulldown_en(gpio_num) : rtc_gpio_pulldown_dis(gpio_num);
+    return ESP_OK;
+}
+
+/* Touch */
+
+esp_err_t touch_pad_init(void)
+{
+    return ESP_OK;
+}
+
+esp_err_t touch_pad_io_init(touch_pad_t touch_num)
+{
+    if(touch_num >= TOUCH_PAD_MAX)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gpio_num_t gpio_num = (gpio_num_t)touch_sensor_channel_io_map[touch_num];
+    rtc_gpio_init(gpio_num);
+    rtc_gpio_set_direction(gpio_num, RTC_GPIO_MODE_DISABLED);
+    rtc_gpio_pulldown_dis(gpio_num);
+    rtc_gpio_pullup_dis(gpio_num);
+    return ESP_OK;
+}
+
+esp_err_t touch_pad_set_fsm_mode(touch_fsm_mode_t mode)
+{
+    return mode < TOUCH_FSM_MODE_MAX ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t touch_pad_set_voltage(touch_high_volt_t refh, touch_low_volt_t refl, touch_volt_atten_t atten)
+{
+    return (refh < TOUCH_HVOLT_MAX && refl < TOUCH_LVOLT_MAX && atten < TOUCH_HVOLT_ATTEN_MAX) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t touch_pad_set_meas_time(uint16_t sleep_cycle, uint16_t meas_cycle)
+{
+    return ESP_OK;
+}
+
+esp_err_t touch_pad_set_cnt_mode(touch_pad_t touch_num, touch_cnt_slope_t slope, touch_tie_opt_t opt)
+{
+    return (touch_num < TOUCH_PAD_MAX && slope < TOUCH_PAD_SLOPE_MAX && opt < TOUCH_PAD_TIE_OPT_MAX) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t touch_pad_set_group_mask(uint16_t set1_mask, uint16_t set2_mask, uint16_t en_mask)
+{
+    REG_SET_FIELD(SENS_SAR_TOUCH_ENABLE_REG, SENS_TOUCH_PAD_OUTEN1, REG_GET_FIELD(SENS_SAR_TOUCH_ENABLE_REG, SENS_TOUCH_PAD_OUTEN1) | set1_mask);
+    REG_SET_FIELD(SENS_SAR_TOUCH_ENABLE_REG, SENS_TOUCH_PAD_OUTEN2, REG_GET_FIELD(SENS_SAR_TOUCH_ENABLE_REG, SENS_TOUCH_PAD_OUTEN2) | set2_mask);
+    REG_SET_FIELD(SENS_SAR_TOUCH_ENABLE_REG, SENS_TOUCH_PAD_WORKEN, REG_GET_FIELD(SENS_SAR_TOUCH_ENABLE_REG, SENS_TOUCH_PAD_WORKEN) | en_mask);
+    return ESP_OK;
+}
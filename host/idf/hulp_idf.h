@@ -0,0 +1,68 @@
+#ifndef HULP_IDF_H
+#define HULP_IDF_H
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_sleep.h"
+#include "esp_system.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Host stand-in for the parts of ESP-IDF used by HULP's SoC-side sources (hulp.c, hulp_debug.c, hulp_uart.c, etc.).
+ *
+ * Registers are an in-memory register file covering the RTC peripherals (RTC_CNTL, RTCIO, SENS, RTC_I2C), which the
+ * drivers (rtc_gpio_*, ulp_run, ulp_set_wakeup_period, etc.) update as they would on the target. RTC_SLOW_MEM is an 8KB
+ * section laid out as on the target: the ULP reserved area (CONFIG_ESP32_ULP_COPROC_RESERVE_MEM), then RTC_DATA_ATTR
+ * variables. Time only advances with ets_delay_us or hulp_idf_advance_us, so that results are repeatable.
+ *
+ * Executables must link with host/idf/hulp_rtc_slow.ld (as the hulp_idf CMake target does).
+ */
+
+#define HULP_IDF_SLOW_CLK_HZ_DEFAULT 150000
+#define HULP_IDF_FAST_CLK_HZ_DEFAULT 8500000
+
+/**
+ * Restore the initial state: clear the register file and the ULP reserved area of RTC slow memory, deregister RTC
+ * interrupt handlers, and reset the time, clocks, wakeup cause (undefined) and reset reason (power on).
+ * RTC_DATA_ATTR variables are left as they are.
+ */
+void hulp_idf_reset(void);
+
+/**
+ * Set the RTC slow and fast (8M) clock frequencies, as returned by their calibrations.
+ */
+void hulp_idf_set_clocks(uint32_t slow_hz, uint32_t fast_hz);
+
+/**
+ * Set the result of esp_sleep_get_wakeup_cause.
+ */
+void hulp_idf_set_wakeup_cause(esp_sleep_wakeup_cause_t cause);
+
+/**
+ * Set the result of esp_reset_reason.
+ */
+void hulp_idf_set_reset_reason(esp_reset_reason_t reason);
+
+/**
+ * Advance the time of esp_timer_get_time and rtc_time_get.
+ */
+void hulp_idf_advance_us(uint64_t us);
+
+/**
+ * Raise RTC interrupts (eg. RTC_CNTL_SAR_INT_ST_M, as by a ULP I_WAKE), as the RTC interrupt does on the target:
+ * sets them in RTC_CNTL_INT_RAW_REG, calls the handlers registered for those enabled in RTC_CNTL_INT_ENA_REG, then clears them.
+ * Note that the ULP interrupt's enable bit (RTC_CNTL_ULP_CP_INT_ENA_M) is its status bit (RTC_CNTL_SAR_INT_ST_M).
+ *
+ * Returns the number of handlers called.
+ */
+int hulp_idf_raise_rtc_intr(uint32_t mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_IDF_H */
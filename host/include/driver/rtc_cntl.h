@@ -0,0 +1,18 @@
+#ifndef HULP_HOST_DRIVER_RTC_CNTL_H
+#define HULP_HOST_DRIVER_RTC_CNTL_H
+
+#include "esp_err.h"
+#include "driver/gpio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+esp_err_t rtc_isr_register(intr_handler_t handler, void* handler_arg, uint32_t rtc_intr_mask);
+esp_err_t rtc_isr_deregister(intr_handler_t handler, void* handler_arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_DRIVER_RTC_CNTL_H */
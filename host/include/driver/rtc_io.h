@@ -0,0 +1,39 @@
+#ifndef HULP_HOST_DRIVER_RTC_IO_H
+#define HULP_HOST_DRIVER_RTC_IO_H
+
+#include "driver/gpio.h"
+#include "soc/rtc_io_periph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    RTC_GPIO_MODE_INPUT_ONLY,
+    RTC_GPIO_MODE_OUTPUT_ONLY,
+    RTC_GPIO_MODE_INPUT_OUTPUT,
+    RTC_GPIO_MODE_DISABLED,
+    RTC_GPIO_MODE_OUTPUT_OD,
+    RTC_GPIO_MODE_INPUT_OUTPUT_OD
+} rtc_gpio_mode_t;
+
+bool rtc_gpio_is_valid_gpio(gpio_num_t gpio_num);
+int rtc_io_number_get(gpio_num_t gpio_num);
+esp_err_t rtc_gpio_init(gpio_num_t gpio_num);
+esp_err_t rtc_gpio_deinit(gpio_num_t gpio_num);
+uint32_t rtc_gpio_get_level(gpio_num_t gpio_num);
+esp_err_t rtc_gpio_set_level(gpio_num_t gpio_num, uint32_t level);
+esp_err_t rtc_gpio_set_direction(gpio_num_t gpio_num, rtc_gpio_mode_t mode);
+esp_err_t rtc_gpio_pullup_en(gpio_num_t gpio_num);
+esp_err_t rtc_gpio_pullup_dis(gpio_num_t gpio_num);
+esp_err_t rtc_gpio_pulldown_en(gpio_num_t gpio_num);
+esp_err_t rtc_gpio_pulldown_dis(gpio_num_t gpio_num);
+esp_err_t rtc_gpio_hold_en(gpio_num_t gpio_num);
+esp_err_t rtc_gpio_hold_dis(gpio_num_t gpio_num);
+esp_err_t rtc_gpio_isolate(gpio_num_t gpio_num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_DRIVER_RTC_IO_H */
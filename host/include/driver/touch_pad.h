@@ -0,0 +1,94 @@
+#ifndef HULP_HOST_DRIVER_TOUCH_PAD_H
+#define HULP_HOST_DRIVER_TOUCH_PAD_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "soc/touch_sensor_channel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    TOUCH_PAD_NUM0 = 0,
+    TOUCH_PAD_NUM1,
+    TOUCH_PAD_NUM2,
+    TOUCH_PAD_NUM3,
+    TOUCH_PAD_NUM4,
+    TOUCH_PAD_NUM5,
+    TOUCH_PAD_NUM6,
+    TOUCH_PAD_NUM7,
+    TOUCH_PAD_NUM8,
+    TOUCH_PAD_NUM9,
+    TOUCH_PAD_MAX
+} touch_pad_t;
+
+typedef enum {
+    TOUCH_HVOLT_KEEP = -1,
+    TOUCH_HVOLT_2V4 = 0,
+    TOUCH_HVOLT_2V5,
+    TOUCH_HVOLT_2V6,
+    TOUCH_HVOLT_2V7,
+    TOUCH_HVOLT_MAX
+} touch_high_volt_t;
+
+typedef enum {
+    TOUCH_LVOLT_KEEP = -1,
+    TOUCH_LVOLT_0V5 = 0,
+    TOUCH_LVOLT_0V6,
+    TOUCH_LVOLT_0V7,
+    TOUCH_LVOLT_0V8,
+    TOUCH_LVOLT_MAX
+} touch_low_volt_t;
+
+typedef enum {
+    TOUCH_HVOLT_ATTEN_KEEP = -1,
+    TOUCH_HVOLT_ATTEN_1V5 = 0,
+    TOUCH_HVOLT_ATTEN_1V,
+    TOUCH_HVOLT_ATTEN_0V5,
+    TOUCH_HVOLT_ATTEN_0V,
+    TOUCH_HVOLT_ATTEN_MAX
+} touch_volt_atten_t;
+
+typedef enum {
+    TOUCH_PAD_SLOPE_0 = 0,
+    TOUCH_PAD_SLOPE_1,
+    TOUCH_PAD_SLOPE_2,
+    TOUCH_PAD_SLOPE_3,
+    TOUCH_PAD_SLOPE_4,
+    TOUCH_PAD_SLOPE_5,
+    TOUCH_PAD_SLOPE_6,
+    TOUCH_PAD_SLOPE_7,
+    TOUCH_PAD_SLOPE_MAX
+} touch_cnt_slope_t;
+
+typedef enum {
+    TOUCH_PAD_TIE_OPT_LOW = 0,
+    TOUCH_PAD_TIE_OPT_HIGH,
+    TOUCH_PAD_TIE_OPT_MAX
+} touch_tie_opt_t;
+
+typedef enum {
+    TOUCH_FSM_MODE_TIMER = 0,
+    TOUCH_FSM_MODE_SW,
+    TOUCH_FSM_MODE_MAX
+} touch_fsm_mode_t;
+
+#define TOUCH_PAD_SLOPE_DEFAULT (TOUCH_PAD_SLOPE_7)
+#define TOUCH_PAD_TIE_OPT_DEFAULT (TOUCH_PAD_TIE_OPT_LOW)
+#define TOUCH_PAD_SLEEP_CYCLE_DEFAULT (0x1000)
+#define TOUCH_PAD_MEASURE_CYCLE_DEFAULT (0x7fff)
+
+esp_err_t touch_pad_init(void);
+esp_err_t touch_pad_io_init(touch_pad_t touch_num);
+esp_err_t touch_pad_set_fsm_mode(touch_fsm_mode_t mode);
+esp_err_t touch_pad_set_voltage(touch_high_volt_t refh, touch_low_volt_t refl, touch_volt_atten_t atten);
+esp_err_t touch_pad_set_meas_time(uint16_t sleep_cycle, uint16_t meas_cycle);
+esp_err_t touch_pad_set_cnt_mode(touch_pad_t touch_num, touch_cnt_slope_t slope, touch_tie_opt_t opt);
+esp_err_t touch_pad_set_group_mask(uint16_t set1_mask, uint16_t set2_mask, uint16_t en_mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_DRIVER_TOUCH_PAD_H */
@@ -0,0 +1,16 @@
+#ifndef HULP_HOST_ESP32_CLK_H
+#define HULP_HOST_ESP32_CLK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t esp_clk_slowclk_cal_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_ESP32_CLK_H */
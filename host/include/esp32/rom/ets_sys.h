@@ -0,0 +1,17 @@
+#ifndef HULP_HOST_ESP32_ROM_ETS_SYS_H
+#define HULP_HOST_ESP32_ROM_ETS_SYS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void ets_delay_us(uint32_t us);
+int ets_printf(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_ESP32_ROM_ETS_SYS_H */
@@ -0,0 +1,173 @@
+#ifndef HULP_HOST_ESP32_ULP_H
+#define HULP_HOST_ESP32_ULP_H
+
+// Host build: instruction encodings and macros of ESP-IDF's esp32/ulp.h (v4.x)
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "soc/soc.h"
+#include "soc/rtc_cntl_reg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#define R0 0
+#define R1 1
+#define R2 2
+#define R3 3
+#define OPCODE_WR_REG 1
+#define OPCODE_RD_REG 2
+#define RD_REG_PERIPH_RTC_CNTL 0
+#define RD_REG_PERIPH_RTC_IO 1
+#define RD_REG_PERIPH_SENS 2
+#define RD_REG_PERIPH_RTC_I2C 3
+#define OPCODE_I2C 3
+#define SUB_OPCODE_I2C_RD 0
+#define SUB_OPCODE_I2C_WR 1
+#define OPCODE_DELAY 4
+#define OPCODE_ADC 5
+#define OPCODE_ST 6
+#define SUB_OPCODE_ST 4
+#define OPCODE_ALU 7
+#define SUB_OPCODE_ALU_REG 0
+#define SUB_OPCODE_ALU_IMM 1
+#define ALU_SEL_ADD 0
+#define ALU_SEL_SUB 1
+#define ALU_SEL_AND 2
+#define ALU_SEL_OR  3
+#define ALU_SEL_MOV 4
+#define ALU_SEL_LSH 5
+#define ALU_SEL_RSH 6
+#define SUB_OPCODE_ALU_CNT 2
+#define ALU_SEL_SINC 0
+#define ALU_SEL_SDEC 1
+#define ALU_SEL_SRST 2
+#define OPCODE_BRANCH 8
+#define SUB_OPCODE_BX 0
+#define BX_JUMP_TYPE_DIRECT 0
+#define BX_JUMP_TYPE_ZERO 1
+#define BX_JUMP_TYPE_OVF 2
+#define SUB_OPCODE_BR 1
+#define B_CMP_L 0
+#define B_CMP_GE 1
+#define SUB_OPCODE_BS 2
+#define JUMPS_LT 0
+#define JUMPS_GE 1
+#define JUMPS_LE 2
+#define OPCODE_END 9
+#define SUB_OPCODE_END 0
+#define SUB_OPCODE_SLEEP 1
+#define OPCODE_TSENS 10
+#define OPCODE_HALT 11
+#define OPCODE_LD 13
+#define OPCODE_MACRO 15
+#define SUB_OPCODE_MACRO_LABEL 0
+#define SUB_OPCODE_MACRO_BRANCH 1
+#define SUB_OPCODE_MACRO_LABELPC 2
+
+#define ESP_ERR_ULP_BASE 0x1200
+#define ESP_ERR_ULP_SIZE_TOO_BIG (ESP_ERR_ULP_BASE + 1)
+#define ESP_ERR_ULP_INVALID_LOAD_ADDR (ESP_ERR_ULP_BASE + 2)
+#define ESP_ERR_ULP_DUPLICATE_LABEL (ESP_ERR_ULP_BASE + 3)
+#define ESP_ERR_ULP_UNDEFINED_LABEL (ESP_ERR_ULP_BASE + 4)
+#define ESP_ERR_ULP_BRANCH_OUT_OF_RANGE (ESP_ERR_ULP_BASE + 5)
+
+typedef union {
+    struct { uint32_t cycles : 16; uint32_t unused : 12; uint32_t opcode : 4; } delay;
+    struct { uint32_t dreg : 2; uint32_t wait_delay : 14; uint32_t reserved : 12; uint32_t opcode : 4; } tsens;
+    struct { uint32_t dreg : 2; uint32_t mux : 4; uint32_t sar_sel : 1; uint32_t unused1 : 1; uint32_t cycles : 16; uint32_t unused2 : 4; uint32_t opcode : 4; } adc;
+    struct { uint32_t dreg : 2; uint32_t sreg : 2; uint32_t unused1 : 6; uint32_t offset : 11; uint32_t unused2 : 4; uint32_t sub_opcode : 3; uint32_t opcode : 4; } st;
+    struct { uint32_t dreg : 2; uint32_t sreg : 2; uint32_t unused1 : 6; uint32_t offset : 11; uint32_t unused2 : 7; uint32_t opcode : 4; } ld;
+    struct { uint32_t unused : 28; uint32_t opcode : 4; } halt;
+    struct { uint32_t dreg : 2; uint32_t addr : 11; uint32_t unused : 8; uint32_t reg : 1; uint32_t type : 3; uint32_t sub_opcode : 3; uint32_t opcode : 4; } bx;
+    struct { uint32_t imm : 16; uint32_t cmp : 1; uint32_t offset : 7; uint32_t sign : 1; uint32_t sub_opcode : 3; uint32_t opcode : 4; } b;
+    struct { uint32_t imm : 8; uint32_t unused : 7; uint32_t cmp : 2; uint32_t offset : 7; uint32_t sign : 1; uint32_t sub_opcode : 3; uint32_t opcode : 4; } bs;
+    struct { uint32_t dreg : 2; uint32_t sreg : 2; uint32_t treg : 2; uint32_t unused : 15; uint32_t sel : 4; uint32_t sub_opcode : 3; uint32_t opcode : 4; } alu_reg;
+    struct { uint32_t unused1 : 4; uint32_t imm : 8; uint32_t unused2 : 9; uint32_t sel : 4; uint32_t sub_opcode : 3; uint32_t opcode : 4; } alu_reg_s;
+    struct { uint32_t dreg : 2; uint32_t sreg : 2; uint32_t imm : 16; uint32_t unused : 1; uint32_t sel : 4; uint32_t sub_opcode : 3; uint32_t opcode : 4; } alu_imm;
+    struct { uint32_t addr : 8; uint32_t periph_sel : 2; uint32_t data : 8; uint32_t low : 5; uint32_t high : 5; uint32_t opcode : 4; } wr_reg;
+    struct { uint32_t addr : 8; uint32_t periph_sel : 2; uint32_t unused : 8; uint32_t low : 5; uint32_t high : 5; uint32_t opcode : 4; } rd_reg;
+    struct { uint32_t i2c_addr : 8; uint32_t data : 8; uint32_t low_bits : 3; uint32_t high_bits : 3; uint32_t i2c_sel : 4; uint32_t unused : 1; uint32_t rw : 1; uint32_t opcode : 4; } i2c;
+    struct { uint32_t wakeup : 1; uint32_t unused : 24; uint32_t sub_opcode : 3; uint32_t opcode : 4; } end;
+    struct { uint32_t cycle_sel : 4; uint32_t unused : 21; uint32_t sub_opcode : 3; uint32_t opcode : 4; } sleep;
+    struct { uint32_t label : 16; uint32_t unused : 8; uint32_t sub_opcode : 4; uint32_t opcode : 4; } macro;
+    uint32_t instruction;
+} ulp_insn_t;
+
+#define SOC_REG_TO_ULP_PERIPH_SEL(reg) (uint32_t)(((reg) - DR_REG_RTCCNTL_BASE) / 0x400)
+
+#define I_DELAY(cycles_) { .delay = { .cycles = cycles_, .unused = 0, .opcode = OPCODE_DELAY } }
+#define I_HALT() { .halt = { .unused = 0, .opcode = OPCODE_HALT } }
+#define I_WR_REG(reg, low_bit, high_bit, val) { .wr_reg = { .addr = (((reg) - DR_REG_RTCCNTL_BASE) % 0x400) / sizeof(uint32_t), .periph_sel = SOC_REG_TO_ULP_PERIPH_SEL(reg), .data = (val), .low = (low_bit), .high = (high_bit), .opcode = OPCODE_WR_REG } }
+#define I_RD_REG(reg, low_bit, high_bit) { .rd_reg = { .addr = (((reg) - DR_REG_RTCCNTL_BASE) % 0x400) / sizeof(uint32_t), .periph_sel = SOC_REG_TO_ULP_PERIPH_SEL(reg), .unused = 0, .low = (low_bit), .high = (high_bit), .opcode = OPCODE_RD_REG } }
+#define I_WR_REG_BIT(reg, shift, val) I_WR_REG(reg, shift, shift, val)
+#define I_WAKE() { .end = { .wakeup = 1, .unused = 0, .sub_opcode = SUB_OPCODE_END, .opcode = OPCODE_END } }
+#define I_END() I_WR_REG_BIT(RTC_CNTL_STATE0_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN_S, 0)
+#define I_SLEEP_CYCLE_SEL(timer_idx) { .sleep = { .cycle_sel = (timer_idx), .unused = 0, .sub_opcode = SUB_OPCODE_SLEEP, .opcode = OPCODE_END } }
+#define I_I2C_RW(sub_addr, val, low_bit, high_bit, slave_sel, rw_bit) { .i2c = { .i2c_addr = (sub_addr), .data = (val), .low_bits = (low_bit), .high_bits = (high_bit), .i2c_sel = (slave_sel), .unused = 0, .rw = (rw_bit), .opcode = OPCODE_I2C } }
+#define I_I2C_READ(slave_sel, sub_addr) I_I2C_RW(sub_addr, 0, 0, 7, slave_sel, SUB_OPCODE_I2C_RD)
+#define I_I2C_WRITE(slave_sel, sub_addr, val) I_I2C_RW(sub_addr, val, 0, 7, slave_sel, SUB_OPCODE_I2C_WR)
+#define I_TSENS(reg_dest, delay) { .tsens = { .dreg = (reg_dest), .wait_delay = (delay), .reserved = 0, .opcode = OPCODE_TSENS } }
+#define I_ADC(reg_dest, adc_idx, pad_idx) { .adc = { .dreg = (reg_dest), .mux = (pad_idx) + 1, .sar_sel = (adc_idx), .unused1 = 0, .cycles = 0, .unused2 = 0, .opcode = OPCODE_ADC } }
+#define I_ST(reg_val, reg_addr, offset_) { .st = { .dreg = (reg_val), .sreg = (reg_addr), .unused1 = 0, .offset = (offset_), .unused2 = 0, .sub_opcode = SUB_OPCODE_ST, .opcode = OPCODE_ST } }
+#define I_LD(reg_dest, reg_addr, offset_) { .ld = { .dreg = (reg_dest), .sreg = (reg_addr), .unused1 = 0, .offset = (offset_), .unused2 = 0, .opcode = OPCODE_LD } }
+#define I_BL(pc_offset, imm_value) { .b = { .imm = (imm_value), .cmp = B_CMP_L, .offset = ((pc_offset) < 0) ? -(pc_offset) : (pc_offset), .sign = ((pc_offset) < 0) ? 1 : 0, .sub_opcode = SUB_OPCODE_BR, .opcode = OPCODE_BRANCH } }
+#define I_BGE(pc_offset, imm_value) { .b = { .imm = (imm_value), .cmp = B_CMP_GE, .offset = ((pc_offset) < 0) ? -(pc_offset) : (pc_offset), .sign = ((pc_offset) < 0) ? 1 : 0, .sub_opcode = SUB_OPCODE_BR, .opcode = OPCODE_BRANCH } }
+#define I_BXR(reg_pc) { .bx = { .dreg = (reg_pc), .addr = 0, .unused = 0, .reg = 1, .type = BX_JUMP_TYPE_DIRECT, .sub_opcode = SUB_OPCODE_BX, .opcode = OPCODE_BRANCH } }
+#define I_BXI(imm_pc) { .bx = { .dreg = 0, .addr = (imm_pc), .unused = 0, .reg = 0, .type = BX_JUMP_TYPE_DIRECT, .sub_opcode = SUB_OPCODE_BX, .opcode = OPCODE_BRANCH } }
+#define I_BXZR(reg_pc) { .bx = { .dreg = (reg_pc), .addr = 0, .unused = 0, .reg = 1, .type = BX_JUMP_TYPE_ZERO, .sub_opcode = SUB_OPCODE_BX, .opcode = OPCODE_BRANCH } }
+#define I_BXZI(imm_pc) { .bx = { .dreg = 0, .addr = (imm_pc), .unused = 0, .reg = 0, .type = BX_JUMP_TYPE_ZERO, .sub_opcode = SUB_OPCODE_BX, .opcode = OPCODE_BRANCH } }
+#define I_BXFR(reg_pc) { .bx = { .dreg = (reg_pc), .addr = 0, .unused = 0, .reg = 1, .type = BX_JUMP_TYPE_OVF, .sub_opcode = SUB_OPCODE_BX, .opcode = OPCODE_BRANCH } }
+#define I_BXFI(imm_pc) { .bx = { .dreg = 0, .addr = (imm_pc), .unused = 0, .reg = 0, .type = BX_JUMP_TYPE_OVF, .sub_opcode = SUB_OPCODE_BX, .opcode = OPCODE_BRANCH } }
+#define I_ALUR(sel_, d, s, t) { .alu_reg = { .dreg = (d), .sreg = (s), .treg = (t), .unused = 0, .sel = (sel_), .sub_opcode = SUB_OPCODE_ALU_REG, .opcode = OPCODE_ALU } }
+#define I_ADDR(d, s, t) I_ALUR(ALU_SEL_ADD, d, s, t)
+#define I_SUBR(d, s, t) I_ALUR(ALU_SEL_SUB, d, s, t)
+#define I_ANDR(d, s, t) I_ALUR(ALU_SEL_AND, d, s, t)
+#define I_ORR(d, s, t) I_ALUR(ALU_SEL_OR, d, s, t)
+#define I_MOVR(d, s) I_ALUR(ALU_SEL_MOV, d, s, 0)
+#define I_LSHR(d, s, t) I_ALUR(ALU_SEL_LSH, d, s, t)
+#define I_RSHR(d, s, t) I_ALUR(ALU_SEL_RSH, d, s, t)
+#define I_ALUI(sel_, d, s, i) { .alu_imm = { .dreg = (d), .sreg = (s), .imm = (i), .unused = 0, .sel = (sel_), .sub_opcode = SUB_OPCODE_ALU_IMM, .opcode = OPCODE_ALU } }
+#define I_ADDI(d, s, i) I_ALUI(ALU_SEL_ADD, d, s, i)
+#define I_SUBI(d, s, i) I_ALUI(ALU_SEL_SUB, d, s, i)
+#define I_ANDI(d, s, i) I_ALUI(ALU_SEL_AND, d, s, i)
+#define I_ORI(d, s, i) I_ALUI(ALU_SEL_OR, d, s, i)
+#define I_MOVI(d, i) I_ALUI(ALU_SEL_MOV, d, 0, i)
+#define I_LSHI(d, s, i) I_ALUI(ALU_SEL_LSH, d, s, i)
+#define I_RSHI(d, s, i) I_ALUI(ALU_SEL_RSH, d, s, i)
+#define I_STAGE(sel_, i) { .alu_reg_s = { .unused1 = 0, .imm = (i), .unused2 = 0, .sel = (sel_), .sub_opcode = SUB_OPCODE_ALU_CNT, .opcode = OPCODE_ALU } }
+#define I_STAGE_INC(i) I_STAGE(ALU_SEL_SINC, i)
+#define I_STAGE_DEC(i) I_STAGE(ALU_SEL_SDEC, i)
+#define I_STAGE_RST() I_STAGE(ALU_SEL_SRST, 0)
+#define I_JUMPS(pc_offset, imm_value, comp_type) { .bs = { .imm = (imm_value), .unused = 0, .cmp = (comp_type), .offset = ((pc_offset) < 0) ? -(pc_offset) : (pc_offset), .sign = ((pc_offset) < 0) ? 1 : 0, .sub_opcode = SUB_OPCODE_BS, .opcode = OPCODE_BRANCH } }
+#define M_LABEL(label_num) { .macro = { .label = (label_num), .unused = 0, .sub_opcode = SUB_OPCODE_MACRO_LABEL, .opcode = OPCODE_MACRO } }
+#define M_BRANCH(label_num) { .macro = { .label = (label_num), .unused = 0, .sub_opcode = SUB_OPCODE_MACRO_BRANCH, .opcode = OPCODE_MACRO } }
+#define M_LABELPC(label_num) { .macro = { .label = (label_num), .unused = 0, .sub_opcode = SUB_OPCODE_MACRO_LABELPC, .opcode = OPCODE_MACRO } }
+#define M_BL(label_num, imm_value) M_BRANCH(label_num), I_BL(0, imm_value)
+#define M_BGE(label_num, imm_value) M_BRANCH(label_num), I_BGE(0, imm_value)
+#define M_BX(label_num) M_BRANCH(label_num), I_BXI(0)
+#define M_BXZ(label_num) M_BRANCH(label_num), I_BXZI(0)
+#define M_BXF(label_num) M_BRANCH(label_num), I_BXFI(0)
+#define M_MOVL(reg_dest, label_num) M_LABELPC(label_num), I_MOVI(reg_dest, 0)
+#define M_BSLT(label_num, imm_value) M_BRANCH(label_num), I_JUMPS(0, imm_value, JUMPS_LT)
+#define M_BSGE(label_num, imm_value) M_BRANCH(label_num), I_JUMPS(0, imm_value, JUMPS_GE)
+#define M_BSLE(label_num, imm_value) M_BRANCH(label_num), I_JUMPS(0, imm_value, JUMPS_LE)
+
+#define ULP_FSM_PREPARE_SLEEP_CYCLES 2    /*!< Cycles spent by FSM preparing ULP for sleep */
+#define ULP_FSM_WAKEUP_SLEEP_CYCLES  2    /*!< Cycles spent by FSM waking up ULP from sleep */
+
+// RTC slow memory is host/idf's hulp_host_rtc_slow_mem (see host/idf/hulp_rtc_slow.ld)
+extern uint32_t hulp_host_rtc_slow_mem[];
+#define RTC_SLOW_MEM (hulp_host_rtc_slow_mem)
+
+esp_err_t ulp_process_macros_and_load(uint32_t load_addr, const ulp_insn_t* program, size_t* psize);
+esp_err_t ulp_load_binary(uint32_t load_addr, const uint8_t* program_binary, size_t program_size);
+esp_err_t ulp_run(uint32_t entry_point);
+esp_err_t ulp_set_wakeup_period(size_t period_index, uint32_t period_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_ESP32_ULP_H */
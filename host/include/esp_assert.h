@@ -0,0 +1,13 @@
+#ifndef HULP_HOST_ESP_ASSERT_H
+#define HULP_HOST_ESP_ASSERT_H
+
+#include <assert.h>
+
+#define ESP_STATIC_ASSERT _Static_assert
+
+// Only asserts if CONDITION is a compile time constant (eg. not the address of a variable)
+#define TRY_STATIC_ASSERT(CONDITION, MSG) do { \
+            _Static_assert(__builtin_choose_expr(__builtin_constant_p(CONDITION), (CONDITION), 1), #MSG); \
+        } while(0)
+
+#endif /* HULP_HOST_ESP_ASSERT_H */
@@ -0,0 +1,14 @@
+#ifndef HULP_HOST_ESP_ATTR_H
+#define HULP_HOST_ESP_ATTR_H
+
+// RTC slow memory variables are placed after the ULP reserved area by host/idf/hulp_rtc_slow.ld, so that
+// RTC_WORD_OFFSET is as on the target
+
+#define RTC_DATA_ATTR __attribute__((section(".rtc.data")))
+#define RTC_NOINIT_ATTR __attribute__((section(".rtc_noinit")))
+#define RTC_SLOW_ATTR RTC_DATA_ATTR
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif /* HULP_HOST_ESP_ATTR_H */
@@ -0,0 +1,25 @@
+#ifndef HULP_HOST_ESP_LOG_H
+#define HULP_HOST_ESP_LOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+// Errors and warnings go to stderr; info and below are discarded
+
+#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) fprintf(stderr, "W %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) do {} while(0)
+#define ESP_LOGD(tag, format, ...) do {} while(0)
+#define ESP_LOGV(tag, format, ...) do {} while(0)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t esp_log_timestamp(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_ESP_LOG_H */
@@ -0,0 +1,46 @@
+#ifndef HULP_HOST_ESP_SLEEP_H
+#define HULP_HOST_ESP_SLEEP_H
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ESP_PD_DOMAIN_RTC_PERIPH,
+    ESP_PD_DOMAIN_RTC_SLOW_MEM,
+    ESP_PD_DOMAIN_RTC_FAST_MEM,
+    ESP_PD_DOMAIN_XTAL,
+    ESP_PD_DOMAIN_MAX
+} esp_sleep_pd_domain_t;
+
+typedef enum {
+    ESP_PD_OPTION_OFF,
+    ESP_PD_OPTION_ON,
+    ESP_PD_OPTION_AUTO
+} esp_sleep_pd_option_t;
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED,
+    ESP_SLEEP_WAKEUP_ALL,
+    ESP_SLEEP_WAKEUP_EXT0,
+    ESP_SLEEP_WAKEUP_EXT1,
+    ESP_SLEEP_WAKEUP_TIMER,
+    ESP_SLEEP_WAKEUP_TOUCHPAD,
+    ESP_SLEEP_WAKEUP_ULP,
+    ESP_SLEEP_WAKEUP_GPIO,
+    ESP_SLEEP_WAKEUP_UART
+} esp_sleep_source_t;
+
+typedef esp_sleep_source_t esp_sleep_wakeup_cause_t;
+
+esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain, esp_sleep_pd_option_t option);
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause(void);
+esp_err_t esp_sleep_enable_ulp_wakeup(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_ESP_SLEEP_H */
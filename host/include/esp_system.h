@@ -0,0 +1,30 @@
+#ifndef HULP_HOST_ESP_SYSTEM_H
+#define HULP_HOST_ESP_SYSTEM_H
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO
+} esp_reset_reason_t;
+
+esp_reset_reason_t esp_reset_reason(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_ESP_SYSTEM_H */
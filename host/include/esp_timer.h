@@ -0,0 +1,16 @@
+#ifndef HULP_HOST_ESP_TIMER_H
+#define HULP_HOST_ESP_TIMER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int64_t esp_timer_get_time(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_ESP_TIMER_H */
@@ -0,0 +1,11 @@
+#ifndef HULP_HOST_SDKCONFIG_H
+#define HULP_HOST_SDKCONFIG_H
+
+// Host build configuration, standing in for the sdkconfig.h generated by ESP-IDF
+
+#define CONFIG_IDF_TARGET_ESP32 1
+#define CONFIG_IDF_TARGET "esp32"
+#define CONFIG_ESP32_ULP_COPROC_ENABLED 1
+#define CONFIG_ESP32_ULP_COPROC_RESERVE_MEM 4096
+
+#endif /* HULP_HOST_SDKCONFIG_H */
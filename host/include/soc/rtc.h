@@ -0,0 +1,31 @@
+#ifndef HULP_HOST_SOC_RTC_H
+#define HULP_HOST_SOC_RTC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RTC_CLK_CAL_FRACT 19
+
+typedef enum {
+    RTC_CAL_RTC_MUX = 0,
+    RTC_CAL_8MD256 = 1,
+    RTC_CAL_32K_XTAL = 2
+} rtc_cal_sel_t;
+
+uint32_t rtc_clk_cal(rtc_cal_sel_t cal_clk, uint32_t slow_clk_cycles);
+uint64_t rtc_time_us_to_slowclk(uint64_t time_in_us, uint32_t period);
+uint64_t rtc_time_slowclk_to_us(uint64_t rtc_cycles, uint32_t period);
+uint64_t rtc_time_get(void);
+void rtc_clk_8m_enable(bool clk_8m_en, bool d256_en);
+bool rtc_clk_8m_enabled(void);
+bool rtc_clk_8md256_enabled(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_SOC_RTC_H */
@@ -0,0 +1,198 @@
+#ifndef HULP_HOST_RTC_CNTL_REG_H
+#define HULP_HOST_RTC_CNTL_REG_H
+
+#include "soc/soc.h"
+
+#define RTC_CNTL_OPTIONS0_REG (DR_REG_RTCCNTL_BASE + 0x0)
+#define RTC_CNTL_BIAS_CORE_FOLW_8M (BIT(20))
+#define RTC_CNTL_BIAS_CORE_FOLW_8M_M (BIT(20))
+#define RTC_CNTL_BIAS_CORE_FOLW_8M_V 0x1
+#define RTC_CNTL_BIAS_CORE_FOLW_8M_S 20
+#define RTC_CNTL_BIAS_I2C_FOLW_8M (BIT(17))
+#define RTC_CNTL_BIAS_I2C_FOLW_8M_M (BIT(17))
+#define RTC_CNTL_BIAS_I2C_FOLW_8M_V 0x1
+#define RTC_CNTL_BIAS_I2C_FOLW_8M_S 17
+#define RTC_CNTL_BIAS_SLEEP_FOLW_8M (BIT(14))
+#define RTC_CNTL_BIAS_SLEEP_FOLW_8M_M (BIT(14))
+#define RTC_CNTL_BIAS_SLEEP_FOLW_8M_V 0x1
+#define RTC_CNTL_BIAS_SLEEP_FOLW_8M_S 14
+
+#define RTC_CNTL_TIME_UPDATE_REG (DR_REG_RTCCNTL_BASE + 0xc)
+#define RTC_CNTL_TIME_UPDATE (BIT(31))
+#define RTC_CNTL_TIME_UPDATE_M (BIT(31))
+#define RTC_CNTL_TIME_UPDATE_V 0x1
+#define RTC_CNTL_TIME_UPDATE_S 31
+#define RTC_CNTL_TIME_VALID (BIT(30))
+#define RTC_CNTL_TIME_VALID_M (BIT(30))
+#define RTC_CNTL_TIME_VALID_V 0x1
+#define RTC_CNTL_TIME_VALID_S 30
+#define RTC_CNTL_TIME0_REG (DR_REG_RTCCNTL_BASE + 0x10)
+#define RTC_CNTL_TIME1_REG (DR_REG_RTCCNTL_BASE + 0x14)
+#define RTC_CNTL_TIME_HI 0x0000FFFF
+#define RTC_CNTL_TIME_HI_M ((RTC_CNTL_TIME_HI_V) << (RTC_CNTL_TIME_HI_S))
+#define RTC_CNTL_TIME_HI_V 0xFFFF
+#define RTC_CNTL_TIME_HI_S 0
+
+#define RTC_CNTL_STATE0_REG (DR_REG_RTCCNTL_BASE + 0x18)
+#define RTC_CNTL_SLP_WAKEUP (BIT(29))
+#define RTC_CNTL_SLP_WAKEUP_M (BIT(29))
+#define RTC_CNTL_SLP_WAKEUP_V 0x1
+#define RTC_CNTL_SLP_WAKEUP_S 29
+#define RTC_CNTL_ULP_CP_SLP_TIMER_EN (BIT(24))
+#define RTC_CNTL_ULP_CP_SLP_TIMER_EN_M (BIT(24))
+#define RTC_CNTL_ULP_CP_SLP_TIMER_EN_V 0x1
+#define RTC_CNTL_ULP_CP_SLP_TIMER_EN_S 24
+
+#define RTC_CNTL_TIMER2_REG (DR_REG_RTCCNTL_BASE + 0x20)
+#define RTC_CNTL_ULPCP_TOUCH_START_WAIT 0x000001FF
+#define RTC_CNTL_ULPCP_TOUCH_START_WAIT_M ((RTC_CNTL_ULPCP_TOUCH_START_WAIT_V) << (RTC_CNTL_ULPCP_TOUCH_START_WAIT_S))
+#define RTC_CNTL_ULPCP_TOUCH_START_WAIT_V 0x1FF
+#define RTC_CNTL_ULPCP_TOUCH_START_WAIT_S 15
+
+#define RTC_CNTL_WAKEUP_STATE_REG (DR_REG_RTCCNTL_BASE + 0x38)
+#define RTC_CNTL_WAKEUP_ENA 0x00000FFF
+#define RTC_CNTL_WAKEUP_ENA_M ((RTC_CNTL_WAKEUP_ENA_V) << (RTC_CNTL_WAKEUP_ENA_S))
+#define RTC_CNTL_WAKEUP_ENA_V 0xFFF
+#define RTC_CNTL_WAKEUP_ENA_S 20
+
+#define RTC_CNTL_INT_ENA_REG (DR_REG_RTCCNTL_BASE + 0x3c)
+#define RTC_CNTL_ULP_CP_INT_ENA (BIT(5))
+#define RTC_CNTL_ULP_CP_INT_ENA_M (BIT(5))
+#define RTC_CNTL_ULP_CP_INT_ENA_V 0x1
+#define RTC_CNTL_ULP_CP_INT_ENA_S 5
+#define RTC_CNTL_INT_RAW_REG (DR_REG_RTCCNTL_BASE + 0x40)
+#define RTC_CNTL_SAR_INT_RAW (BIT(5))
+#define RTC_CNTL_SAR_INT_RAW_M (BIT(5))
+#define RTC_CNTL_SAR_INT_RAW_V 0x1
+#define RTC_CNTL_SAR_INT_RAW_S 5
+#define RTC_CNTL_INT_ST_REG (DR_REG_RTCCNTL_BASE + 0x44)
+#define RTC_CNTL_SAR_INT_ST (BIT(5))
+#define RTC_CNTL_SAR_INT_ST_M (BIT(5))
+#define RTC_CNTL_SAR_INT_ST_V 0x1
+#define RTC_CNTL_SAR_INT_ST_S 5
+#define RTC_CNTL_INT_CLR_REG (DR_REG_RTCCNTL_BASE + 0x48)
+#define RTC_CNTL_SAR_INT_CLR (BIT(5))
+#define RTC_CNTL_SAR_INT_CLR_M (BIT(5))
+#define RTC_CNTL_SAR_INT_CLR_V 0x1
+#define RTC_CNTL_SAR_INT_CLR_S 5
+
+#define RTC_CNTL_EXT_WAKEUP_CONF_REG (DR_REG_RTCCNTL_BASE + 0x60)
+#define RTC_CNTL_EXT_WAKEUP1_LV (BIT(31))
+#define RTC_CNTL_EXT_WAKEUP1_LV_M (BIT(31))
+#define RTC_CNTL_EXT_WAKEUP1_LV_V 0x1
+#define RTC_CNTL_EXT_WAKEUP1_LV_S 31
+#define RTC_CNTL_EXT_WAKEUP0_LV (BIT(30))
+#define RTC_CNTL_EXT_WAKEUP0_LV_M (BIT(30))
+#define RTC_CNTL_EXT_WAKEUP0_LV_V 0x1
+#define RTC_CNTL_EXT_WAKEUP0_LV_S 30
+
+#define RTC_CNTL_PWC_REG (DR_REG_RTCCNTL_BASE + 0x80)
+#define RTC_CNTL_PD_EN (BIT(20))
+#define RTC_CNTL_PD_EN_M (BIT(20))
+#define RTC_CNTL_PD_EN_V 0x1
+#define RTC_CNTL_PD_EN_S 20
+#define RTC_CNTL_PWC_FORCE_PU (BIT(19))
+#define RTC_CNTL_PWC_FORCE_PU_M (BIT(19))
+#define RTC_CNTL_PWC_FORCE_PU_V 0x1
+#define RTC_CNTL_PWC_FORCE_PU_S 19
+#define RTC_CNTL_PWC_FORCE_PD (BIT(18))
+#define RTC_CNTL_PWC_FORCE_PD_M (BIT(18))
+#define RTC_CNTL_PWC_FORCE_PD_V 0x1
+#define RTC_CNTL_PWC_FORCE_PD_S 18
+
+#define RTC_CNTL_LOW_POWER_ST_REG (DR_REG_RTCCNTL_BASE + 0xc0)
+#define RTC_CNTL_RDY_FOR_WAKEUP (BIT(19))
+#define RTC_CNTL_RDY_FOR_WAKEUP_M (BIT(19))
+#define RTC_CNTL_RDY_FOR_WAKEUP_V 0x1
+#define RTC_CNTL_RDY_FOR_WAKEUP_S 19
+
+#define RTC_CNTL_HOLD_FORCE_REG (DR_REG_RTCCNTL_BASE + 0xc8)
+#define RTC_CNTL_X32N_HOLD_FORCE (BIT(17))
+#define RTC_CNTL_X32N_HOLD_FORCE_M (BIT(17))
+#define RTC_CNTL_X32N_HOLD_FORCE_V 0x1
+#define RTC_CNTL_X32N_HOLD_FORCE_S 17
+#define RTC_CNTL_X32P_HOLD_FORCE (BIT(16))
+#define RTC_CNTL_X32P_HOLD_FORCE_M (BIT(16))
+#define RTC_CNTL_X32P_HOLD_FORCE_V 0x1
+#define RTC_CNTL_X32P_HOLD_FORCE_S 16
+#define RTC_CNTL_TOUCH_PAD7_HOLD_FORCE (BIT(15))
+#define RTC_CNTL_TOUCH_PAD7_HOLD_FORCE_M (BIT(15))
+#define RTC_CNTL_TOUCH_PAD7_HOLD_FORCE_V 0x1
+#define RTC_CNTL_TOUCH_PAD7_HOLD_FORCE_S 15
+#define RTC_CNTL_TOUCH_PAD6_HOLD_FORCE (BIT(14))
+#define RTC_CNTL_TOUCH_PAD6_HOLD_FORCE_M (BIT(14))
+#define RTC_CNTL_TOUCH_PAD6_HOLD_FORCE_V 0x1
+#define RTC_CNTL_TOUCH_PAD6_HOLD_FORCE_S 14
+#define RTC_CNTL_TOUCH_PAD5_HOLD_FORCE (BIT(13))
+#define RTC_CNTL_TOUCH_PAD5_HOLD_FORCE_M (BIT(13))
+#define RTC_CNTL_TOUCH_PAD5_HOLD_FORCE_V 0x1
+#define RTC_CNTL_TOUCH_PAD5_HOLD_FORCE_S 13
+#define RTC_CNTL_TOUCH_PAD4_HOLD_FORCE (BIT(12))
+#define RTC_CNTL_TOUCH_PAD4_HOLD_FORCE_M (BIT(12))
+#define RTC_CNTL_TOUCH_PAD4_HOLD_FORCE_V 0x1
+#define RTC_CNTL_TOUCH_PAD4_HOLD_FORCE_S 12
+#define RTC_CNTL_TOUCH_PAD3_HOLD_FORCE (BIT(11))
+#define RTC_CNTL_TOUCH_PAD3_HOLD_FORCE_M (BIT(11))
+#define RTC_CNTL_TOUCH_PAD3_HOLD_FORCE_V 0x1
+#define RTC_CNTL_TOUCH_PAD3_HOLD_FORCE_S 11
+#define RTC_CNTL_TOUCH_PAD2_HOLD_FORCE (BIT(10))
+#define RTC_CNTL_TOUCH_PAD2_HOLD_FORCE_M (BIT(10))
+#define RTC_CNTL_TOUCH_PAD2_HOLD_FORCE_V 0x1
+#define RTC_CNTL_TOUCH_PAD2_HOLD_FORCE_S 10
+#define RTC_CNTL_TOUCH_PAD1_HOLD_FORCE (BIT(9))
+#define RTC_CNTL_TOUCH_PAD1_HOLD_FORCE_M (BIT(9))
+#define RTC_CNTL_TOUCH_PAD1_HOLD_FORCE_V 0x1
+#define RTC_CNTL_TOUCH_PAD1_HOLD_FORCE_S 9
+#define RTC_CNTL_TOUCH_PAD0_HOLD_FORCE (BIT(8))
+#define RTC_CNTL_TOUCH_PAD0_HOLD_FORCE_M (BIT(8))
+#define RTC_CNTL_TOUCH_PAD0_HOLD_FORCE_V 0x1
+#define RTC_CNTL_TOUCH_PAD0_HOLD_FORCE_S 8
+#define RTC_CNTL_SENSE4_HOLD_FORCE (BIT(7))
+#define RTC_CNTL_SENSE4_HOLD_FORCE_M (BIT(7))
+#define RTC_CNTL_SENSE4_HOLD_FORCE_V 0x1
+#define RTC_CNTL_SENSE4_HOLD_FORCE_S 7
+#define RTC_CNTL_SENSE3_HOLD_FORCE (BIT(6))
+#define RTC_CNTL_SENSE3_HOLD_FORCE_M (BIT(6))
+#define RTC_CNTL_SENSE3_HOLD_FORCE_V 0x1
+#define RTC_CNTL_SENSE3_HOLD_FORCE_S 6
+#define RTC_CNTL_SENSE2_HOLD_FORCE (BIT(5))
+#define RTC_CNTL_SENSE2_HOLD_FORCE_M (BIT(5))
+#define RTC_CNTL_SENSE2_HOLD_FORCE_V 0x1
+#define RTC_CNTL_SENSE2_HOLD_FORCE_S 5
+#define RTC_CNTL_SENSE1_HOLD_FORCE (BIT(4))
+#define RTC_CNTL_SENSE1_HOLD_FORCE_M (BIT(4))
+#define RTC_CNTL_SENSE1_HOLD_FORCE_V 0x1
+#define RTC_CNTL_SENSE1_HOLD_FORCE_S 4
+#define RTC_CNTL_PDAC2_HOLD_FORCE (BIT(3))
+#define RTC_CNTL_PDAC2_HOLD_FORCE_M (BIT(3))
+#define RTC_CNTL_PDAC2_HOLD_FORCE_V 0x1
+#define RTC_CNTL_PDAC2_HOLD_FORCE_S 3
+#define RTC_CNTL_PDAC1_HOLD_FORCE (BIT(2))
+#define RTC_CNTL_PDAC1_HOLD_FORCE_M (BIT(2))
+#define RTC_CNTL_PDAC1_HOLD_FORCE_V 0x1
+#define RTC_CNTL_PDAC1_HOLD_FORCE_S 2
+#define RTC_CNTL_ADC2_HOLD_FORCE (BIT(1))
+#define RTC_CNTL_ADC2_HOLD_FORCE_M (BIT(1))
+#define RTC_CNTL_ADC2_HOLD_FORCE_V 0x1
+#define RTC_CNTL_ADC2_HOLD_FORCE_S 1
+#define RTC_CNTL_ADC1_HOLD_FORCE (BIT(0))
+#define RTC_CNTL_ADC1_HOLD_FORCE_M (BIT(0))
+#define RTC_CNTL_ADC1_HOLD_FORCE_V 0x1
+#define RTC_CNTL_ADC1_HOLD_FORCE_S 0
+
+#define RTC_CNTL_EXT_WAKEUP1_REG (DR_REG_RTCCNTL_BASE + 0xcc)
+#define RTC_CNTL_EXT_WAKEUP1_STATUS_CLR (BIT(18))
+#define RTC_CNTL_EXT_WAKEUP1_STATUS_CLR_M (BIT(18))
+#define RTC_CNTL_EXT_WAKEUP1_STATUS_CLR_V 0x1
+#define RTC_CNTL_EXT_WAKEUP1_STATUS_CLR_S 18
+#define RTC_CNTL_EXT_WAKEUP1_SEL 0x0003FFFF
+#define RTC_CNTL_EXT_WAKEUP1_SEL_M ((RTC_CNTL_EXT_WAKEUP1_SEL_V) << (RTC_CNTL_EXT_WAKEUP1_SEL_S))
+#define RTC_CNTL_EXT_WAKEUP1_SEL_V 0x3FFFF
+#define RTC_CNTL_EXT_WAKEUP1_SEL_S 0
+#define RTC_CNTL_EXT_WAKEUP1_STATUS_REG (DR_REG_RTCCNTL_BASE + 0xd0)
+#define RTC_CNTL_EXT_WAKEUP1_STATUS 0x0003FFFF
+#define RTC_CNTL_EXT_WAKEUP1_STATUS_M ((RTC_CNTL_EXT_WAKEUP1_STATUS_V) << (RTC_CNTL_EXT_WAKEUP1_STATUS_S))
+#define RTC_CNTL_EXT_WAKEUP1_STATUS_V 0x3FFFF
+#define RTC_CNTL_EXT_WAKEUP1_STATUS_S 0
+
+#endif /* HULP_HOST_RTC_CNTL_REG_H */
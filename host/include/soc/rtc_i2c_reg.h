@@ -0,0 +1,68 @@
+#ifndef HULP_HOST_RTC_I2C_REG_H
+#define HULP_HOST_RTC_I2C_REG_H
+
+#include "soc/soc.h"
+
+#define RTC_I2C_SCL_LOW_PERIOD_REG (DR_REG_RTC_I2C_BASE + 0x000)
+#define RTC_I2C_SCL_LOW_PERIOD 0x0007FFFF
+#define RTC_I2C_SCL_LOW_PERIOD_M ((RTC_I2C_SCL_LOW_PERIOD_V) << (RTC_I2C_SCL_LOW_PERIOD_S))
+#define RTC_I2C_SCL_LOW_PERIOD_V 0x7FFFF
+#define RTC_I2C_SCL_LOW_PERIOD_S 0
+
+#define RTC_I2C_CTRL_REG (DR_REG_RTC_I2C_BASE + 0x004)
+#define RTC_I2C_RX_LSB_FIRST (BIT(7))
+#define RTC_I2C_RX_LSB_FIRST_M (BIT(7))
+#define RTC_I2C_RX_LSB_FIRST_V 0x1
+#define RTC_I2C_RX_LSB_FIRST_S 7
+#define RTC_I2C_TX_LSB_FIRST (BIT(6))
+#define RTC_I2C_TX_LSB_FIRST_M (BIT(6))
+#define RTC_I2C_TX_LSB_FIRST_V 0x1
+#define RTC_I2C_TX_LSB_FIRST_S 6
+#define RTC_I2C_TRANS_START (BIT(5))
+#define RTC_I2C_TRANS_START_M (BIT(5))
+#define RTC_I2C_TRANS_START_V 0x1
+#define RTC_I2C_TRANS_START_S 5
+#define RTC_I2C_MS_MODE (BIT(4))
+#define RTC_I2C_MS_MODE_M (BIT(4))
+#define RTC_I2C_MS_MODE_V 0x1
+#define RTC_I2C_MS_MODE_S 4
+#define RTC_I2C_SCL_FORCE_OUT (BIT(1))
+#define RTC_I2C_SCL_FORCE_OUT_M (BIT(1))
+#define RTC_I2C_SCL_FORCE_OUT_V 0x1
+#define RTC_I2C_SCL_FORCE_OUT_S 1
+#define RTC_I2C_SDA_FORCE_OUT (BIT(0))
+#define RTC_I2C_SDA_FORCE_OUT_M (BIT(0))
+#define RTC_I2C_SDA_FORCE_OUT_V 0x1
+#define RTC_I2C_SDA_FORCE_OUT_S 0
+
+#define RTC_I2C_TIMEOUT_REG (DR_REG_RTC_I2C_BASE + 0x00c)
+#define RTC_I2C_TIMEOUT 0x000FFFFF
+#define RTC_I2C_TIMEOUT_M ((RTC_I2C_TIMEOUT_V) << (RTC_I2C_TIMEOUT_S))
+#define RTC_I2C_TIMEOUT_V 0xFFFFF
+#define RTC_I2C_TIMEOUT_S 0
+
+#define RTC_I2C_SDA_DUTY_REG (DR_REG_RTC_I2C_BASE + 0x030)
+#define RTC_I2C_SDA_DUTY 0x000FFFFF
+#define RTC_I2C_SDA_DUTY_M ((RTC_I2C_SDA_DUTY_V) << (RTC_I2C_SDA_DUTY_S))
+#define RTC_I2C_SDA_DUTY_V 0xFFFFF
+#define RTC_I2C_SDA_DUTY_S 0
+
+#define RTC_I2C_SCL_HIGH_PERIOD_REG (DR_REG_RTC_I2C_BASE + 0x038)
+#define RTC_I2C_SCL_HIGH_PERIOD 0x000FFFFF
+#define RTC_I2C_SCL_HIGH_PERIOD_M ((RTC_I2C_SCL_HIGH_PERIOD_V) << (RTC_I2C_SCL_HIGH_PERIOD_S))
+#define RTC_I2C_SCL_HIGH_PERIOD_V 0xFFFFF
+#define RTC_I2C_SCL_HIGH_PERIOD_S 0
+
+#define RTC_I2C_SCL_START_PERIOD_REG (DR_REG_RTC_I2C_BASE + 0x040)
+#define RTC_I2C_SCL_START_PERIOD 0x000FFFFF
+#define RTC_I2C_SCL_START_PERIOD_M ((RTC_I2C_SCL_START_PERIOD_V) << (RTC_I2C_SCL_START_PERIOD_S))
+#define RTC_I2C_SCL_START_PERIOD_V 0xFFFFF
+#define RTC_I2C_SCL_START_PERIOD_S 0
+
+#define RTC_I2C_SCL_STOP_PERIOD_REG (DR_REG_RTC_I2C_BASE + 0x044)
+#define RTC_I2C_SCL_STOP_PERIOD 0x000FFFFF
+#define RTC_I2C_SCL_STOP_PERIOD_M ((RTC_I2C_SCL_STOP_PERIOD_V) << (RTC_I2C_SCL_STOP_PERIOD_S))
+#define RTC_I2C_SCL_STOP_PERIOD_V 0xFFFFF
+#define RTC_I2C_SCL_STOP_PERIOD_S 0
+
+#endif /* HULP_HOST_RTC_I2C_REG_H */
@@ -0,0 +1,41 @@
+#ifndef HULP_HOST_RTC_IO_CHANNEL_H
+#define HULP_HOST_RTC_IO_CHANNEL_H
+
+#define RTCIO_GPIO36_CHANNEL 0
+#define RTCIO_CHANNEL_0_GPIO_NUM 36
+#define RTCIO_GPIO37_CHANNEL 1
+#define RTCIO_CHANNEL_1_GPIO_NUM 37
+#define RTCIO_GPIO38_CHANNEL 2
+#define RTCIO_CHANNEL_2_GPIO_NUM 38
+#define RTCIO_GPIO39_CHANNEL 3
+#define RTCIO_CHANNEL_3_GPIO_NUM 39
+#define RTCIO_GPIO34_CHANNEL 4
+#define RTCIO_CHANNEL_4_GPIO_NUM 34
+#define RTCIO_GPIO35_CHANNEL 5
+#define RTCIO_CHANNEL_5_GPIO_NUM 35
+#define RTCIO_GPIO25_CHANNEL 6
+#define RTCIO_CHANNEL_6_GPIO_NUM 25
+#define RTCIO_GPIO26_CHANNEL 7
+#define RTCIO_CHANNEL_7_GPIO_NUM 26
+#define RTCIO_GPIO33_CHANNEL 8
+#define RTCIO_CHANNEL_8_GPIO_NUM 33
+#define RTCIO_GPIO32_CHANNEL 9
+#define RTCIO_CHANNEL_9_GPIO_NUM 32
+#define RTCIO_GPIO4_CHANNEL 10
+#define RTCIO_CHANNEL_10_GPIO_NUM 4
+#define RTCIO_GPIO0_CHANNEL 11
+#define RTCIO_CHANNEL_11_GPIO_NUM 0
+#define RTCIO_GPIO2_CHANNEL 12
+#define RTCIO_CHANNEL_12_GPIO_NUM 2
+#define RTCIO_GPIO15_CHANNEL 13
+#define RTCIO_CHANNEL_13_GPIO_NUM 15
+#define RTCIO_GPIO13_CHANNEL 14
+#define RTCIO_CHANNEL_14_GPIO_NUM 13
+#define RTCIO_GPIO12_CHANNEL 15
+#define RTCIO_CHANNEL_15_GPIO_NUM 12
+#define RTCIO_GPIO14_CHANNEL 16
+#define RTCIO_CHANNEL_16_GPIO_NUM 14
+#define RTCIO_GPIO27_CHANNEL 17
+#define RTCIO_CHANNEL_17_GPIO_NUM 27
+
+#endif /* HULP_HOST_RTC_IO_CHANNEL_H */
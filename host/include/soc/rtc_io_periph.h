@@ -0,0 +1,39 @@
+#ifndef HULP_HOST_RTC_IO_PERIPH_H
+#define HULP_HOST_RTC_IO_PERIPH_H
+
+#include <stdint.h>
+#include "soc/soc_caps.h"
+#include "soc/rtc_io_reg.h"
+#include "soc/rtc_io_channel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pad registers and fields of an RTCIO, as per ESP-IDF's rtc_io_desc_t (v4.x).
+ */
+typedef struct {
+    uint32_t reg;           /*!< Register of RTC pad, or 0 if not an RTC GPIO */
+    uint32_t mux;           /*!< Bit mask for selecting digital pad or RTC pad */
+    uint32_t func;          /*!< Shift of pad function (FUN_SEL) field */
+    uint32_t ie;            /*!< Mask of input enable */
+    uint32_t pullup;        /*!< Mask of pullup enable */
+    uint32_t pulldown;      /*!< Mask of pulldown enable */
+    uint32_t slpsel;        /*!< If slpsel bit is set, slpie will be used as pad input enabled signal in sleep mode */
+    uint32_t slpie;         /*!< Mask of input enable in sleep mode */
+    uint32_t slpoe;         /*!< Mask of output enable in sleep mode */
+    uint32_t hold;          /*!< Mask of hold enable */
+    uint32_t hold_force;    /*!< Mask of hold_force bit for RTC IO in RTC_CNTL_HOLD_FORCE_REG */
+    uint32_t drv_v;         /*!< Mask of drive capability */
+    uint32_t drv_s;         /*!< Offset of drive capability */
+    int rtc_num;            /*!< GPIO number (corresponds to RTC pad) */
+} rtc_io_desc_t;
+
+extern const rtc_io_desc_t rtc_io_desc[SOC_RTCIO_PIN_COUNT];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_RTC_IO_PERIPH_H */
@@ -0,0 +1,830 @@
+#ifndef HULP_HOST_RTC_IO_REG_H
+#define HULP_HOST_RTC_IO_REG_H
+
+#include "soc/soc.h"
+
+#define RTC_GPIO_OUT_REG (DR_REG_RTCIO_BASE + 0x0)
+#define RTC_GPIO_OUT_DATA 0x0003FFFF
+#define RTC_GPIO_OUT_DATA_M ((RTC_GPIO_OUT_DATA_V) << (RTC_GPIO_OUT_DATA_S))
+#define RTC_GPIO_OUT_DATA_V 0x3FFFF
+#define RTC_GPIO_OUT_DATA_S 14
+#define RTC_GPIO_OUT_W1TS_REG (DR_REG_RTCIO_BASE + 0x4)
+#define RTC_GPIO_OUT_DATA_W1TS 0x0003FFFF
+#define RTC_GPIO_OUT_DATA_W1TS_M ((RTC_GPIO_OUT_DATA_W1TS_V) << (RTC_GPIO_OUT_DATA_W1TS_S))
+#define RTC_GPIO_OUT_DATA_W1TS_V 0x3FFFF
+#define RTC_GPIO_OUT_DATA_W1TS_S 14
+#define RTC_GPIO_OUT_W1TC_REG (DR_REG_RTCIO_BASE + 0x8)
+#define RTC_GPIO_OUT_DATA_W1TC 0x0003FFFF
+#define RTC_GPIO_OUT_DATA_W1TC_M ((RTC_GPIO_OUT_DATA_W1TC_V) << (RTC_GPIO_OUT_DATA_W1TC_S))
+#define RTC_GPIO_OUT_DATA_W1TC_V 0x3FFFF
+#define RTC_GPIO_OUT_DATA_W1TC_S 14
+#define RTC_GPIO_ENABLE_REG (DR_REG_RTCIO_BASE + 0xc)
+#define RTC_GPIO_ENABLE 0x0003FFFF
+#define RTC_GPIO_ENABLE_M ((RTC_GPIO_ENABLE_V) << (RTC_GPIO_ENABLE_S))
+#define RTC_GPIO_ENABLE_V 0x3FFFF
+#define RTC_GPIO_ENABLE_S 14
+#define RTC_GPIO_ENABLE_W1TS_REG (DR_REG_RTCIO_BASE + 0x10)
+#define RTC_GPIO_ENABLE_W1TS 0x0003FFFF
+#define RTC_GPIO_ENABLE_W1TS_M ((RTC_GPIO_ENABLE_W1TS_V) << (RTC_GPIO_ENABLE_W1TS_S))
+#define RTC_GPIO_ENABLE_W1TS_V 0x3FFFF
+#define RTC_GPIO_ENABLE_W1TS_S 14
+#define RTC_GPIO_ENABLE_W1TC_REG (DR_REG_RTCIO_BASE + 0x14)
+#define RTC_GPIO_ENABLE_W1TC 0x0003FFFF
+#define RTC_GPIO_ENABLE_W1TC_M ((RTC_GPIO_ENABLE_W1TC_V) << (RTC_GPIO_ENABLE_W1TC_S))
+#define RTC_GPIO_ENABLE_W1TC_V 0x3FFFF
+#define RTC_GPIO_ENABLE_W1TC_S 14
+#define RTC_GPIO_STATUS_REG (DR_REG_RTCIO_BASE + 0x18)
+#define RTC_GPIO_STATUS_INT 0x0003FFFF
+#define RTC_GPIO_STATUS_INT_M ((RTC_GPIO_STATUS_INT_V) << (RTC_GPIO_STATUS_INT_S))
+#define RTC_GPIO_STATUS_INT_V 0x3FFFF
+#define RTC_GPIO_STATUS_INT_S 14
+#define RTC_GPIO_STATUS_W1TS_REG (DR_REG_RTCIO_BASE + 0x1c)
+#define RTC_GPIO_STATUS_INT_W1TS 0x0003FFFF
+#define RTC_GPIO_STATUS_INT_W1TS_M ((RTC_GPIO_STATUS_INT_W1TS_V) << (RTC_GPIO_STATUS_INT_W1TS_S))
+#define RTC_GPIO_STATUS_INT_W1TS_V 0x3FFFF
+#define RTC_GPIO_STATUS_INT_W1TS_S 14
+#define RTC_GPIO_STATUS_W1TC_REG (DR_REG_RTCIO_BASE + 0x20)
+#define RTC_GPIO_STATUS_INT_W1TC 0x0003FFFF
+#define RTC_GPIO_STATUS_INT_W1TC_M ((RTC_GPIO_STATUS_INT_W1TC_V) << (RTC_GPIO_STATUS_INT_W1TC_S))
+#define RTC_GPIO_STATUS_INT_W1TC_V 0x3FFFF
+#define RTC_GPIO_STATUS_INT_W1TC_S 14
+#define RTC_GPIO_IN_REG (DR_REG_RTCIO_BASE + 0x24)
+#define RTC_GPIO_IN_NEXT 0x0003FFFF
+#define RTC_GPIO_IN_NEXT_M ((RTC_GPIO_IN_NEXT_V) << (RTC_GPIO_IN_NEXT_S))
+#define RTC_GPIO_IN_NEXT_V 0x3FFFF
+#define RTC_GPIO_IN_NEXT_S 14
+#define RTC_GPIO_PIN0_REG (DR_REG_RTCIO_BASE + 0x28)
+#define RTC_GPIO_PIN0_WAKEUP_ENABLE (BIT(10))
+#define RTC_GPIO_PIN0_WAKEUP_ENABLE_M (BIT(10))
+#define RTC_GPIO_PIN0_WAKEUP_ENABLE_V 0x1
+#define RTC_GPIO_PIN0_WAKEUP_ENABLE_S 10
+#define RTC_GPIO_PIN0_INT_TYPE 0x00000007
+#define RTC_GPIO_PIN0_INT_TYPE_M ((RTC_GPIO_PIN0_INT_TYPE_V) << (RTC_GPIO_PIN0_INT_TYPE_S))
+#define RTC_GPIO_PIN0_INT_TYPE_V 0x7
+#define RTC_GPIO_PIN0_INT_TYPE_S 7
+#define RTC_GPIO_PIN0_PAD_DRIVER (BIT(2))
+#define RTC_GPIO_PIN0_PAD_DRIVER_M (BIT(2))
+#define RTC_GPIO_PIN0_PAD_DRIVER_V 0x1
+#define RTC_GPIO_PIN0_PAD_DRIVER_S 2
+
+#define RTC_IO_HALL_SENS_REG (DR_REG_RTCIO_BASE + 0x78)
+#define RTC_IO_XPD_HALL (BIT(31))
+#define RTC_IO_XPD_HALL_M (BIT(31))
+#define RTC_IO_XPD_HALL_V 0x1
+#define RTC_IO_XPD_HALL_S 31
+#define RTC_IO_HALL_PHASE (BIT(30))
+#define RTC_IO_HALL_PHASE_M (BIT(30))
+#define RTC_IO_HALL_PHASE_V 0x1
+#define RTC_IO_HALL_PHASE_S 30
+
+#define RTC_IO_SENSOR_PADS_REG (DR_REG_RTCIO_BASE + 0x7c)
+#define RTC_IO_SENSE1_HOLD (BIT(31))
+#define RTC_IO_SENSE1_HOLD_M (BIT(31))
+#define RTC_IO_SENSE1_HOLD_V 0x1
+#define RTC_IO_SENSE1_HOLD_S 31
+#define RTC_IO_SENSE2_HOLD (BIT(30))
+#define RTC_IO_SENSE2_HOLD_M (BIT(30))
+#define RTC_IO_SENSE2_HOLD_V 0x1
+#define RTC_IO_SENSE2_HOLD_S 30
+#define RTC_IO_SENSE3_HOLD (BIT(29))
+#define RTC_IO_SENSE3_HOLD_M (BIT(29))
+#define RTC_IO_SENSE3_HOLD_V 0x1
+#define RTC_IO_SENSE3_HOLD_S 29
+#define RTC_IO_SENSE4_HOLD (BIT(28))
+#define RTC_IO_SENSE4_HOLD_M (BIT(28))
+#define RTC_IO_SENSE4_HOLD_V 0x1
+#define RTC_IO_SENSE4_HOLD_S 28
+#define RTC_IO_SENSE1_MUX_SEL (BIT(27))
+#define RTC_IO_SENSE1_MUX_SEL_M (BIT(27))
+#define RTC_IO_SENSE1_MUX_SEL_V 0x1
+#define RTC_IO_SENSE1_MUX_SEL_S 27
+#define RTC_IO_SENSE2_MUX_SEL (BIT(26))
+#define RTC_IO_SENSE2_MUX_SEL_M (BIT(26))
+#define RTC_IO_SENSE2_MUX_SEL_V 0x1
+#define RTC_IO_SENSE2_MUX_SEL_S 26
+#define RTC_IO_SENSE3_MUX_SEL (BIT(25))
+#define RTC_IO_SENSE3_MUX_SEL_M (BIT(25))
+#define RTC_IO_SENSE3_MUX_SEL_V 0x1
+#define RTC_IO_SENSE3_MUX_SEL_S 25
+#define RTC_IO_SENSE4_MUX_SEL (BIT(24))
+#define RTC_IO_SENSE4_MUX_SEL_M (BIT(24))
+#define RTC_IO_SENSE4_MUX_SEL_V 0x1
+#define RTC_IO_SENSE4_MUX_SEL_S 24
+#define RTC_IO_SENSE1_FUN_SEL 0x00000003
+#define RTC_IO_SENSE1_FUN_SEL_M ((RTC_IO_SENSE1_FUN_SEL_V) << (RTC_IO_SENSE1_FUN_SEL_S))
+#define RTC_IO_SENSE1_FUN_SEL_V 0x3
+#define RTC_IO_SENSE1_FUN_SEL_S 22
+#define RTC_IO_SENSE1_SLP_SEL (BIT(21))
+#define RTC_IO_SENSE1_SLP_SEL_M (BIT(21))
+#define RTC_IO_SENSE1_SLP_SEL_V 0x1
+#define RTC_IO_SENSE1_SLP_SEL_S 21
+#define RTC_IO_SENSE1_SLP_IE (BIT(20))
+#define RTC_IO_SENSE1_SLP_IE_M (BIT(20))
+#define RTC_IO_SENSE1_SLP_IE_V 0x1
+#define RTC_IO_SENSE1_SLP_IE_S 20
+#define RTC_IO_SENSE1_FUN_IE (BIT(19))
+#define RTC_IO_SENSE1_FUN_IE_M (BIT(19))
+#define RTC_IO_SENSE1_FUN_IE_V 0x1
+#define RTC_IO_SENSE1_FUN_IE_S 19
+#define RTC_IO_SENSE2_FUN_SEL 0x00000003
+#define RTC_IO_SENSE2_FUN_SEL_M ((RTC_IO_SENSE2_FUN_SEL_V) << (RTC_IO_SENSE2_FUN_SEL_S))
+#define RTC_IO_SENSE2_FUN_SEL_V 0x3
+#define RTC_IO_SENSE2_FUN_SEL_S 17
+#define RTC_IO_SENSE2_SLP_SEL (BIT(16))
+#define RTC_IO_SENSE2_SLP_SEL_M (BIT(16))
+#define RTC_IO_SENSE2_SLP_SEL_V 0x1
+#define RTC_IO_SENSE2_SLP_SEL_S 16
+#define RTC_IO_SENSE2_SLP_IE (BIT(15))
+#define RTC_IO_SENSE2_SLP_IE_M (BIT(15))
+#define RTC_IO_SENSE2_SLP_IE_V 0x1
+#define RTC_IO_SENSE2_SLP_IE_S 15
+#define RTC_IO_SENSE2_FUN_IE (BIT(14))
+#define RTC_IO_SENSE2_FUN_IE_M (BIT(14))
+#define RTC_IO_SENSE2_FUN_IE_V 0x1
+#define RTC_IO_SENSE2_FUN_IE_S 14
+#define RTC_IO_SENSE3_FUN_SEL 0x00000003
+#define RTC_IO_SENSE3_FUN_SEL_M ((RTC_IO_SENSE3_FUN_SEL_V) << (RTC_IO_SENSE3_FUN_SEL_S))
+#define RTC_IO_SENSE3_FUN_SEL_V 0x3
+#define RTC_IO_SENSE3_FUN_SEL_S 12
+#define RTC_IO_SENSE3_SLP_SEL (BIT(11))
+#define RTC_IO_SENSE3_SLP_SEL_M (BIT(11))
+#define RTC_IO_SENSE3_SLP_SEL_V 0x1
+#define RTC_IO_SENSE3_SLP_SEL_S 11
+#define RTC_IO_SENSE3_SLP_IE (BIT(10))
+#define RTC_IO_SENSE3_SLP_IE_M (BIT(10))
+#define RTC_IO_SENSE3_SLP_IE_V 0x1
+#define RTC_IO_SENSE3_SLP_IE_S 10
+#define RTC_IO_SENSE3_FUN_IE (BIT(9))
+#define RTC_IO_SENSE3_FUN_IE_M (BIT(9))
+#define RTC_IO_SENSE3_FUN_IE_V 0x1
+#define RTC_IO_SENSE3_FUN_IE_S 9
+#define RTC_IO_SENSE4_FUN_SEL 0x00000003
+#define RTC_IO_SENSE4_FUN_SEL_M ((RTC_IO_SENSE4_FUN_SEL_V) << (RTC_IO_SENSE4_FUN_SEL_S))
+#define RTC_IO_SENSE4_FUN_SEL_V 0x3
+#define RTC_IO_SENSE4_FUN_SEL_S 7
+#define RTC_IO_SENSE4_SLP_SEL (BIT(6))
+#define RTC_IO_SENSE4_SLP_SEL_M (BIT(6))
+#define RTC_IO_SENSE4_SLP_SEL_V 0x1
+#define RTC_IO_SENSE4_SLP_SEL_S 6
+#define RTC_IO_SENSE4_SLP_IE (BIT(5))
+#define RTC_IO_SENSE4_SLP_IE_M (BIT(5))
+#define RTC_IO_SENSE4_SLP_IE_V 0x1
+#define RTC_IO_SENSE4_SLP_IE_S 5
+#define RTC_IO_SENSE4_FUN_IE (BIT(4))
+#define RTC_IO_SENSE4_FUN_IE_M (BIT(4))
+#define RTC_IO_SENSE4_FUN_IE_V 0x1
+#define RTC_IO_SENSE4_FUN_IE_S 4
+
+#define RTC_IO_ADC_PAD_REG (DR_REG_RTCIO_BASE + 0x80)
+#define RTC_IO_ADC1_HOLD (BIT(31))
+#define RTC_IO_ADC1_HOLD_M (BIT(31))
+#define RTC_IO_ADC1_HOLD_V 0x1
+#define RTC_IO_ADC1_HOLD_S 31
+#define RTC_IO_ADC2_HOLD (BIT(30))
+#define RTC_IO_ADC2_HOLD_M (BIT(30))
+#define RTC_IO_ADC2_HOLD_V 0x1
+#define RTC_IO_ADC2_HOLD_S 30
+#define RTC_IO_ADC1_MUX_SEL (BIT(29))
+#define RTC_IO_ADC1_MUX_SEL_M (BIT(29))
+#define RTC_IO_ADC1_MUX_SEL_V 0x1
+#define RTC_IO_ADC1_MUX_SEL_S 29
+#define RTC_IO_ADC2_MUX_SEL (BIT(28))
+#define RTC_IO_ADC2_MUX_SEL_M (BIT(28))
+#define RTC_IO_ADC2_MUX_SEL_V 0x1
+#define RTC_IO_ADC2_MUX_SEL_S 28
+#define RTC_IO_ADC1_FUN_SEL 0x00000003
+#define RTC_IO_ADC1_FUN_SEL_M ((RTC_IO_ADC1_FUN_SEL_V) << (RTC_IO_ADC1_FUN_SEL_S))
+#define RTC_IO_ADC1_FUN_SEL_V 0x3
+#define RTC_IO_ADC1_FUN_SEL_S 26
+#define RTC_IO_ADC1_SLP_SEL (BIT(25))
+#define RTC_IO_ADC1_SLP_SEL_M (BIT(25))
+#define RTC_IO_ADC1_SLP_SEL_V 0x1
+#define RTC_IO_ADC1_SLP_SEL_S 25
+#define RTC_IO_ADC1_SLP_IE (BIT(24))
+#define RTC_IO_ADC1_SLP_IE_M (BIT(24))
+#define RTC_IO_ADC1_SLP_IE_V 0x1
+#define RTC_IO_ADC1_SLP_IE_S 24
+#define RTC_IO_ADC1_FUN_IE (BIT(23))
+#define RTC_IO_ADC1_FUN_IE_M (BIT(23))
+#define RTC_IO_ADC1_FUN_IE_V 0x1
+#define RTC_IO_ADC1_FUN_IE_S 23
+#define RTC_IO_ADC2_FUN_SEL 0x00000003
+#define RTC_IO_ADC2_FUN_SEL_M ((RTC_IO_ADC2_FUN_SEL_V) << (RTC_IO_ADC2_FUN_SEL_S))
+#define RTC_IO_ADC2_FUN_SEL_V 0x3
+#define RTC_IO_ADC2_FUN_SEL_S 21
+#define RTC_IO_ADC2_SLP_SEL (BIT(20))
+#define RTC_IO_ADC2_SLP_SEL_M (BIT(20))
+#define RTC_IO_ADC2_SLP_SEL_V 0x1
+#define RTC_IO_ADC2_SLP_SEL_S 20
+#define RTC_IO_ADC2_SLP_IE (BIT(19))
+#define RTC_IO_ADC2_SLP_IE_M (BIT(19))
+#define RTC_IO_ADC2_SLP_IE_V 0x1
+#define RTC_IO_ADC2_SLP_IE_S 19
+#define RTC_IO_ADC2_FUN_IE (BIT(18))
+#define RTC_IO_ADC2_FUN_IE_M (BIT(18))
+#define RTC_IO_ADC2_FUN_IE_V 0x1
+#define RTC_IO_ADC2_FUN_IE_S 18
+
+#define RTC_IO_PAD_DAC1_REG (DR_REG_RTCIO_BASE + 0x84)
+#define RTC_IO_PDAC1_HOLD (BIT(31))
+#define RTC_IO_PDAC1_HOLD_M (BIT(31))
+#define RTC_IO_PDAC1_HOLD_V 0x1
+#define RTC_IO_PDAC1_HOLD_S 31
+#define RTC_IO_PDAC1_DRV 0x00000003
+#define RTC_IO_PDAC1_DRV_M ((RTC_IO_PDAC1_DRV_V) << (RTC_IO_PDAC1_DRV_S))
+#define RTC_IO_PDAC1_DRV_V 0x3
+#define RTC_IO_PDAC1_DRV_S 29
+#define RTC_IO_PDAC1_RDE (BIT(28))
+#define RTC_IO_PDAC1_RDE_M (BIT(28))
+#define RTC_IO_PDAC1_RDE_V 0x1
+#define RTC_IO_PDAC1_RDE_S 28
+#define RTC_IO_PDAC1_RUE (BIT(27))
+#define RTC_IO_PDAC1_RUE_M (BIT(27))
+#define RTC_IO_PDAC1_RUE_V 0x1
+#define RTC_IO_PDAC1_RUE_S 27
+#define RTC_IO_PDAC1_MUX_SEL (BIT(17))
+#define RTC_IO_PDAC1_MUX_SEL_M (BIT(17))
+#define RTC_IO_PDAC1_MUX_SEL_V 0x1
+#define RTC_IO_PDAC1_MUX_SEL_S 17
+#define RTC_IO_PDAC1_FUN_SEL 0x00000003
+#define RTC_IO_PDAC1_FUN_SEL_M ((RTC_IO_PDAC1_FUN_SEL_V) << (RTC_IO_PDAC1_FUN_SEL_S))
+#define RTC_IO_PDAC1_FUN_SEL_V 0x3
+#define RTC_IO_PDAC1_FUN_SEL_S 15
+#define RTC_IO_PDAC1_SLP_SEL (BIT(14))
+#define RTC_IO_PDAC1_SLP_SEL_M (BIT(14))
+#define RTC_IO_PDAC1_SLP_SEL_V 0x1
+#define RTC_IO_PDAC1_SLP_SEL_S 14
+#define RTC_IO_PDAC1_SLP_IE (BIT(13))
+#define RTC_IO_PDAC1_SLP_IE_M (BIT(13))
+#define RTC_IO_PDAC1_SLP_IE_V 0x1
+#define RTC_IO_PDAC1_SLP_IE_S 13
+#define RTC_IO_PDAC1_SLP_OE (BIT(12))
+#define RTC_IO_PDAC1_SLP_OE_M (BIT(12))
+#define RTC_IO_PDAC1_SLP_OE_V 0x1
+#define RTC_IO_PDAC1_SLP_OE_S 12
+#define RTC_IO_PDAC1_FUN_IE (BIT(11))
+#define RTC_IO_PDAC1_FUN_IE_M (BIT(11))
+#define RTC_IO_PDAC1_FUN_IE_V 0x1
+#define RTC_IO_PDAC1_FUN_IE_S 11
+
+#define RTC_IO_PAD_DAC2_REG (DR_REG_RTCIO_BASE + 0x88)
+#define RTC_IO_PDAC2_HOLD (BIT(31))
+#define RTC_IO_PDAC2_HOLD_M (BIT(31))
+#define RTC_IO_PDAC2_HOLD_V 0x1
+#define RTC_IO_PDAC2_HOLD_S 31
+#define RTC_IO_PDAC2_DRV 0x00000003
+#define RTC_IO_PDAC2_DRV_M ((RTC_IO_PDAC2_DRV_V) << (RTC_IO_PDAC2_DRV_S))
+#define RTC_IO_PDAC2_DRV_V 0x3
+#define RTC_IO_PDAC2_DRV_S 29
+#define RTC_IO_PDAC2_RDE (BIT(28))
+#define RTC_IO_PDAC2_RDE_M (BIT(28))
+#define RTC_IO_PDAC2_RDE_V 0x1
+#define RTC_IO_PDAC2_RDE_S 28
+#define RTC_IO_PDAC2_RUE (BIT(27))
+#define RTC_IO_PDAC2_RUE_M (BIT(27))
+#define RTC_IO_PDAC2_RUE_V 0x1
+#define RTC_IO_PDAC2_RUE_S 27
+#define RTC_IO_PDAC2_MUX_SEL (BIT(17))
+#define RTC_IO_PDAC2_MUX_SEL_M (BIT(17))
+#define RTC_IO_PDAC2_MUX_SEL_V 0x1
+#define RTC_IO_PDAC2_MUX_SEL_S 17
+#define RTC_IO_PDAC2_FUN_SEL 0x00000003
+#define RTC_IO_PDAC2_FUN_SEL_M ((RTC_IO_PDAC2_FUN_SEL_V) << (RTC_IO_PDAC2_FUN_SEL_S))
+#define RTC_IO_PDAC2_FUN_SEL_V 0x3
+#define RTC_IO_PDAC2_FUN_SEL_S 15
+#define RTC_IO_PDAC2_SLP_SEL (BIT(14))
+#define RTC_IO_PDAC2_SLP_SEL_M (BIT(14))
+#define RTC_IO_PDAC2_SLP_SEL_V 0x1
+#define RTC_IO_PDAC2_SLP_SEL_S 14
+#define RTC_IO_PDAC2_SLP_IE (BIT(13))
+#define RTC_IO_PDAC2_SLP_IE_M (BIT(13))
+#define RTC_IO_PDAC2_SLP_IE_V 0x1
+#define RTC_IO_PDAC2_SLP_IE_S 13
+#define RTC_IO_PDAC2_SLP_OE (BIT(12))
+#define RTC_IO_PDAC2_SLP_OE_M (BIT(12))
+#define RTC_IO_PDAC2_SLP_OE_V 0x1
+#define RTC_IO_PDAC2_SLP_OE_S 12
+#define RTC_IO_PDAC2_FUN_IE (BIT(11))
+#define RTC_IO_PDAC2_FUN_IE_M (BIT(11))
+#define RTC_IO_PDAC2_FUN_IE_V 0x1
+#define RTC_IO_PDAC2_FUN_IE_S 11
+
+#define RTC_IO_XTAL_32K_PAD_REG (DR_REG_RTCIO_BASE + 0x8c)
+#define RTC_IO_X32N_DRV 0x00000003
+#define RTC_IO_X32N_DRV_M ((RTC_IO_X32N_DRV_V) << (RTC_IO_X32N_DRV_S))
+#define RTC_IO_X32N_DRV_V 0x3
+#define RTC_IO_X32N_DRV_S 30
+#define RTC_IO_X32N_HOLD (BIT(29))
+#define RTC_IO_X32N_HOLD_M (BIT(29))
+#define RTC_IO_X32N_HOLD_V 0x1
+#define RTC_IO_X32N_HOLD_S 29
+#define RTC_IO_X32N_RDE (BIT(28))
+#define RTC_IO_X32N_RDE_M (BIT(28))
+#define RTC_IO_X32N_RDE_V 0x1
+#define RTC_IO_X32N_RDE_S 28
+#define RTC_IO_X32N_RUE (BIT(27))
+#define RTC_IO_X32N_RUE_M (BIT(27))
+#define RTC_IO_X32N_RUE_V 0x1
+#define RTC_IO_X32N_RUE_S 27
+#define RTC_IO_X32P_DRV 0x00000003
+#define RTC_IO_X32P_DRV_M ((RTC_IO_X32P_DRV_V) << (RTC_IO_X32P_DRV_S))
+#define RTC_IO_X32P_DRV_V 0x3
+#define RTC_IO_X32P_DRV_S 25
+#define RTC_IO_X32P_HOLD (BIT(24))
+#define RTC_IO_X32P_HOLD_M (BIT(24))
+#define RTC_IO_X32P_HOLD_V 0x1
+#define RTC_IO_X32P_HOLD_S 24
+#define RTC_IO_X32P_RDE (BIT(23))
+#define RTC_IO_X32P_RDE_M (BIT(23))
+#define RTC_IO_X32P_RDE_V 0x1
+#define RTC_IO_X32P_RDE_S 23
+#define RTC_IO_X32P_RUE (BIT(22))
+#define RTC_IO_X32P_RUE_M (BIT(22))
+#define RTC_IO_X32P_RUE_V 0x1
+#define RTC_IO_X32P_RUE_S 22
+#define RTC_IO_X32N_MUX_SEL (BIT(18))
+#define RTC_IO_X32N_MUX_SEL_M (BIT(18))
+#define RTC_IO_X32N_MUX_SEL_V 0x1
+#define RTC_IO_X32N_MUX_SEL_S 18
+#define RTC_IO_X32P_MUX_SEL (BIT(17))
+#define RTC_IO_X32P_MUX_SEL_M (BIT(17))
+#define RTC_IO_X32P_MUX_SEL_V 0x1
+#define RTC_IO_X32P_MUX_SEL_S 17
+#define RTC_IO_X32N_FUN_SEL 0x00000003
+#define RTC_IO_X32N_FUN_SEL_M ((RTC_IO_X32N_FUN_SEL_V) << (RTC_IO_X32N_FUN_SEL_S))
+#define RTC_IO_X32N_FUN_SEL_V 0x3
+#define RTC_IO_X32N_FUN_SEL_S 15
+#define RTC_IO_X32N_SLP_SEL (BIT(14))
+#define RTC_IO_X32N_SLP_SEL_M (BIT(14))
+#define RTC_IO_X32N_SLP_SEL_V 0x1
+#define RTC_IO_X32N_SLP_SEL_S 14
+#define RTC_IO_X32N_SLP_IE (BIT(13))
+#define RTC_IO_X32N_SLP_IE_M (BIT(13))
+#define RTC_IO_X32N_SLP_IE_V 0x1
+#define RTC_IO_X32N_SLP_IE_S 13
+#define RTC_IO_X32N_SLP_OE (BIT(12))
+#define RTC_IO_X32N_SLP_OE_M (BIT(12))
+#define RTC_IO_X32N_SLP_OE_V 0x1
+#define RTC_IO_X32N_SLP_OE_S 12
+#define RTC_IO_X32N_FUN_IE (BIT(11))
+#define RTC_IO_X32N_FUN_IE_M (BIT(11))
+#define RTC_IO_X32N_FUN_IE_V 0x1
+#define RTC_IO_X32N_FUN_IE_S 11
+#define RTC_IO_X32P_FUN_SEL 0x00000003
+#define RTC_IO_X32P_FUN_SEL_M ((RTC_IO_X32P_FUN_SEL_V) << (RTC_IO_X32P_FUN_SEL_S))
+#define RTC_IO_X32P_FUN_SEL_V 0x3
+#define RTC_IO_X32P_FUN_SEL_S 9
+#define RTC_IO_X32P_SLP_SEL (BIT(8))
+#define RTC_IO_X32P_SLP_SEL_M (BIT(8))
+#define RTC_IO_X32P_SLP_SEL_V 0x1
+#define RTC_IO_X32P_SLP_SEL_S 8
+#define RTC_IO_X32P_SLP_IE (BIT(7))
+#define RTC_IO_X32P_SLP_IE_M (BIT(7))
+#define RTC_IO_X32P_SLP_IE_V 0x1
+#define RTC_IO_X32P_SLP_IE_S 7
+#define RTC_IO_X32P_SLP_OE (BIT(6))
+#define RTC_IO_X32P_SLP_OE_M (BIT(6))
+#define RTC_IO_X32P_SLP_OE_V 0x1
+#define RTC_IO_X32P_SLP_OE_S 6
+#define RTC_IO_X32P_FUN_IE (BIT(5))
+#define RTC_IO_X32P_FUN_IE_M (BIT(5))
+#define RTC_IO_X32P_FUN_IE_V 0x1
+#define RTC_IO_X32P_FUN_IE_S 5
+
+#define RTC_IO_TOUCH_PAD0_REG (DR_REG_RTCIO_BASE + 0x94)
+#define RTC_IO_TOUCH_PAD0_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD0_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD0_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD0_HOLD_S 31
+#define RTC_IO_TOUCH_PAD0_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD0_DRV_M ((RTC_IO_TOUCH_PAD0_DRV_V) << (RTC_IO_TOUCH_PAD0_DRV_S))
+#define RTC_IO_TOUCH_PAD0_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD0_DRV_S 29
+#define RTC_IO_TOUCH_PAD0_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD0_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD0_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD0_RDE_S 28
+#define RTC_IO_TOUCH_PAD0_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD0_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD0_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD0_RUE_S 27
+#define RTC_IO_TOUCH_PAD0_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD0_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD0_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD0_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD0_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD0_FUN_SEL_M ((RTC_IO_TOUCH_PAD0_FUN_SEL_V) << (RTC_IO_TOUCH_PAD0_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD0_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD0_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD0_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD0_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD0_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD0_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD0_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD0_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD0_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD0_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD0_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD0_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD0_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD0_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD0_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD0_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD0_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD0_FUN_IE_S 13
+
+#define RTC_IO_TOUCH_PAD1_REG (DR_REG_RTCIO_BASE + 0x98)
+#define RTC_IO_TOUCH_PAD1_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD1_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD1_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD1_HOLD_S 31
+#define RTC_IO_TOUCH_PAD1_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD1_DRV_M ((RTC_IO_TOUCH_PAD1_DRV_V) << (RTC_IO_TOUCH_PAD1_DRV_S))
+#define RTC_IO_TOUCH_PAD1_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD1_DRV_S 29
+#define RTC_IO_TOUCH_PAD1_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD1_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD1_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD1_RDE_S 28
+#define RTC_IO_TOUCH_PAD1_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD1_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD1_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD1_RUE_S 27
+#define RTC_IO_TOUCH_PAD1_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD1_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD1_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD1_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD1_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD1_FUN_SEL_M ((RTC_IO_TOUCH_PAD1_FUN_SEL_V) << (RTC_IO_TOUCH_PAD1_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD1_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD1_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD1_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD1_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD1_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD1_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD1_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD1_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD1_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD1_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD1_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD1_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD1_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD1_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD1_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD1_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD1_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD1_FUN_IE_S 13
+
+#define RTC_IO_TOUCH_PAD2_REG (DR_REG_RTCIO_BASE + 0x9c)
+#define RTC_IO_TOUCH_PAD2_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD2_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD2_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD2_HOLD_S 31
+#define RTC_IO_TOUCH_PAD2_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD2_DRV_M ((RTC_IO_TOUCH_PAD2_DRV_V) << (RTC_IO_TOUCH_PAD2_DRV_S))
+#define RTC_IO_TOUCH_PAD2_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD2_DRV_S 29
+#define RTC_IO_TOUCH_PAD2_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD2_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD2_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD2_RDE_S 28
+#define RTC_IO_TOUCH_PAD2_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD2_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD2_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD2_RUE_S 27
+#define RTC_IO_TOUCH_PAD2_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD2_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD2_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD2_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD2_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD2_FUN_SEL_M ((RTC_IO_TOUCH_PAD2_FUN_SEL_V) << (RTC_IO_TOUCH_PAD2_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD2_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD2_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD2_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD2_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD2_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD2_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD2_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD2_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD2_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD2_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD2_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD2_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD2_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD2_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD2_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD2_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD2_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD2_FUN_IE_S 13
+
+#define RTC_IO_TOUCH_PAD3_REG (DR_REG_RTCIO_BASE + 0xa0)
+#define RTC_IO_TOUCH_PAD3_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD3_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD3_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD3_HOLD_S 31
+#define RTC_IO_TOUCH_PAD3_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD3_DRV_M ((RTC_IO_TOUCH_PAD3_DRV_V) << (RTC_IO_TOUCH_PAD3_DRV_S))
+#define RTC_IO_TOUCH_PAD3_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD3_DRV_S 29
+#define RTC_IO_TOUCH_PAD3_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD3_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD3_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD3_RDE_S 28
+#define RTC_IO_TOUCH_PAD3_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD3_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD3_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD3_RUE_S 27
+#define RTC_IO_TOUCH_PAD3_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD3_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD3_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD3_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD3_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD3_FUN_SEL_M ((RTC_IO_TOUCH_PAD3_FUN_SEL_V) << (RTC_IO_TOUCH_PAD3_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD3_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD3_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD3_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD3_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD3_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD3_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD3_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD3_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD3_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD3_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD3_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD3_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD3_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD3_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD3_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD3_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD3_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD3_FUN_IE_S 13
+
+#define RTC_IO_TOUCH_PAD4_REG (DR_REG_RTCIO_BASE + 0xa4)
+#define RTC_IO_TOUCH_PAD4_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD4_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD4_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD4_HOLD_S 31
+#define RTC_IO_TOUCH_PAD4_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD4_DRV_M ((RTC_IO_TOUCH_PAD4_DRV_V) << (RTC_IO_TOUCH_PAD4_DRV_S))
+#define RTC_IO_TOUCH_PAD4_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD4_DRV_S 29
+#define RTC_IO_TOUCH_PAD4_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD4_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD4_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD4_RDE_S 28
+#define RTC_IO_TOUCH_PAD4_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD4_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD4_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD4_RUE_S 27
+#define RTC_IO_TOUCH_PAD4_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD4_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD4_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD4_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD4_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD4_FUN_SEL_M ((RTC_IO_TOUCH_PAD4_FUN_SEL_V) << (RTC_IO_TOUCH_PAD4_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD4_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD4_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD4_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD4_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD4_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD4_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD4_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD4_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD4_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD4_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD4_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD4_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD4_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD4_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD4_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD4_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD4_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD4_FUN_IE_S 13
+
+#define RTC_IO_TOUCH_PAD5_REG (DR_REG_RTCIO_BASE + 0xa8)
+#define RTC_IO_TOUCH_PAD5_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD5_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD5_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD5_HOLD_S 31
+#define RTC_IO_TOUCH_PAD5_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD5_DRV_M ((RTC_IO_TOUCH_PAD5_DRV_V) << (RTC_IO_TOUCH_PAD5_DRV_S))
+#define RTC_IO_TOUCH_PAD5_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD5_DRV_S 29
+#define RTC_IO_TOUCH_PAD5_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD5_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD5_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD5_RDE_S 28
+#define RTC_IO_TOUCH_PAD5_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD5_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD5_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD5_RUE_S 27
+#define RTC_IO_TOUCH_PAD5_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD5_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD5_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD5_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD5_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD5_FUN_SEL_M ((RTC_IO_TOUCH_PAD5_FUN_SEL_V) << (RTC_IO_TOUCH_PAD5_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD5_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD5_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD5_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD5_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD5_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD5_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD5_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD5_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD5_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD5_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD5_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD5_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD5_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD5_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD5_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD5_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD5_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD5_FUN_IE_S 13
+
+#define RTC_IO_TOUCH_PAD6_REG (DR_REG_RTCIO_BASE + 0xac)
+#define RTC_IO_TOUCH_PAD6_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD6_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD6_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD6_HOLD_S 31
+#define RTC_IO_TOUCH_PAD6_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD6_DRV_M ((RTC_IO_TOUCH_PAD6_DRV_V) << (RTC_IO_TOUCH_PAD6_DRV_S))
+#define RTC_IO_TOUCH_PAD6_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD6_DRV_S 29
+#define RTC_IO_TOUCH_PAD6_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD6_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD6_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD6_RDE_S 28
+#define RTC_IO_TOUCH_PAD6_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD6_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD6_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD6_RUE_S 27
+#define RTC_IO_TOUCH_PAD6_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD6_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD6_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD6_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD6_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD6_FUN_SEL_M ((RTC_IO_TOUCH_PAD6_FUN_SEL_V) << (RTC_IO_TOUCH_PAD6_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD6_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD6_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD6_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD6_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD6_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD6_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD6_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD6_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD6_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD6_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD6_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD6_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD6_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD6_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD6_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD6_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD6_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD6_FUN_IE_S 13
+
+#define RTC_IO_TOUCH_PAD7_REG (DR_REG_RTCIO_BASE + 0xb0)
+#define RTC_IO_TOUCH_PAD7_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD7_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD7_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD7_HOLD_S 31
+#define RTC_IO_TOUCH_PAD7_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD7_DRV_M ((RTC_IO_TOUCH_PAD7_DRV_V) << (RTC_IO_TOUCH_PAD7_DRV_S))
+#define RTC_IO_TOUCH_PAD7_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD7_DRV_S 29
+#define RTC_IO_TOUCH_PAD7_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD7_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD7_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD7_RDE_S 28
+#define RTC_IO_TOUCH_PAD7_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD7_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD7_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD7_RUE_S 27
+#define RTC_IO_TOUCH_PAD7_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD7_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD7_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD7_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD7_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD7_FUN_SEL_M ((RTC_IO_TOUCH_PAD7_FUN_SEL_V) << (RTC_IO_TOUCH_PAD7_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD7_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD7_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD7_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD7_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD7_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD7_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD7_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD7_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD7_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD7_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD7_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD7_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD7_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD7_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD7_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD7_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD7_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD7_FUN_IE_S 13
+
+#define RTC_IO_TOUCH_PAD8_REG (DR_REG_RTCIO_BASE + 0xb4)
+#define RTC_IO_TOUCH_PAD8_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD8_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD8_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD8_HOLD_S 31
+#define RTC_IO_TOUCH_PAD8_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD8_DRV_M ((RTC_IO_TOUCH_PAD8_DRV_V) << (RTC_IO_TOUCH_PAD8_DRV_S))
+#define RTC_IO_TOUCH_PAD8_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD8_DRV_S 29
+#define RTC_IO_TOUCH_PAD8_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD8_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD8_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD8_RDE_S 28
+#define RTC_IO_TOUCH_PAD8_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD8_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD8_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD8_RUE_S 27
+#define RTC_IO_TOUCH_PAD8_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD8_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD8_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD8_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD8_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD8_FUN_SEL_M ((RTC_IO_TOUCH_PAD8_FUN_SEL_V) << (RTC_IO_TOUCH_PAD8_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD8_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD8_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD8_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD8_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD8_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD8_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD8_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD8_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD8_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD8_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD8_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD8_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD8_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD8_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD8_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD8_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD8_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD8_FUN_IE_S 13
+
+#define RTC_IO_TOUCH_PAD9_REG (DR_REG_RTCIO_BASE + 0xb8)
+#define RTC_IO_TOUCH_PAD9_HOLD (BIT(31))
+#define RTC_IO_TOUCH_PAD9_HOLD_M (BIT(31))
+#define RTC_IO_TOUCH_PAD9_HOLD_V 0x1
+#define RTC_IO_TOUCH_PAD9_HOLD_S 31
+#define RTC_IO_TOUCH_PAD9_DRV 0x00000003
+#define RTC_IO_TOUCH_PAD9_DRV_M ((RTC_IO_TOUCH_PAD9_DRV_V) << (RTC_IO_TOUCH_PAD9_DRV_S))
+#define RTC_IO_TOUCH_PAD9_DRV_V 0x3
+#define RTC_IO_TOUCH_PAD9_DRV_S 29
+#define RTC_IO_TOUCH_PAD9_RDE (BIT(28))
+#define RTC_IO_TOUCH_PAD9_RDE_M (BIT(28))
+#define RTC_IO_TOUCH_PAD9_RDE_V 0x1
+#define RTC_IO_TOUCH_PAD9_RDE_S 28
+#define RTC_IO_TOUCH_PAD9_RUE (BIT(27))
+#define RTC_IO_TOUCH_PAD9_RUE_M (BIT(27))
+#define RTC_IO_TOUCH_PAD9_RUE_V 0x1
+#define RTC_IO_TOUCH_PAD9_RUE_S 27
+#define RTC_IO_TOUCH_PAD9_MUX_SEL (BIT(19))
+#define RTC_IO_TOUCH_PAD9_MUX_SEL_M (BIT(19))
+#define RTC_IO_TOUCH_PAD9_MUX_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD9_MUX_SEL_S 19
+#define RTC_IO_TOUCH_PAD9_FUN_SEL 0x00000003
+#define RTC_IO_TOUCH_PAD9_FUN_SEL_M ((RTC_IO_TOUCH_PAD9_FUN_SEL_V) << (RTC_IO_TOUCH_PAD9_FUN_SEL_S))
+#define RTC_IO_TOUCH_PAD9_FUN_SEL_V 0x3
+#define RTC_IO_TOUCH_PAD9_FUN_SEL_S 17
+#define RTC_IO_TOUCH_PAD9_SLP_SEL (BIT(16))
+#define RTC_IO_TOUCH_PAD9_SLP_SEL_M (BIT(16))
+#define RTC_IO_TOUCH_PAD9_SLP_SEL_V 0x1
+#define RTC_IO_TOUCH_PAD9_SLP_SEL_S 16
+#define RTC_IO_TOUCH_PAD9_SLP_IE (BIT(15))
+#define RTC_IO_TOUCH_PAD9_SLP_IE_M (BIT(15))
+#define RTC_IO_TOUCH_PAD9_SLP_IE_V 0x1
+#define RTC_IO_TOUCH_PAD9_SLP_IE_S 15
+#define RTC_IO_TOUCH_PAD9_SLP_OE (BIT(14))
+#define RTC_IO_TOUCH_PAD9_SLP_OE_M (BIT(14))
+#define RTC_IO_TOUCH_PAD9_SLP_OE_V 0x1
+#define RTC_IO_TOUCH_PAD9_SLP_OE_S 14
+#define RTC_IO_TOUCH_PAD9_FUN_IE (BIT(13))
+#define RTC_IO_TOUCH_PAD9_FUN_IE_M (BIT(13))
+#define RTC_IO_TOUCH_PAD9_FUN_IE_V 0x1
+#define RTC_IO_TOUCH_PAD9_FUN_IE_S 13
+
+#define RTC_IO_EXT_WAKEUP0_REG (DR_REG_RTCIO_BASE + 0xbc)
+#define RTC_IO_EXT_WAKEUP0_SEL 0x0000001F
+#define RTC_IO_EXT_WAKEUP0_SEL_M ((RTC_IO_EXT_WAKEUP0_SEL_V) << (RTC_IO_EXT_WAKEUP0_SEL_S))
+#define RTC_IO_EXT_WAKEUP0_SEL_V 0x1F
+#define RTC_IO_EXT_WAKEUP0_SEL_S 27
+
+#define RTC_IO_SAR_I2C_IO_REG (DR_REG_RTCIO_BASE + 0xc4)
+#define RTC_IO_SAR_I2C_SDA_SEL 0x00000003
+#define RTC_IO_SAR_I2C_SDA_SEL_M ((RTC_IO_SAR_I2C_SDA_SEL_V) << (RTC_IO_SAR_I2C_SDA_SEL_S))
+#define RTC_IO_SAR_I2C_SDA_SEL_V 0x3
+#define RTC_IO_SAR_I2C_SDA_SEL_S 30
+#define RTC_IO_SAR_I2C_SCL_SEL 0x00000003
+#define RTC_IO_SAR_I2C_SCL_SEL_M ((RTC_IO_SAR_I2C_SCL_SEL_V) << (RTC_IO_SAR_I2C_SCL_SEL_S))
+#define RTC_IO_SAR_I2C_SCL_SEL_V 0x3
+#define RTC_IO_SAR_I2C_SCL_SEL_S 28
+
+#endif /* HULP_HOST_RTC_IO_REG_H */
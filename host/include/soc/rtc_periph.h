@@ -0,0 +1,8 @@
+#ifndef HULP_HOST_RTC_PERIPH_H
+#define HULP_HOST_RTC_PERIPH_H
+
+#include "soc/rtc_io_periph.h"
+#include "soc/rtc_cntl_reg.h"
+#include "soc/sens_reg.h"
+
+#endif /* HULP_HOST_RTC_PERIPH_H */
@@ -0,0 +1,120 @@
+#ifndef HULP_HOST_SENS_REG_H
+#define HULP_HOST_SENS_REG_H
+
+#include "soc/soc.h"
+
+#define SENS_SAR_MEAS_WAIT2_REG (DR_REG_SENS_BASE + 0x000c)
+#define SENS_FORCE_XPD_SAR 0x00000003
+#define SENS_FORCE_XPD_SAR_M ((SENS_FORCE_XPD_SAR_V) << (SENS_FORCE_XPD_SAR_S))
+#define SENS_FORCE_XPD_SAR_V 0x3
+#define SENS_FORCE_XPD_SAR_S 18
+#define SENS_FORCE_XPD_SAR_FSM 0
+#define SENS_FORCE_XPD_SAR_PD 2
+#define SENS_FORCE_XPD_SAR_PU 3
+
+#define SENS_ULP_CP_SLEEP_CYC0_REG (DR_REG_SENS_BASE + 0x0018)
+#define SENS_ULP_CP_SLEEP_CYC1_REG (DR_REG_SENS_BASE + 0x001c)
+#define SENS_ULP_CP_SLEEP_CYC2_REG (DR_REG_SENS_BASE + 0x0020)
+#define SENS_ULP_CP_SLEEP_CYC3_REG (DR_REG_SENS_BASE + 0x0024)
+#define SENS_ULP_CP_SLEEP_CYC4_REG (DR_REG_SENS_BASE + 0x0028)
+
+#define SENS_SAR_START_FORCE_REG (DR_REG_SENS_BASE + 0x002c)
+#define SENS_PC_INIT 0x000007FF
+#define SENS_PC_INIT_M ((SENS_PC_INIT_V) << (SENS_PC_INIT_S))
+#define SENS_PC_INIT_V 0x7FF
+#define SENS_PC_INIT_S 11
+#define SENS_ULP_CP_START_TOP (BIT(10))
+#define SENS_ULP_CP_START_TOP_M (BIT(10))
+#define SENS_ULP_CP_START_TOP_V 0x1
+#define SENS_ULP_CP_START_TOP_S 10
+#define SENS_ULP_CP_FORCE_START_TOP (BIT(9))
+#define SENS_ULP_CP_FORCE_START_TOP_M (BIT(9))
+#define SENS_ULP_CP_FORCE_START_TOP_V 0x1
+#define SENS_ULP_CP_FORCE_START_TOP_S 9
+
+#define SENS_SAR_SLAVE_ADDR1_REG (DR_REG_SENS_BASE + 0x003c)
+#define SENS_I2C_SLAVE_ADDR0 0x000007FF
+#define SENS_I2C_SLAVE_ADDR0_M ((SENS_I2C_SLAVE_ADDR0_V) << (SENS_I2C_SLAVE_ADDR0_S))
+#define SENS_I2C_SLAVE_ADDR0_V 0x7FF
+#define SENS_I2C_SLAVE_ADDR0_S 11
+#define SENS_I2C_SLAVE_ADDR1 0x000007FF
+#define SENS_I2C_SLAVE_ADDR1_M ((SENS_I2C_SLAVE_ADDR1_V) << (SENS_I2C_SLAVE_ADDR1_S))
+#define SENS_I2C_SLAVE_ADDR1_V 0x7FF
+#define SENS_I2C_SLAVE_ADDR1_S 0
+#define SENS_SAR_SLAVE_ADDR2_REG (DR_REG_SENS_BASE + 0x0040)
+#define SENS_I2C_SLAVE_ADDR2 0x000007FF
+#define SENS_I2C_SLAVE_ADDR2_M ((SENS_I2C_SLAVE_ADDR2_V) << (SENS_I2C_SLAVE_ADDR2_S))
+#define SENS_I2C_SLAVE_ADDR2_V 0x7FF
+#define SENS_I2C_SLAVE_ADDR2_S 11
+#define SENS_I2C_SLAVE_ADDR3 0x000007FF
+#define SENS_I2C_SLAVE_ADDR3_M ((SENS_I2C_SLAVE_ADDR3_V) << (SENS_I2C_SLAVE_ADDR3_S))
+#define SENS_I2C_SLAVE_ADDR3_V 0x7FF
+#define SENS_I2C_SLAVE_ADDR3_S 0
+#define SENS_SAR_SLAVE_ADDR3_REG (DR_REG_SENS_BASE + 0x0044)
+#define SENS_I2C_SLAVE_ADDR4 0x000007FF
+#define SENS_I2C_SLAVE_ADDR4_M ((SENS_I2C_SLAVE_ADDR4_V) << (SENS_I2C_SLAVE_ADDR4_S))
+#define SENS_I2C_SLAVE_ADDR4_V 0x7FF
+#define SENS_I2C_SLAVE_ADDR4_S 11
+#define SENS_I2C_SLAVE_ADDR5 0x000007FF
+#define SENS_I2C_SLAVE_ADDR5_M ((SENS_I2C_SLAVE_ADDR5_V) << (SENS_I2C_SLAVE_ADDR5_S))
+#define SENS_I2C_SLAVE_ADDR5_V 0x7FF
+#define SENS_I2C_SLAVE_ADDR5_S 0
+#define SENS_SAR_SLAVE_ADDR4_REG (DR_REG_SENS_BASE + 0x0048)
+#define SENS_I2C_SLAVE_ADDR6 0x000007FF
+#define SENS_I2C_SLAVE_ADDR6_M ((SENS_I2C_SLAVE_ADDR6_V) << (SENS_I2C_SLAVE_ADDR6_S))
+#define SENS_I2C_SLAVE_ADDR6_V 0x7FF
+#define SENS_I2C_SLAVE_ADDR6_S 11
+#define SENS_I2C_SLAVE_ADDR7 0x000007FF
+#define SENS_I2C_SLAVE_ADDR7_M ((SENS_I2C_SLAVE_ADDR7_V) << (SENS_I2C_SLAVE_ADDR7_S))
+#define SENS_I2C_SLAVE_ADDR7_V 0x7FF
+#define SENS_I2C_SLAVE_ADDR7_S 0
+
+#define SENS_SAR_TSENS_CTRL_REG (DR_REG_SENS_BASE + 0x004c)
+#define SENS_TSENS_DUMP_OUT (BIT(26))
+#define SENS_TSENS_DUMP_OUT_M (BIT(26))
+#define SENS_TSENS_DUMP_OUT_V 0x1
+#define SENS_TSENS_DUMP_OUT_S 26
+#define SENS_TSENS_POWER_UP_FORCE (BIT(25))
+#define SENS_TSENS_POWER_UP_FORCE_M (BIT(25))
+#define SENS_TSENS_POWER_UP_FORCE_V 0x1
+#define SENS_TSENS_POWER_UP_FORCE_S 25
+#define SENS_TSENS_POWER_UP (BIT(24))
+#define SENS_TSENS_POWER_UP_M (BIT(24))
+#define SENS_TSENS_POWER_UP_V 0x1
+#define SENS_TSENS_POWER_UP_S 24
+#define SENS_TSENS_CLK_DIV 0x000000FF
+#define SENS_TSENS_CLK_DIV_M ((SENS_TSENS_CLK_DIV_V) << (SENS_TSENS_CLK_DIV_S))
+#define SENS_TSENS_CLK_DIV_V 0xFF
+#define SENS_TSENS_CLK_DIV_S 16
+
+#define SENS_SAR_TOUCH_CTRL1_REG (DR_REG_SENS_BASE + 0x0058)
+#define SENS_TOUCH_OUT_1EN (BIT(25))
+#define SENS_TOUCH_OUT_1EN_M (BIT(25))
+#define SENS_TOUCH_OUT_1EN_V 0x1
+#define SENS_TOUCH_OUT_1EN_S 25
+#define SENS_SAR_TOUCH_THRES1_REG (DR_REG_SENS_BASE + 0x005c)
+#define SENS_SAR_TOUCH_OUT1_REG (DR_REG_SENS_BASE + 0x0070)
+#define SENS_SAR_TOUCH_CTRL2_REG (DR_REG_SENS_BASE + 0x0084)
+#define SENS_TOUCH_START_EN (BIT(12))
+#define SENS_TOUCH_START_EN_M (BIT(12))
+#define SENS_TOUCH_START_EN_V 0x1
+#define SENS_TOUCH_START_EN_S 12
+#define SENS_TOUCH_MEAS_DONE (BIT(10))
+#define SENS_TOUCH_MEAS_DONE_M (BIT(10))
+#define SENS_TOUCH_MEAS_DONE_V 0x1
+#define SENS_TOUCH_MEAS_DONE_S 10
+#define SENS_SAR_TOUCH_ENABLE_REG (DR_REG_SENS_BASE + 0x008c)
+#define SENS_TOUCH_PAD_OUTEN1 0x000003FF
+#define SENS_TOUCH_PAD_OUTEN1_M ((SENS_TOUCH_PAD_OUTEN1_V) << (SENS_TOUCH_PAD_OUTEN1_S))
+#define SENS_TOUCH_PAD_OUTEN1_V 0x3FF
+#define SENS_TOUCH_PAD_OUTEN1_S 20
+#define SENS_TOUCH_PAD_OUTEN2 0x000003FF
+#define SENS_TOUCH_PAD_OUTEN2_M ((SENS_TOUCH_PAD_OUTEN2_V) << (SENS_TOUCH_PAD_OUTEN2_S))
+#define SENS_TOUCH_PAD_OUTEN2_V 0x3FF
+#define SENS_TOUCH_PAD_OUTEN2_S 10
+#define SENS_TOUCH_PAD_WORKEN 0x000003FF
+#define SENS_TOUCH_PAD_WORKEN_M ((SENS_TOUCH_PAD_WORKEN_V) << (SENS_TOUCH_PAD_WORKEN_S))
+#define SENS_TOUCH_PAD_WORKEN_V 0x3FF
+#define SENS_TOUCH_PAD_WORKEN_S 0
+
+#endif /* HULP_HOST_SENS_REG_H */
@@ -0,0 +1,51 @@
+#ifndef HULP_HOST_SOC_H
+#define HULP_HOST_SOC_H
+
+#include <stdint.h>
+
+#ifndef BIT
+#define BIT(nr) (1UL << (nr))
+#endif
+
+#define DR_REG_RTCCNTL_BASE 0x3ff48000
+#define DR_REG_RTCIO_BASE 0x3ff48400
+#define DR_REG_SENS_BASE 0x3ff48800
+#define DR_REG_RTC_I2C_BASE 0x3ff48C00
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Host build: the word backing a peripheral register, in the register file of host/idf (RTC peripherals only).
+ */
+volatile uint32_t* hulp_host_reg(uint32_t addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+// Register access, as per ESP-IDF's soc/soc.h, over the host register file
+
+#define REG_WRITE(_r, _v) (*hulp_host_reg((uint32_t)(_r)) = (uint32_t)(_v))
+#define REG_READ(_r) (*hulp_host_reg((uint32_t)(_r)))
+#define REG_GET_BIT(_r, _b) (REG_READ(_r) & (uint32_t)(_b))
+#define REG_SET_BIT(_r, _b) (*hulp_host_reg((uint32_t)(_r)) |= (uint32_t)(_b))
+#define REG_CLR_BIT(_r, _b) (*hulp_host_reg((uint32_t)(_r)) &= ~(uint32_t)(_b))
+#define REG_SET_BITS(_r, _b, _m) REG_WRITE(_r, (REG_READ(_r) & ~(uint32_t)(_m)) | ((uint32_t)(_b) & (uint32_t)(_m)))
+#define REG_GET_FIELD(_r, _f) ((REG_READ(_r) >> (_f##_S)) & (_f##_V))
+#define REG_SET_FIELD(_r, _f, _v) REG_WRITE(_r, (REG_READ(_r) & ~((uint32_t)(_f##_V) << (_f##_S))) | (((uint32_t)(_v) & (_f##_V)) << (_f##_S)))
+#define VALUE_GET_FIELD(_r, _f) (((_r) >> (_f##_S)) & (_f))
+#define VALUE_SET_FIELD(_r, _f, _v) ((_r) = (((_r) & ~((_f) << (_f##_S))) | ((_v) << (_f##_S))))
+#define FIELD_TO_VALUE(_f, _v) (((_v) & (_f)) << _f##_S)
+
+#define READ_PERI_REG(addr) REG_READ(addr)
+#define WRITE_PERI_REG(addr, val) REG_WRITE(addr, val)
+#define CLEAR_PERI_REG_MASK(reg, mask) REG_CLR_BIT(reg, mask)
+#define SET_PERI_REG_MASK(reg, mask) REG_SET_BIT(reg, mask)
+#define GET_PERI_REG_MASK(reg, mask) (READ_PERI_REG(reg) & (uint32_t)(mask))
+#define GET_PERI_REG_BITS(reg, hipos, lowpos) ((READ_PERI_REG(reg) >> (lowpos)) & ((1UL << ((hipos) - (lowpos) + 1)) - 1))
+#define SET_PERI_REG_BITS(reg, bit_map, value, shift) WRITE_PERI_REG(reg, (READ_PERI_REG(reg) & ~((uint32_t)(bit_map) << (shift))) | (((uint32_t)(value) & (uint32_t)(bit_map)) << (shift)))
+#define GET_PERI_REG_BITS2(reg, mask, shift) ((READ_PERI_REG(reg) >> (shift)) & (mask))
+
+#endif /* HULP_HOST_SOC_H */
@@ -0,0 +1,9 @@
+#ifndef HULP_HOST_SOC_CAPS_H
+#define HULP_HOST_SOC_CAPS_H
+
+#define SOC_GPIO_PIN_COUNT 40
+#define SOC_RTCIO_PIN_COUNT 18
+#define SOC_RTC_IO_PIN_COUNT SOC_RTCIO_PIN_COUNT
+#define SOC_TOUCH_SENSOR_NUM 10
+
+#endif /* HULP_HOST_SOC_CAPS_H */
@@ -0,0 +1,9 @@
+#ifndef HULP_HOST_SOC_MEMORY_LAYOUT_H
+#define HULP_HOST_SOC_MEMORY_LAYOUT_H
+
+#include "soc/soc.h"
+
+#define SOC_RTC_DATA_LOW 0x50000000
+#define SOC_RTC_DATA_HIGH 0x50002000
+
+#endif /* HULP_HOST_SOC_MEMORY_LAYOUT_H */
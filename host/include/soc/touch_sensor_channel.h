@@ -0,0 +1,25 @@
+#ifndef HULP_HOST_TOUCH_SENSOR_CHANNEL_H
+#define HULP_HOST_TOUCH_SENSOR_CHANNEL_H
+
+#define TOUCH_PAD_GPIO4_CHANNEL 0
+#define TOUCH_PAD_NUM0_GPIO_NUM 4
+#define TOUCH_PAD_GPIO0_CHANNEL 1
+#define TOUCH_PAD_NUM1_GPIO_NUM 0
+#define TOUCH_PAD_GPIO2_CHANNEL 2
+#define TOUCH_PAD_NUM2_GPIO_NUM 2
+#define TOUCH_PAD_GPIO15_CHANNEL 3
+#define TOUCH_PAD_NUM3_GPIO_NUM 15
+#define TOUCH_PAD_GPIO13_CHANNEL 4
+#define TOUCH_PAD_NUM4_GPIO_NUM 13
+#define TOUCH_PAD_GPIO12_CHANNEL 5
+#define TOUCH_PAD_NUM5_GPIO_NUM 12
+#define TOUCH_PAD_GPIO14_CHANNEL 6
+#define TOUCH_PAD_NUM6_GPIO_NUM 14
+#define TOUCH_PAD_GPIO27_CHANNEL 7
+#define TOUCH_PAD_NUM7_GPIO_NUM 27
+#define TOUCH_PAD_GPIO33_CHANNEL 8
+#define TOUCH_PAD_NUM8_GPIO_NUM 33
+#define TOUCH_PAD_GPIO32_CHANNEL 9
+#define TOUCH_PAD_NUM9_GPIO_NUM 32
+
+#endif /* HULP_HOST_TOUCH_SENSOR_CHANNEL_H */
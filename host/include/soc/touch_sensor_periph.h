@@ -0,0 +1,17 @@
+#ifndef HULP_HOST_TOUCH_SENSOR_PERIPH_H
+#define HULP_HOST_TOUCH_SENSOR_PERIPH_H
+
+#include "soc/touch_sensor_channel.h"
+#include "soc/soc_caps.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const int touch_sensor_channel_io_map[SOC_TOUCH_SENSOR_NUM];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_HOST_TOUCH_SENSOR_PERIPH_H */
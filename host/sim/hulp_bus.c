@@ -0,0 +1,337 @@
+#include "hulp_bus.h"
+
+#include <string.h>
+
+#include "esp_log.h"
+#include "soc/rtc_io_reg.h"
+
+static const char* TAG = "HULP-BUS";
+
+#define HULP_BUS_TIMER_PIN HULP_BUS_NUM_PINS
+
+static inline bool hulp_bus_is_gpio_reg(uint32_t reg)
+{
+    return reg >= RTC_GPIO_OUT_REG && reg <= RTC_GPIO_IN_REG;
+}
+
+static void hulp_bus_vcd_change(hulp_bus_t* bus, uint8_t pin)
+{
+    if(!bus->vcd)
+    {
+        return;
+    }
+    if(bus->now_ns != bus->vcd_time_ns)
+    {
+        fprintf(bus->vcd, "#%llu\n", (unsigned long long)bus->now_ns);
+        bus->vcd_time_ns = bus->now_ns;
+    }
+    fprintf(bus->vcd, "%u%c\n", bus->level[pin], '!' + pin);
+}
+
+/**
+ * Resolve the level of a pin, and notify of any change.
+ */
+static void hulp_bus_resolve(hulp_bus_t* bus, uint8_t pin)
+{
+    uint32_t bit = 1UL << (RTC_GPIO_OUT_DATA_S + pin);
+    bool ulp_en = *hulp_sim_reg(bus->sim, RTC_GPIO_ENABLE_REG) & bit;
+    bool ulp_out = *hulp_sim_reg(bus->sim, RTC_GPIO_OUT_REG) & bit;
+    bool dev_low = false, dev_high = false;
+    for(size_t i = 0; i < bus->num_devices; ++i)
+    {
+        dev_low |= (bus->drive[i][pin] == HULP_BUS_LOW);
+        dev_high |= (bus->drive[i][pin] == HULP_BUS_HIGH);
+    }
+
+    uint8_t level;
+    bool contended;
+    if(ulp_en)
+    {
+        level = ulp_out;
+        contended = ulp_out ? dev_low : dev_high;
+    }
+    else
+    {
+        level = dev_low ? 0 : (dev_high ? 1 : bus->pull[pin]);
+        contended = dev_low && dev_high;
+    }
+    if(contended && !bus->contended[pin])
+    {
+        ++bus->contentions;
+        ESP_LOGW(TAG, "[%s] contention on %s at %llu ns", __func__, bus->names[pin], (unsigned long long)bus->now_ns);
+    }
+    bus->contended[pin] = contended;
+
+    if(level == bus->level[pin])
+    {
+        return;
+    }
+    bus->level[pin] = level;
+    hulp_bus_vcd_change(bus, pin);
+    for(size_t i = 0; i < bus->num_devices; ++i)
+    {
+        hulp_bus_device_t* dev = bus->devices[i];
+        if((dev->pins & (1UL << pin)) && dev->edge)
+        {
+            dev->edge(bus, dev, pin, level, bus->now_ns);
+        }
+    }
+}
+
+static void hulp_bus_schedule(hulp_bus_t* bus, const hulp_bus_event_t* event)
+{
+    if(bus->num_events == HULP_BUS_MAX_EVENTS)
+    {
+        ++bus->dropped_events;
+        ESP_LOGE(TAG, "[%s] event queue full", __func__);
+        return;
+    }
+    // Sorted by time; events at the same time stay in the order scheduled
+    size_t i = bus->num_events;
+    while(i > 0 && bus->events[i - 1].time_ns > event->time_ns)
+    {
+        --i;
+    }
+    memmove(&bus->events[i + 1], &bus->events[i], (bus->num_events - i) * sizeof(hulp_bus_event_t));
+    bus->events[i] = *event;
+    ++bus->num_events;
+}
+
+void hulp_bus_drive(hulp_bus_t* bus, hulp_bus_device_t* dev, uint8_t pin, hulp_bus_drive_t drive, uint64_t time_ns)
+{
+    if(pin >= HULP_BUS_NUM_PINS)
+    {
+        return;
+    }
+    hulp_bus_event_t event = {
+        .time_ns = (time_ns > bus->now_ns) ? time_ns : bus->now_ns,
+        .device = dev->index,
+        .pin = pin,
+        .drive = drive,
+        .id = 0,
+    };
+    hulp_bus_schedule(bus, &event);
+}
+
+void hulp_bus_timer(hulp_bus_t* bus, hulp_bus_device_t* dev, uint32_t id, uint64_t time_ns)
+{
+    hulp_bus_event_t event = {
+        .time_ns = (time_ns > bus->now_ns) ? time_ns : bus->now_ns,
+        .device = dev->index,
+        .pin = HULP_BUS_TIMER_PIN,
+        .drive = HULP_BUS_RELEASE,
+        .id = id,
+    };
+    hulp_bus_schedule(bus, &event);
+}
+
+void hulp_bus_advance(hulp_bus_t* bus, uint64_t time_ns)
+{
+    while(bus->num_events > 0 && bus->events[0].time_ns <= time_ns)
+    {
+        hulp_bus_event_t event = bus->events[0];
+        --bus->num_events;
+        memmove(&bus->events[0], &bus->events[1], bus->num_events * sizeof(hulp_bus_event_t));
+        bus->now_ns = event.time_ns;
+        hulp_bus_device_t* dev = bus->devices[event.device];
+        if(event.pin == HULP_BUS_TIMER_PIN)
+        {
+            if(dev->timer)
+            {
+                dev->timer(bus, dev, event.id, bus->now_ns);
+            }
+        }
+        else
+        {
+            bus->drive[event.device][event.pin] = event.drive;
+            hulp_bus_resolve(bus, event.pin);
+        }
+    }
+    if(time_ns > bus->now_ns)
+    {
+        bus->now_ns = time_ns;
+    }
+}
+
+void hulp_bus_set_output(hulp_bus_t* bus, uint8_t pin, int level)
+{
+    if(pin >= HULP_BUS_NUM_PINS)
+    {
+        return;
+    }
+    uint32_t bit = 1UL << (RTC_GPIO_OUT_DATA_S + pin);
+    hulp_sim_reg_write(bus->sim, RTC_GPIO_ENABLE_REG, bit, bit);
+    hulp_sim_reg_write(bus->sim, RTC_GPIO_OUT_REG, bit, level ? bit : 0);
+    hulp_bus_resolve(bus, pin);
+}
+
+int hulp_bus_level(const hulp_bus_t* bus, uint8_t pin)
+{
+    return (pin < HULP_BUS_NUM_PINS) ? bus->level[pin] : 0;
+}
+
+static uint32_t hulp_bus_read(hulp_sim_t* sim, void* arg, uint32_t reg)
+{
+    hulp_bus_t* bus = (hulp_bus_t*)arg;
+    if(!hulp_bus_is_gpio_reg(reg))
+    {
+        return bus->next.read ? bus->next.read(sim, bus->next.arg, reg) : hulp_sim_reg_read(sim, reg);
+    }
+    hulp_bus_advance(bus, hulp_sim_time_ns(sim));
+    if(reg != RTC_GPIO_IN_REG)
+    {
+        return hulp_sim_reg_read(sim, reg);
+    }
+    uint32_t in = 0;
+    for(uint8_t pin = 0; pin < HULP_BUS_NUM_PINS; ++pin)
+    {
+        in |= (uint32_t)bus->level[pin] << (RTC_GPIO_IN_NEXT_S + pin);
+    }
+    return in;
+}
+
+static void hulp_bus_write(hulp_sim_t* sim, void* arg, uint32_t reg, uint32_t mask, uint32_t value)
+{
+    hulp_bus_t* bus = (hulp_bus_t*)arg;
+    if(!hulp_bus_is_gpio_reg(reg))
+    {
+        if(bus->next.write)
+        {
+            bus->next.write(sim, bus->next.arg, reg, mask, value);
+        }
+        else
+        {
+            hulp_sim_reg_write(sim, reg, mask, value);
+        }
+        return;
+    }
+    uint64_t now = hulp_sim_time_ns(sim);
+    hulp_bus_advance(bus, now);
+    hulp_sim_reg_write(sim, reg, mask, value);
+    for(uint8_t pin = 0; pin < HULP_BUS_NUM_PINS; ++pin)
+    {
+        hulp_bus_resolve(bus, pin);
+    }
+    // Immediate responses
+    hulp_bus_advance(bus, now);
+}
+
+static uint8_t hulp_bus_i2c(hulp_sim_t* sim, void* arg, uint8_t slave_sel, uint8_t sub_addr, bool write, uint8_t data)
+{
+    hulp_bus_t* bus = (hulp_bus_t*)arg;
+    return bus->next.i2c(sim, bus->next.arg, slave_sel, sub_addr, write, data);
+}
+
+static uint16_t hulp_bus_adc(hulp_sim_t* sim, void* arg, uint8_t adc_idx, uint8_t pad_idx)
+{
+    hulp_bus_t* bus = (hulp_bus_t*)arg;
+    return bus->next.adc(sim, bus->next.arg, adc_idx, pad_idx);
+}
+
+static uint16_t hulp_bus_tsens(hulp_sim_t* sim, void* arg)
+{
+    hulp_bus_t* bus = (hulp_bus_t*)arg;
+    return bus->next.tsens(sim, bus->next.arg);
+}
+
+static void hulp_bus_wake(hulp_sim_t* sim, void* arg)
+{
+    hulp_bus_t* bus = (hulp_bus_t*)arg;
+    bus->next.wake(sim, bus->next.arg);
+}
+
+esp_err_t hulp_bus_attach(hulp_bus_t* bus, hulp_bus_device_t* dev)
+{
+    if(bus->num_devices == HULP_BUS_MAX_DEVICES)
+    {
+        ESP_LOGE(TAG, "[%s] too many devices", __func__);
+        return ESP_ERR_NO_MEM;
+    }
+    dev->index = (uint8_t)bus->num_devices;
+    memset(bus->drive[dev->index], HULP_BUS_RELEASE, sizeof(bus->drive[dev->index]));
+    bus->devices[bus->num_devices++] = dev;
+    return ESP_OK;
+}
+
+void hulp_bus_set_name(hulp_bus_t* bus, uint8_t pin, const char* name)
+{
+    if(pin < HULP_BUS_NUM_PINS)
+    {
+        snprintf(bus->names[pin], sizeof(bus->names[pin]), "%s", name);
+    }
+}
+
+void hulp_bus_vcd_start(hulp_bus_t* bus, FILE* f)
+{
+    bus->vcd = f;
+    bus->vcd_time_ns = bus->now_ns;
+    fprintf(f, "$timescale 1ns $end\n$scope module hulp $end\n");
+    for(uint8_t pin = 0; pin < HULP_BUS_NUM_PINS; ++pin)
+    {
+        fprintf(f, "$var wire 1 %c %s $end\n", '!' + pin, bus->names[pin]);
+    }
+    fprintf(f, "$upscope $end\n$enddefinitions $end\n#%llu\n$dumpvars\n", (unsigned long long)bus->now_ns);
+    for(uint8_t pin = 0; pin < HULP_BUS_NUM_PINS; ++pin)
+    {
+        fprintf(f, "%u%c\n", bus->level[pin], '!' + pin);
+    }
+    fprintf(f, "$end\n");
+}
+
+esp_err_t hulp_bus_init(hulp_bus_t* bus, hulp_sim_t* sim)
+{
+    if(!bus || !sim)
+    {
+        ESP_LOGE(TAG, "[%s] invalid arg", __func__);
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(bus, 0, sizeof(*bus));
+    bus->sim = sim;
+    bus->next = sim->periph;
+    bus->now_ns = hulp_sim_time_ns(sim);
+    for(uint8_t pin = 0; pin < HULP_BUS_NUM_PINS; ++pin)
+    {
+        bus->pull[pin] = 1;
+        bus->level[pin] = 1;
+        snprintf(bus->names[pin], sizeof(bus->names[pin]), "rtcio%u", pin);
+        hulp_bus_resolve(bus, pin);
+    }
+    // The other callbacks are passed through with their own arg
+    sim->periph.read = hulp_bus_read;
+    sim->periph.write = hulp_bus_write;
+    sim->periph.i2c = bus->next.i2c ? hulp_bus_i2c : NULL;
+    sim->periph.adc = bus->next.adc ? hulp_bus_adc : NULL;
+    sim->periph.tsens = bus->next.tsens ? hulp_bus_tsens : NULL;
+    sim->periph.wake = bus->next.wake ? hulp_bus_wake : NULL;
+    sim->periph.arg = bus;
+    return ESP_OK;
+}
+
+void hulp_bus_span_add(hulp_bus_span_t* span, uint64_t ns)
+{
+    if(span->count == 0 || ns < span->min_ns)
+    {
+        span->min_ns = ns;
+    }
+    if(span->count == 0 || ns > span->max_ns)
+    {
+        span->max_ns = ns;
+    }
+    ++span->count;
+}
+
+bool hulp_bus_span_print(const char* name, const hulp_bus_span_t* span, uint64_t spec_min_ns)
+{
+    if(span->count == 0)
+    {
+        printf("  %-12s -\n", name);
+        return true;
+    }
+    printf("  %-12s %llu - %llu ns", name, (unsigned long long)span->min_ns, (unsigned long long)span->max_ns);
+    if(spec_min_ns > 0)
+    {
+        printf(" (min %llu ns, margin %lld ns)", (unsigned long long)spec_min_ns, (long long)span->min_ns - (long long)spec_min_ns);
+    }
+    printf("%s\n", (span->min_ns < spec_min_ns) ? " VIOLATION" : "");
+    return span->min_ns >= spec_min_ns;
+}
@@ -0,0 +1,147 @@
+#ifndef HULP_BUS_H
+#define HULP_BUS_H
+
+#include <stdio.h>
+
+#include "hulp_sim.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pin-level bus for the simulator: device models (eg. hulp_bus_i2c.h) drive and observe RTC GPIOs alongside the ULP.
+ *
+ * The bus hooks the simulator's RD_REG/WR_REG of the RTC GPIO registers. The level of each pin is resolved from
+ * the ULP (when its output is enabled), the devices' drives (low wins), then the pin's pull. Devices are told of
+ * level changes, and may schedule their own drives and timers in the future; these are processed in time order
+ * whenever the ULP accesses a register, so the ULP sees device responses as if they were concurrent.
+ * Pin numbers are RTCIO numbers (eg. hulp_gtr(gpio_num)).
+ */
+
+#define HULP_BUS_NUM_PINS 18
+#define HULP_BUS_MAX_DEVICES 8
+#define HULP_BUS_MAX_EVENTS 128
+
+typedef enum {
+    HULP_BUS_RELEASE = -1,  /*!< Not driven by the device (high impedance) */
+    HULP_BUS_LOW = 0,
+    HULP_BUS_HIGH = 1,
+} hulp_bus_drive_t;
+
+typedef struct hulp_bus hulp_bus_t;
+typedef struct hulp_bus_device hulp_bus_device_t;
+
+/**
+ * A device on the bus. Embed in the model's struct and hulp_bus_attach it.
+ *
+ * pins: mask of pins (1 << pin) whose level changes are passed to edge
+ * edge: a pin's level has changed at time_ns
+ * timer: a timer scheduled with hulp_bus_timer has expired
+ */
+struct hulp_bus_device {
+    const char* name;
+    uint32_t pins;
+    void (*edge)(hulp_bus_t* bus, hulp_bus_device_t* dev, uint8_t pin, int level, uint64_t time_ns);
+    void (*timer)(hulp_bus_t* bus, hulp_bus_device_t* dev, uint32_t id, uint64_t time_ns);
+    uint8_t index;                          /*!< Set by hulp_bus_attach */
+};
+
+typedef struct {
+    uint64_t time_ns;
+    uint8_t device;
+    uint8_t pin;                            /*!< HULP_BUS_NUM_PINS for a timer */
+    int8_t drive;
+    uint32_t id;
+} hulp_bus_event_t;
+
+struct hulp_bus {
+    hulp_sim_t* sim;
+    hulp_sim_periph_t next;                 /*!< Peripherals replaced by the bus, for other registers */
+    hulp_bus_device_t* devices[HULP_BUS_MAX_DEVICES];
+    size_t num_devices;
+    int8_t drive[HULP_BUS_MAX_DEVICES][HULP_BUS_NUM_PINS];
+    uint8_t pull[HULP_BUS_NUM_PINS];        /*!< Level of a pin driven by nothing (default 1, ie. pulled up) */
+    uint8_t level[HULP_BUS_NUM_PINS];       /*!< Resolved levels */
+    bool contended[HULP_BUS_NUM_PINS];
+    uint32_t contentions;                   /*!< Times a pin has been driven both high and low */
+    uint32_t dropped_events;                /*!< Events lost to a full queue */
+    uint64_t now_ns;
+    hulp_bus_event_t events[HULP_BUS_MAX_EVENTS];
+    size_t num_events;
+    char names[HULP_BUS_NUM_PINS][16];      /*!< Names in VCD output */
+    FILE* vcd;
+    uint64_t vcd_time_ns;
+};
+
+/**
+ * Range of a measured duration (eg. a clock's high time), for device models' timing reports.
+ */
+typedef struct {
+    uint64_t min_ns;
+    uint64_t max_ns;
+    uint32_t count;
+} hulp_bus_span_t;
+
+/**
+ * Initialise a bus and hook it into sim (call after hulp_sim_init, and after setting sim->periph if required).
+ */
+esp_err_t hulp_bus_init(hulp_bus_t* bus, hulp_sim_t* sim);
+
+/**
+ * Attach a device. Its drives all start released.
+ */
+esp_err_t hulp_bus_attach(hulp_bus_t* bus, hulp_bus_device_t* dev);
+
+/**
+ * Drive a pin from a device at time_ns (no earlier than now).
+ */
+void hulp_bus_drive(hulp_bus_t* bus, hulp_bus_device_t* dev, uint8_t pin, hulp_bus_drive_t drive, uint64_t time_ns);
+
+/**
+ * Call dev->timer with id at time_ns (no earlier than now).
+ */
+void hulp_bus_timer(hulp_bus_t* bus, hulp_bus_device_t* dev, uint32_t id, uint64_t time_ns);
+
+/**
+ * Process events up to time_ns, eg. at the end of a simulation with hulp_sim_time_ns.
+ */
+void hulp_bus_advance(hulp_bus_t* bus, uint64_t time_ns);
+
+/**
+ * Enable the ULP's output on a pin at level, as the SoC does with rtc_gpio_set_direction and rtc_gpio_set_level
+ * before starting a program that only uses I_GPIO_SET on it.
+ */
+void hulp_bus_set_output(hulp_bus_t* bus, uint8_t pin, int level);
+
+/**
+ * Current level of a pin.
+ */
+int hulp_bus_level(const hulp_bus_t* bus, uint8_t pin);
+
+/**
+ * Name a pin in VCD output (default "rtcioN").
+ */
+void hulp_bus_set_name(hulp_bus_t* bus, uint8_t pin, const char* name);
+
+/**
+ * Start writing level changes of all pins as a VCD waveform (timescale 1ns) to f, which remains open.
+ */
+void hulp_bus_vcd_start(hulp_bus_t* bus, FILE* f);
+
+/**
+ * Add a measurement to a span.
+ */
+void hulp_bus_span_add(hulp_bus_span_t* span, uint64_t ns);
+
+/**
+ * Print a span (via printf) as " name min-max ns", with the margin to a spec minimum if spec_min_ns > 0.
+ * Returns false if the minimum is below spec_min_ns.
+ */
+bool hulp_bus_span_print(const char* name, const hulp_bus_span_t* span, uint64_t spec_min_ns);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_BUS_H */
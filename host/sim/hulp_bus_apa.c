@@ -0,0 +1,137 @@
+#include "hulp_bus_apa.h"
+
+#include <string.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "HULP-BUS-APA";
+
+static void hulp_bus_apa_frame(hulp_bus_apa_t* apa, uint64_t time_ns)
+{
+    if(apa->shift == 0xFFFFFFFF)
+    {
+        // End frame
+        apa->led = -1;
+        return;
+    }
+    if((apa->shift >> 29) != 0x7)
+    {
+        ++apa->bad_frames;
+        ESP_LOGW(TAG, "[%s] bad LED frame 0x%08x at %llu ns", __func__, (unsigned)apa->shift, (unsigned long long)time_ns);
+        return;
+    }
+    ++apa->led_frames;
+    if(apa->led >= apa->config.num_leds)
+    {
+        return;
+    }
+    hulp_bus_apa_led_t* led = &apa->leds[apa->led++];
+    led->brightness = (apa->shift >> 24) & 0x1F;
+    led->blue = (apa->shift >> 16) & 0xFF;
+    led->green = (apa->shift >> 8) & 0xFF;
+    led->red = apa->shift & 0xFF;
+    if(apa->led == apa->config.num_leds)
+    {
+        ++apa->updates;
+        apa->busy_ns += time_ns - apa->update_start_ns;
+        apa->busy_bits += 32 + 32 * apa->config.num_leds;
+    }
+}
+
+static void hulp_bus_apa_edge(hulp_bus_t* bus, hulp_bus_device_t* dev, uint8_t pin, int level, uint64_t time_ns)
+{
+    hulp_bus_apa_t* apa = (hulp_bus_apa_t*)dev;
+    if(pin == apa->config.data_pin)
+    {
+        apa->data_change_ns = time_ns;
+        return;
+    }
+    if(!level)
+    {
+        if(apa->clk_rise_ns)
+        {
+            hulp_bus_span_add(&apa->t_high, time_ns - apa->clk_rise_ns);
+        }
+        apa->clk_fall_ns = time_ns;
+        return;
+    }
+
+    if(apa->clk_fall_ns)
+    {
+        hulp_bus_span_add(&apa->t_low, time_ns - apa->clk_fall_ns);
+        if(apa->data_change_ns > apa->clk_fall_ns)
+        {
+            hulp_bus_span_add(&apa->t_su, time_ns - apa->data_change_ns);
+        }
+    }
+    apa->clk_rise_ns = time_ns;
+
+    int bit = hulp_bus_level(bus, apa->config.data_pin);
+    apa->shift = (apa->shift << 1) | bit;
+    if(bit)
+    {
+        apa->zeros = 0;
+    }
+    else if(apa->zeros < 32)
+    {
+        if(apa->zeros++ == 0)
+        {
+            apa->zeros_ns = time_ns;
+        }
+    }
+    if(apa->zeros == 32)
+    {
+        // Start frame (or more zeros after one)
+        apa->update_start_ns = apa->zeros_ns;
+        apa->led = 0;
+        apa->bits = 0;
+        return;
+    }
+    if(apa->led >= 0)
+    {
+        if(++apa->bits == 32)
+        {
+            apa->bits = 0;
+            hulp_bus_apa_frame(apa, time_ns);
+        }
+    }
+}
+
+esp_err_t hulp_bus_apa_attach(hulp_bus_t* bus, hulp_bus_apa_t* apa, const hulp_bus_apa_config_t* config)
+{
+    if(!config || config->clk_pin >= HULP_BUS_NUM_PINS || config->data_pin >= HULP_BUS_NUM_PINS || config->clk_pin == config->data_pin ||
+        config->num_leds == 0 || config->num_leds > HULP_BUS_APA_MAX_LEDS)
+    {
+        ESP_LOGE(TAG, "[%s] invalid arg", __func__);
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(apa, 0, sizeof(*apa));
+    apa->config = *config;
+    apa->led = -1;
+    apa->dev.name = "apa";
+    apa->dev.pins = (1UL << config->clk_pin) | (1UL << config->data_pin);
+    apa->dev.edge = hulp_bus_apa_edge;
+    hulp_bus_set_name(bus, config->clk_pin, "apa_clk");
+    hulp_bus_set_name(bus, config->data_pin, "apa_data");
+    return hulp_bus_attach(bus, &apa->dev);
+}
+
+bool hulp_bus_apa_print(const hulp_bus_apa_t* apa)
+{
+    printf("apa x%u: %u updates, %u LED frames, %u bad frames\n", apa->config.num_leds, (unsigned)apa->updates,
+        (unsigned)apa->led_frames, (unsigned)apa->bad_frames);
+    for(int i = 0; i < apa->config.num_leds; ++i)
+    {
+        const hulp_bus_apa_led_t* led = &apa->leds[i];
+        printf("  [%d] brightness %u, rgb %u,%u,%u\n", i, led->brightness, led->red, led->green, led->blue);
+    }
+    if(apa->busy_ns)
+    {
+        printf("  throughput   %.0f bit/s\n", apa->busy_bits * 1e9 / apa->busy_ns);
+    }
+    bool ok = true;
+    ok &= hulp_bus_span_print("t_high", &apa->t_high, apa->config.t_high_ns);
+    ok &= hulp_bus_span_print("t_low", &apa->t_low, apa->config.t_low_ns);
+    ok &= hulp_bus_span_print("t_su", &apa->t_su, apa->config.t_su_ns);
+    return ok && !apa->bad_frames;
+}
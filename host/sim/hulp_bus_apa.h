@@ -0,0 +1,76 @@
+#ifndef HULP_BUS_APA_H
+#define HULP_BUS_APA_H
+
+#include "hulp_bus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * APA102-style LED chain model, as per M_APA_TX / M_INCLUDE_APA1.
+ *
+ * Data is sampled on each rising clock edge. A start frame (32 zero bits) is followed by a 32-bit frame per LED
+ * (0b111, 5-bit brightness, blue, green, red); frames beyond the chain length, and end frames, are ignored.
+ */
+
+#define HULP_BUS_APA_MAX_LEDS 64
+
+typedef struct {
+    uint8_t clk_pin;            /*!< RTCIO number */
+    uint8_t data_pin;           /*!< RTCIO number */
+    uint8_t num_leds;           /*!< Chain length (up to HULP_BUS_APA_MAX_LEDS) */
+    uint32_t t_high_ns;         /*!< Minimum clock high, to check against */
+    uint32_t t_low_ns;          /*!< Minimum clock low, to check against */
+    uint32_t t_su_ns;           /*!< Minimum data setup to clock rising, to check against */
+} hulp_bus_apa_config_t;
+
+#define HULP_BUS_APA_CONFIG_DEFAULT() {     \
+        .clk_pin = 0,                       \
+        .data_pin = 0,                      \
+        .num_leds = 1,                      \
+        .t_high_ns = 30,                    \
+        .t_low_ns = 30,                     \
+        .t_su_ns = 10                       \
+    }
+
+typedef struct {
+    uint8_t brightness;
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+} hulp_bus_apa_led_t;
+
+typedef struct {
+    hulp_bus_device_t dev;
+    hulp_bus_apa_config_t config;
+    hulp_bus_apa_led_t leds[HULP_BUS_APA_MAX_LEDS];
+    uint32_t shift;
+    uint8_t bits;                   /*!< Bits into the current frame */
+    uint8_t zeros;                  /*!< Consecutive zero bits */
+    int led;                        /*!< LED of the current frame, or -1 outside of an update */
+    uint64_t clk_rise_ns, clk_fall_ns, data_change_ns, zeros_ns, update_start_ns;
+    // Statistics
+    uint32_t updates;               /*!< Times every LED in the chain has been set */
+    uint32_t led_frames;
+    uint32_t bad_frames;            /*!< LED frames without the 0b111 header */
+    uint64_t busy_ns;               /*!< Total start frame to last LED frame time */
+    uint64_t busy_bits;             /*!< Bits of the start and LED frames of each update */
+    hulp_bus_span_t t_high, t_low, t_su;
+} hulp_bus_apa_t;
+
+/**
+ * Initialise a LED chain and attach it to a bus.
+ */
+esp_err_t hulp_bus_apa_attach(hulp_bus_t* bus, hulp_bus_apa_t* apa, const hulp_bus_apa_config_t* config);
+
+/**
+ * Print the LEDs, throughput and timing margins (via printf). Returns false if any timing is violated.
+ */
+bool hulp_bus_apa_print(const hulp_bus_apa_t* apa);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_BUS_APA_H */
@@ -0,0 +1,147 @@
+#include "hulp_bus_hx711.h"
+
+#include <string.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "HULP-BUS-HX711";
+
+#define HULP_BUS_HX711_DOUT_DELAY_NS 100
+#define HULP_BUS_HX711_POWER_DOWN_NS 60000
+#define HULP_BUS_HX711_T_HIGH_MIN_NS 200
+#define HULP_BUS_HX711_T_HIGH_MAX_NS 50000
+#define HULP_BUS_HX711_T_LOW_MIN_NS 200
+
+static void hulp_bus_hx711_dout(hulp_bus_t* bus, hulp_bus_hx711_t* hx711, int level, uint64_t time_ns)
+{
+    hulp_bus_drive(bus, &hx711->dev, hx711->config.dout_pin, level ? HULP_BUS_HIGH : HULP_BUS_LOW, time_ns);
+}
+
+static void hulp_bus_hx711_convert(hulp_bus_t* bus, hulp_bus_hx711_t* hx711, uint64_t time_ns)
+{
+    int32_t value = hx711->config.sample ? hx711->config.sample(hx711->config.arg, hx711->gain) : hx711->config.value;
+    hx711->data = (uint32_t)value & 0xFFFFFF;
+    hx711->ready = true;
+    hx711->pulses = 0;
+    hulp_bus_hx711_dout(bus, hx711, 0, time_ns);
+}
+
+static void hulp_bus_hx711_restart(hulp_bus_t* bus, hulp_bus_hx711_t* hx711, uint64_t time_ns)
+{
+    hx711->ready = false;
+    hulp_bus_hx711_dout(bus, hx711, 1, time_ns);
+    hulp_bus_timer(bus, &hx711->dev, ++hx711->conversion, time_ns + hx711->config.conversion_ns);
+}
+
+static void hulp_bus_hx711_timer(hulp_bus_t* bus, hulp_bus_device_t* dev, uint32_t id, uint64_t time_ns)
+{
+    hulp_bus_hx711_t* hx711 = (hulp_bus_hx711_t*)dev;
+    // Superseded by a later read or power down
+    if(id == hx711->conversion)
+    {
+        hulp_bus_hx711_convert(bus, hx711, time_ns);
+    }
+}
+
+static void hulp_bus_hx711_edge(hulp_bus_t* bus, hulp_bus_device_t* dev, uint8_t pin, int level, uint64_t time_ns)
+{
+    hulp_bus_hx711_t* hx711 = (hulp_bus_hx711_t*)dev;
+    if(!level)
+    {
+        uint64_t high = time_ns - hx711->sck_rise_ns;
+        hx711->sck_fall_ns = time_ns;
+        if(high > HULP_BUS_HX711_POWER_DOWN_NS)
+        {
+            // Powered down, and back up
+            ++hx711->power_downs;
+            hx711->pulses = 0;
+            hx711->gain = HULP_BUS_HX711_A128;
+            hulp_bus_hx711_restart(bus, hx711, time_ns);
+        }
+        else
+        {
+            hulp_bus_span_add(&hx711->t_high, high);
+            hx711->not_ready += hx711->idle_pulse;
+        }
+        hx711->idle_pulse = false;
+        return;
+    }
+
+    if(hx711->sck_fall_ns)
+    {
+        hulp_bus_span_add(&hx711->t_low, time_ns - hx711->sck_fall_ns);
+    }
+    hx711->sck_rise_ns = time_ns;
+    if(hx711->pulses == 0)
+    {
+        if(!hx711->ready)
+        {
+            // Counted when it falls, unless it is a power down
+            hx711->idle_pulse = true;
+            return;
+        }
+        hx711->read_start_ns = time_ns;
+    }
+    if(hx711->pulses < 24)
+    {
+        hulp_bus_hx711_dout(bus, hx711, (hx711->data >> (23 - hx711->pulses)) & 1, time_ns + HULP_BUS_HX711_DOUT_DELAY_NS);
+        ++hx711->pulses;
+        return;
+    }
+    if(hx711->pulses >= HULP_BUS_HX711_A64)
+    {
+        ESP_LOGW(TAG, "[%s] extra pulse at %llu ns", __func__, (unsigned long long)time_ns);
+        return;
+    }
+    if(++hx711->pulses == HULP_BUS_HX711_A128)
+    {
+        ++hx711->reads;
+        hx711->last_read = ((int32_t)(hx711->data << 8)) >> 8;
+        hx711->read_ns += time_ns - hx711->read_start_ns;
+    }
+    hx711->gain = (hulp_bus_hx711_gain_t)hx711->pulses;
+    hulp_bus_hx711_restart(bus, hx711, time_ns + HULP_BUS_HX711_DOUT_DELAY_NS);
+}
+
+esp_err_t hulp_bus_hx711_attach(hulp_bus_t* bus, hulp_bus_hx711_t* hx711, const hulp_bus_hx711_config_t* config)
+{
+    if(!config || config->dout_pin >= HULP_BUS_NUM_PINS || config->sck_pin >= HULP_BUS_NUM_PINS || config->dout_pin == config->sck_pin)
+    {
+        ESP_LOGE(TAG, "[%s] invalid pins", __func__);
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(hx711, 0, sizeof(*hx711));
+    hx711->config = *config;
+    hx711->gain = HULP_BUS_HX711_A128;
+    hx711->dev.name = "hx711";
+    hx711->dev.pins = 1UL << config->sck_pin;
+    hx711->dev.edge = hulp_bus_hx711_edge;
+    hx711->dev.timer = hulp_bus_hx711_timer;
+    hulp_bus_set_name(bus, config->dout_pin, "hx711_dout");
+    hulp_bus_set_name(bus, config->sck_pin, "hx711_sck");
+    esp_err_t err = hulp_bus_attach(bus, &hx711->dev);
+    if(err == ESP_OK)
+    {
+        hulp_bus_hx711_convert(bus, hx711, bus->now_ns);
+    }
+    return err;
+}
+
+bool hulp_bus_hx711_print(const hulp_bus_hx711_t* hx711)
+{
+    printf("hx711: %u reads (last %ld), %u pulses while not ready, %u power downs\n", (unsigned)hx711->reads,
+        (long)hx711->last_read, (unsigned)hx711->not_ready, (unsigned)hx711->power_downs);
+    if(hx711->read_ns)
+    {
+        printf("  throughput   %.0f bit/s\n", hx711->reads * 24 * 1e9 / hx711->read_ns);
+    }
+    bool ok = true;
+    ok &= hulp_bus_span_print("t_high", &hx711->t_high, HULP_BUS_HX711_T_HIGH_MIN_NS);
+    ok &= hulp_bus_span_print("t_low", &hx711->t_low, HULP_BUS_HX711_T_LOW_MIN_NS);
+    if(hx711->t_high.count && hx711->t_high.max_ns > HULP_BUS_HX711_T_HIGH_MAX_NS)
+    {
+        printf("  t_high exceeds %u ns VIOLATION\n", HULP_BUS_HX711_T_HIGH_MAX_NS);
+        ok = false;
+    }
+    return ok && !hx711->not_ready;
+}
@@ -0,0 +1,75 @@
+#ifndef HULP_BUS_HX711_H
+#define HULP_BUS_HX711_H
+
+#include "hulp_bus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * HX711 load cell ADC model, as per M_HX711_READ.
+ *
+ * DOUT goes low when a conversion is ready. Each PD_SCK rising edge shifts out the next bit (MSB first, 0.1us
+ * later); the 25th-27th pulses set the gain of the next conversion and DOUT returns high until it is ready.
+ * PD_SCK held high for more than 60us powers down the HX711, which restarts (gain 128) when it returns low.
+ */
+
+typedef enum {
+    HULP_BUS_HX711_A128 = 25,       /*!< Pulses per read for channel A, gain 128 */
+    HULP_BUS_HX711_B32 = 26,        /*!< Pulses per read for channel B, gain 32 */
+    HULP_BUS_HX711_A64 = 27,        /*!< Pulses per read for channel A, gain 64 */
+} hulp_bus_hx711_gain_t;
+
+typedef struct {
+    uint8_t dout_pin;               /*!< RTCIO number */
+    uint8_t sck_pin;                /*!< RTCIO number */
+    uint32_t conversion_ns;         /*!< Time from a read (or power up) to the next conversion being ready */
+    int32_t value;                  /*!< Conversion result (24-bit), if sample is NULL */
+    int32_t (*sample)(void* arg, hulp_bus_hx711_gain_t gain);   /*!< Optional source of each conversion */
+    void* arg;
+} hulp_bus_hx711_config_t;
+
+#define HULP_BUS_HX711_CONFIG_DEFAULT() {   \
+        .dout_pin = 0,                      \
+        .sck_pin = 0,                       \
+        .conversion_ns = 100000000,         \
+        .value = 0,                         \
+        .sample = NULL,                     \
+        .arg = NULL                         \
+    }
+
+typedef struct {
+    hulp_bus_device_t dev;
+    hulp_bus_hx711_config_t config;
+    bool ready;                     /*!< DOUT low, awaiting a read */
+    uint8_t pulses;                 /*!< PD_SCK pulses into the current read */
+    uint32_t data;                  /*!< Current conversion (24-bit) */
+    hulp_bus_hx711_gain_t gain;     /*!< Of the next conversion */
+    uint32_t conversion;            /*!< Identifies the pending conversion's timer */
+    bool idle_pulse;                /*!< PD_SCK is high while no conversion is ready */
+    uint64_t sck_rise_ns, sck_fall_ns, read_start_ns;
+    // Statistics
+    uint32_t reads;                 /*!< Reads of 25 or more pulses */
+    int32_t last_read;              /*!< Conversion shifted out by the last read */
+    uint32_t not_ready;             /*!< Pulses while no conversion was ready */
+    uint32_t power_downs;
+    uint64_t read_ns;               /*!< Total time from the first to the 25th pulse of reads */
+    hulp_bus_span_t t_high, t_low;
+} hulp_bus_hx711_t;
+
+/**
+ * Initialise a HX711 and attach it to a bus. The first conversion is ready immediately.
+ */
+esp_err_t hulp_bus_hx711_attach(hulp_bus_t* bus, hulp_bus_hx711_t* hx711, const hulp_bus_hx711_config_t* config);
+
+/**
+ * Print reads, throughput and timing margins (via printf). Returns false if any timing is violated.
+ */
+bool hulp_bus_hx711_print(const hulp_bus_hx711_t* hx711);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_BUS_HX711_H */
@@ -0,0 +1,240 @@
+#include "hulp_bus_i2c.h"
+
+#include <string.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "HULP-BUS-I2C";
+
+static void hulp_bus_i2c_sda(hulp_bus_t* bus, hulp_bus_i2c_t* i2c, int level, uint64_t time_ns)
+{
+    hulp_bus_drive(bus, &i2c->dev, i2c->config.sda_pin, level ? HULP_BUS_RELEASE : HULP_BUS_LOW, time_ns);
+}
+
+static void hulp_bus_i2c_load(hulp_bus_t* bus, hulp_bus_i2c_t* i2c, uint64_t time_ns)
+{
+    i2c->shift = i2c->regs[i2c->ptr++];
+    ++i2c->bytes_read;
+    hulp_bus_i2c_sda(bus, i2c, i2c->shift & 0x80, time_ns);
+}
+
+/**
+ * SCL falling: move to the next bit, and drive SDA for it.
+ */
+static void hulp_bus_i2c_clock(hulp_bus_t* bus, hulp_bus_i2c_t* i2c, uint64_t time_ns)
+{
+    if(i2c->bit < 8)
+    {
+        ++i2c->bit;
+        if(i2c->bit < 8)
+        {
+            if(i2c->state == HULP_BUS_I2C_READ)
+            {
+                hulp_bus_i2c_sda(bus, i2c, i2c->shift & (0x80 >> i2c->bit), time_ns);
+            }
+            return;
+        }
+        // Byte complete: ACK or NACK
+        bool ack = true;
+        switch(i2c->state)
+        {
+            case HULP_BUS_I2C_ADDR:
+                ack = ((i2c->shift >> 1) == i2c->config.address);
+                i2c->read = i2c->shift & 1;
+                break;
+            case HULP_BUS_I2C_WRITE:
+                if(!i2c->ptr_set)
+                {
+                    i2c->ptr = i2c->shift;
+                    i2c->ptr_set = true;
+                }
+                else if(i2c->config.nack_data)
+                {
+                    ack = false;
+                }
+                else
+                {
+                    i2c->regs[i2c->ptr++] = i2c->shift;
+                    ++i2c->bytes_written;
+                }
+                break;
+            default:
+                // Master ACKs reads
+                hulp_bus_i2c_sda(bus, i2c, 1, time_ns);
+                return;
+        }
+        if(ack)
+        {
+            hulp_bus_i2c_sda(bus, i2c, 0, time_ns);
+        }
+        else
+        {
+            ++i2c->nacks;
+            i2c->state = HULP_BUS_I2C_IGNORE;
+        }
+        return;
+    }
+
+    // ACK clock complete
+    i2c->bit = 0;
+    i2c->shift = 0;
+    hulp_bus_i2c_sda(bus, i2c, 1, time_ns);
+    switch(i2c->state)
+    {
+        case HULP_BUS_I2C_ADDR:
+            if(i2c->read)
+            {
+                i2c->state = HULP_BUS_I2C_READ;
+                hulp_bus_i2c_load(bus, i2c, time_ns);
+            }
+            else
+            {
+                i2c->state = HULP_BUS_I2C_WRITE;
+                i2c->ptr_set = false;
+            }
+            break;
+        case HULP_BUS_I2C_READ:
+            if(i2c->master_ack)
+            {
+                hulp_bus_i2c_load(bus, i2c, time_ns);
+            }
+            else
+            {
+                i2c->state = HULP_BUS_I2C_IGNORE;
+            }
+            break;
+        default:
+            break;
+    }
+    if(i2c->config.stretch_ns && i2c->state != HULP_BUS_I2C_IGNORE)
+    {
+        ++i2c->stretches;
+        hulp_bus_drive(bus, &i2c->dev, i2c->config.scl_pin, HULP_BUS_LOW, time_ns);
+        hulp_bus_drive(bus, &i2c->dev, i2c->config.scl_pin, HULP_BUS_RELEASE, time_ns + i2c->config.stretch_ns);
+    }
+}
+
+static void hulp_bus_i2c_edge(hulp_bus_t* bus, hulp_bus_device_t* dev, uint8_t pin, int level, uint64_t time_ns)
+{
+    hulp_bus_i2c_t* i2c = (hulp_bus_i2c_t*)dev;
+    bool active = (i2c->state != HULP_BUS_I2C_IDLE);
+    // A STOP may end the ACK clock (bit 8), as per I2CBB's reads
+    bool mid_byte = (i2c->bit != 0 && i2c->bit < 8) && (i2c->state == HULP_BUS_I2C_ADDR || i2c->state == HULP_BUS_I2C_WRITE || i2c->state == HULP_BUS_I2C_READ);
+
+    if(pin == i2c->config.sda_pin)
+    {
+        if(!hulp_bus_level(bus, i2c->config.scl_pin))
+        {
+            i2c->sda_change_ns = time_ns;
+            return;
+        }
+        if(mid_byte)
+        {
+            ++i2c->errors;
+            ESP_LOGW(TAG, "[%s] %s mid-byte at %llu ns", __func__, level ? "STOP" : "START", (unsigned long long)time_ns);
+        }
+        hulp_bus_i2c_sda(bus, i2c, 1, time_ns);
+        if(!level)
+        {
+            // (Repeated) START
+            if(!active)
+            {
+                i2c->start_ns = time_ns;
+            }
+            ++i2c->starts;
+            i2c->state = HULP_BUS_I2C_ADDR;
+            i2c->bit = 0;
+            i2c->shift = 0;
+            i2c->sda_change_ns = time_ns;
+            i2c->after_start = true;
+        }
+        else if(active)
+        {
+            // STOP
+            ++i2c->stops;
+            hulp_bus_span_add(&i2c->t_su_sto, time_ns - i2c->scl_rise_ns);
+            i2c->busy_ns += time_ns - i2c->start_ns;
+            i2c->state = HULP_BUS_I2C_IDLE;
+        }
+        return;
+    }
+
+    // SCL
+    if(level)
+    {
+        if(active)
+        {
+            ++i2c->bits;
+            hulp_bus_span_add(&i2c->t_low, time_ns - i2c->scl_fall_ns);
+            if(i2c->sda_change_ns > i2c->scl_fall_ns)
+            {
+                hulp_bus_span_add(&i2c->t_su_dat, time_ns - i2c->sda_change_ns);
+            }
+            int sda = hulp_bus_level(bus, i2c->config.sda_pin);
+            if(i2c->bit < 8 && (i2c->state == HULP_BUS_I2C_ADDR || i2c->state == HULP_BUS_I2C_WRITE))
+            {
+                i2c->shift = (uint8_t)((i2c->shift << 1) | sda);
+            }
+            else if(i2c->bit == 8 && i2c->state == HULP_BUS_I2C_READ)
+            {
+                i2c->master_ack = !sda;
+            }
+        }
+        i2c->scl_rise_ns = time_ns;
+        return;
+    }
+
+    if(active)
+    {
+        if(i2c->after_start)
+        {
+            hulp_bus_span_add(&i2c->t_hd_sta, time_ns - i2c->sda_change_ns);
+            i2c->after_start = false;
+        }
+        else
+        {
+            hulp_bus_span_add(&i2c->t_high, time_ns - i2c->scl_rise_ns);
+            hulp_bus_i2c_clock(bus, i2c, time_ns);
+        }
+    }
+    i2c->scl_fall_ns = time_ns;
+}
+
+esp_err_t hulp_bus_i2c_attach(hulp_bus_t* bus, hulp_bus_i2c_t* i2c, const hulp_bus_i2c_config_t* config)
+{
+    if(!config || config->scl_pin >= HULP_BUS_NUM_PINS || config->sda_pin >= HULP_BUS_NUM_PINS || config->scl_pin == config->sda_pin)
+    {
+        ESP_LOGE(TAG, "[%s] invalid pins", __func__);
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(i2c, 0, sizeof(*i2c));
+    i2c->config = *config;
+    i2c->dev.name = "i2c";
+    i2c->dev.pins = (1UL << config->scl_pin) | (1UL << config->sda_pin);
+    i2c->dev.edge = hulp_bus_i2c_edge;
+    bus->pull[config->scl_pin] = 1;
+    bus->pull[config->sda_pin] = 1;
+    hulp_bus_set_name(bus, config->scl_pin, "i2c_scl");
+    hulp_bus_set_name(bus, config->sda_pin, "i2c_sda");
+    return hulp_bus_attach(bus, &i2c->dev);
+}
+
+bool hulp_bus_i2c_print(const hulp_bus_i2c_t* i2c)
+{
+    const hulp_bus_i2c_timing_t* timing = &i2c->config.timing;
+    printf("i2c 0x%02x: %u starts, %u stops, %u bytes written, %u bytes read, %u nacks, %u errors, %u stretches\n",
+        i2c->config.address, (unsigned)i2c->starts, (unsigned)i2c->stops, (unsigned)i2c->bytes_written, (unsigned)i2c->bytes_read,
+        (unsigned)i2c->nacks, (unsigned)i2c->errors, (unsigned)i2c->stretches);
+    if(i2c->busy_ns)
+    {
+        printf("  throughput   %.0f bit/s SCL, %.0f bytes/s data\n", i2c->bits * 1e9 / i2c->busy_ns,
+            (i2c->bytes_written + i2c->bytes_read) * 1e9 / i2c->busy_ns);
+    }
+    bool ok = true;
+    ok &= hulp_bus_span_print("t_low", &i2c->t_low, timing->t_low_ns);
+    ok &= hulp_bus_span_print("t_high", &i2c->t_high, timing->t_high_ns);
+    ok &= hulp_bus_span_print("t_su_dat", &i2c->t_su_dat, timing->t_su_dat_ns);
+    ok &= hulp_bus_span_print("t_hd_sta", &i2c->t_hd_sta, timing->t_hd_sta_ns);
+    ok &= hulp_bus_span_print("t_su_sto", &i2c->t_su_sto, timing->t_su_sto_ns);
+    return ok && !i2c->errors;
+}
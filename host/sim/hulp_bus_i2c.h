@@ -0,0 +1,110 @@
+#ifndef HULP_BUS_I2C_H
+#define HULP_BUS_I2C_H
+
+#include "hulp_bus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * I2C slave model with 8-bit sub-addressed registers, as expected by M_INCLUDE_I2CBB.
+ *
+ * Writes: START, address+W, sub-address, data... STOP. Reads: START, address+W, sub-address, (repeated) START,
+ * address+R, data... (master NACKs the last byte), STOP. The sub-address auto-increments.
+ */
+
+/**
+ * Minimum bus timings (ns) to check against. Defaults are fast-mode (400kHz) I2C.
+ */
+typedef struct {
+    uint32_t t_low_ns;          /*!< SCL low */
+    uint32_t t_high_ns;         /*!< SCL high */
+    uint32_t t_su_dat_ns;       /*!< SDA change to SCL rising */
+    uint32_t t_hd_sta_ns;       /*!< (Repeated) START to SCL falling */
+    uint32_t t_su_sto_ns;       /*!< SCL rising to STOP */
+} hulp_bus_i2c_timing_t;
+
+#define HULP_BUS_I2C_TIMING_FAST() {    \
+        .t_low_ns = 1300,               \
+        .t_high_ns = 600,               \
+        .t_su_dat_ns = 100,             \
+        .t_hd_sta_ns = 600,             \
+        .t_su_sto_ns = 600              \
+    }
+
+#define HULP_BUS_I2C_TIMING_STANDARD() {    \
+        .t_low_ns = 4700,                   \
+        .t_high_ns = 4000,                  \
+        .t_su_dat_ns = 250,                 \
+        .t_hd_sta_ns = 4000,                \
+        .t_su_sto_ns = 4000                 \
+    }
+
+typedef struct {
+    uint8_t scl_pin;            /*!< RTCIO number */
+    uint8_t sda_pin;            /*!< RTCIO number */
+    uint8_t address;            /*!< 7-bit slave address */
+    bool nack_data;             /*!< NACK written data bytes */
+    uint32_t stretch_ns;        /*!< Hold SCL low this long after each byte's ACK clock (0 to disable) */
+    hulp_bus_i2c_timing_t timing;
+} hulp_bus_i2c_config_t;
+
+#define HULP_BUS_I2C_CONFIG_DEFAULT() {         \
+        .scl_pin = 0,                           \
+        .sda_pin = 0,                           \
+        .address = 0,                           \
+        .nack_data = false,                     \
+        .stretch_ns = 0,                        \
+        .timing = HULP_BUS_I2C_TIMING_FAST()    \
+    }
+
+typedef enum {
+    HULP_BUS_I2C_IDLE,
+    HULP_BUS_I2C_ADDR,
+    HULP_BUS_I2C_WRITE,
+    HULP_BUS_I2C_READ,
+    HULP_BUS_I2C_IGNORE,
+} hulp_bus_i2c_state_t;
+
+typedef struct {
+    hulp_bus_device_t dev;
+    hulp_bus_i2c_config_t config;
+    uint8_t regs[256];              /*!< Register contents, read and written by the master */
+    hulp_bus_i2c_state_t state;
+    uint8_t bit;                    /*!< Clocks into the current byte (8 is ACK) */
+    uint8_t shift;
+    uint8_t ptr;                    /*!< Sub-address */
+    bool ptr_set;
+    bool read;
+    bool master_ack;
+    bool after_start;               /*!< SCL has not fallen since START */
+    uint64_t scl_rise_ns, scl_fall_ns, sda_change_ns, start_ns;
+    // Statistics
+    uint32_t starts;
+    uint32_t stops;
+    uint32_t bytes_written;         /*!< Data bytes (excluding sub-address) */
+    uint32_t bytes_read;
+    uint32_t nacks;                 /*!< Address or data NACKed by the slave */
+    uint32_t errors;                /*!< STOP/START mid-byte */
+    uint32_t stretches;
+    uint64_t busy_ns;               /*!< Total START to STOP time */
+    uint64_t bits;                  /*!< SCL clocks within transactions */
+    hulp_bus_span_t t_low, t_high, t_su_dat, t_hd_sta, t_su_sto;
+} hulp_bus_i2c_t;
+
+/**
+ * Initialise an I2C slave and attach it to a bus. SCL and SDA are pulled up.
+ */
+esp_err_t hulp_bus_i2c_attach(hulp_bus_t* bus, hulp_bus_i2c_t* i2c, const hulp_bus_i2c_config_t* config);
+
+/**
+ * Print transfers, throughput and timing margins (via printf). Returns false if any timing is violated.
+ */
+bool hulp_bus_i2c_print(const hulp_bus_i2c_t* i2c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_BUS_I2C_H */
@@ -0,0 +1,202 @@
+#include "hulp_bus_uart.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "HULP-BUS-UART";
+
+enum {
+    HULP_BUS_UART_TIMER_RX,     /*!< Stop bit centre of a received frame */
+    HULP_BUS_UART_TIMER_TX,     /*!< Transmit the next byte */
+};
+
+/**
+ * Level of the received frame at time_ns: the line is low from the start bit and toggles at each edge.
+ */
+static int hulp_bus_uart_level_at(const hulp_bus_uart_t* uart, uint64_t time_ns)
+{
+    int level = 0;
+    for(size_t i = 0; i < uart->num_edges && uart->edges_ns[i] <= time_ns; ++i)
+    {
+        level = !level;
+    }
+    return level;
+}
+
+static void hulp_bus_uart_start_frame(hulp_bus_t* bus, hulp_bus_uart_t* uart, uint64_t time_ns)
+{
+    uart->in_frame = true;
+    uart->frame_ns = time_ns;
+    uart->num_edges = 0;
+    hulp_bus_timer(bus, &uart->dev, HULP_BUS_UART_TIMER_RX, time_ns + uart->bit_ns * 19 / 2);
+}
+
+static void hulp_bus_uart_receive(hulp_bus_t* bus, hulp_bus_uart_t* uart)
+{
+    uint64_t centre = uart->frame_ns + uart->bit_ns / 2;
+    if(hulp_bus_uart_level_at(uart, centre))
+    {
+        ++uart->glitches;
+    }
+    else
+    {
+        uint8_t byte = 0;
+        for(int i = 0; i < 8; ++i)
+        {
+            byte |= hulp_bus_uart_level_at(uart, centre + (i + 1) * uart->bit_ns) << i;
+        }
+        if(!hulp_bus_uart_level_at(uart, centre + 9 * uart->bit_ns))
+        {
+            ++uart->framing_errors;
+            ESP_LOGW(TAG, "[%s] framing error at %llu ns", __func__, (unsigned long long)uart->frame_ns);
+        }
+        if(uart->frames++ == 0)
+        {
+            uart->first_frame_ns = uart->frame_ns;
+        }
+        uart->last_frame_end_ns = uart->frame_ns + 10 * uart->bit_ns;
+        if(uart->rx_len < HULP_BUS_UART_RX_SIZE)
+        {
+            uart->rx[uart->rx_len++] = byte;
+        }
+    }
+    uart->in_frame = false;
+
+    // The next start bit may have begun already (ie. the transmitter is fast)
+    if(uart->num_edges > 0 && !hulp_bus_level(bus, (uint8_t)uart->config.rx_pin) &&
+        uart->edges_ns[uart->num_edges - 1] > uart->frame_ns + uart->bit_ns * 17 / 2)
+    {
+        hulp_bus_uart_start_frame(bus, uart, uart->edges_ns[uart->num_edges - 1]);
+    }
+}
+
+static void hulp_bus_uart_transmit(hulp_bus_t* bus, hulp_bus_uart_t* uart, uint64_t time_ns)
+{
+    uint8_t pin = (uint8_t)uart->config.tx_pin;
+    uint8_t byte = uart->config.tx_data[uart->tx_pos++];
+    hulp_bus_drive(bus, &uart->dev, pin, HULP_BUS_LOW, time_ns);
+    for(int i = 0; i < 8; ++i)
+    {
+        hulp_bus_drive(bus, &uart->dev, pin, ((byte >> i) & 1) ? HULP_BUS_HIGH : HULP_BUS_LOW, time_ns + (i + 1) * uart->bit_ns);
+    }
+    hulp_bus_drive(bus, &uart->dev, pin, HULP_BUS_HIGH, time_ns + 9 * uart->bit_ns);
+    if(uart->tx_pos < uart->config.tx_len)
+    {
+        hulp_bus_timer(bus, &uart->dev, HULP_BUS_UART_TIMER_TX, time_ns + 10 * uart->bit_ns + uart->config.tx_gap_ns);
+    }
+}
+
+static void hulp_bus_uart_timer(hulp_bus_t* bus, hulp_bus_device_t* dev, uint32_t id, uint64_t time_ns)
+{
+    hulp_bus_uart_t* uart = (hulp_bus_uart_t*)dev;
+    if(id == HULP_BUS_UART_TIMER_RX)
+    {
+        hulp_bus_uart_receive(bus, uart);
+    }
+    else
+    {
+        hulp_bus_uart_transmit(bus, uart, time_ns);
+    }
+}
+
+static void hulp_bus_uart_edge(hulp_bus_t* bus, hulp_bus_device_t* dev, uint8_t pin, int level, uint64_t time_ns)
+{
+    hulp_bus_uart_t* uart = (hulp_bus_uart_t*)dev;
+    if(!uart->in_frame)
+    {
+        if(!level)
+        {
+            hulp_bus_uart_start_frame(bus, uart, time_ns);
+        }
+        return;
+    }
+    if(uart->num_edges < HULP_BUS_UART_MAX_EDGES)
+    {
+        uart->edges_ns[uart->num_edges++] = time_ns;
+    }
+    // Deviation from the nearest bit boundary within the frame
+    uint64_t offset = time_ns - uart->frame_ns;
+    uint64_t k = (offset + uart->bit_ns / 2) / uart->bit_ns;
+    if(k >= 1 && k <= 9)
+    {
+        uint64_t ideal = k * uart->bit_ns;
+        uint64_t error = (offset > ideal) ? (offset - ideal) : (ideal - offset);
+        if(error > uart->max_error_ns)
+        {
+            uart->max_error_ns = error;
+        }
+    }
+}
+
+esp_err_t hulp_bus_uart_attach(hulp_bus_t* bus, hulp_bus_uart_t* uart, const hulp_bus_uart_config_t* config)
+{
+    if(!config || config->baud == 0 || config->rx_pin >= HULP_BUS_NUM_PINS || config->tx_pin >= HULP_BUS_NUM_PINS ||
+        (config->tx_pin >= 0 && config->tx_len && !config->tx_data))
+    {
+        ESP_LOGE(TAG, "[%s] invalid arg", __func__);
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(uart, 0, sizeof(*uart));
+    uart->config = *config;
+    uart->bit_ns = 1000000000ULL / config->baud;
+    uart->dev.name = "uart";
+    uart->dev.edge = hulp_bus_uart_edge;
+    uart->dev.timer = hulp_bus_uart_timer;
+    if(config->rx_pin >= 0)
+    {
+        uart->dev.pins = 1UL << config->rx_pin;
+        hulp_bus_set_name(bus, (uint8_t)config->rx_pin, "uart_rx");
+    }
+    esp_err_t err = hulp_bus_attach(bus, &uart->dev);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+    if(config->tx_pin >= 0)
+    {
+        hulp_bus_set_name(bus, (uint8_t)config->tx_pin, "uart_tx");
+        hulp_bus_drive(bus, &uart->dev, (uint8_t)config->tx_pin, HULP_BUS_HIGH, bus->now_ns);
+        if(config->tx_len)
+        {
+            hulp_bus_timer(bus, &uart->dev, HULP_BUS_UART_TIMER_TX, config->tx_start_ns);
+        }
+    }
+    return ESP_OK;
+}
+
+bool hulp_bus_uart_print(const hulp_bus_uart_t* uart, float max_error_pct)
+{
+    bool ok = true;
+    if(uart->config.rx_pin >= 0)
+    {
+        printf("uart rx %u baud: %u frames, %u framing errors, %u glitches: \"", (unsigned)uart->config.baud,
+            (unsigned)uart->frames, (unsigned)uart->framing_errors, (unsigned)uart->glitches);
+        for(size_t i = 0; i < uart->rx_len; ++i)
+        {
+            if(isprint(uart->rx[i]))
+            {
+                printf("%c", uart->rx[i]);
+            }
+            else
+            {
+                printf("\\x%02x", uart->rx[i]);
+            }
+        }
+        printf("\"\n");
+        if(uart->frames && uart->last_frame_end_ns > uart->first_frame_ns)
+        {
+            printf("  throughput   %.0f bytes/s\n", uart->frames * 1e9 / (uart->last_frame_end_ns - uart->first_frame_ns));
+        }
+        float error_pct = 100.0f * uart->max_error_ns / uart->bit_ns;
+        printf("  bit error    %llu ns (%.1f%% of bit, sampling margin %.1f%%)%s\n", (unsigned long long)uart->max_error_ns,
+            error_pct, 50.0f - error_pct, (error_pct > max_error_pct) ? " VIOLATION" : "");
+        ok = !uart->framing_errors && !uart->glitches && error_pct <= max_error_pct;
+    }
+    if(uart->config.tx_pin >= 0)
+    {
+        printf("uart tx %u baud: %u of %u bytes sent\n", (unsigned)uart->config.baud, (unsigned)uart->tx_pos, (unsigned)uart->config.tx_len);
+    }
+    return ok;
+}
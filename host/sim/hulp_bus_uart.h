@@ -0,0 +1,78 @@
+#ifndef HULP_BUS_UART_H
+#define HULP_BUS_UART_H
+
+#include "hulp_bus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * UART (8N1) model, as per M_INCLUDE_UART_TX/RX.
+ *
+ * The receiver samples the ULP's TX pin at the ideal bit centres from each start bit, as a hardware UART would, and
+ * measures how far each edge of the frame lies from its ideal position (bit-centre error). With an error of e% of
+ * a bit, the sampling margin is 50 - e%.
+ * The transmitter sends a buffer to the ULP's RX pin from a given time.
+ */
+
+#define HULP_BUS_UART_RX_SIZE 256
+#define HULP_BUS_UART_MAX_EDGES 16
+
+typedef struct {
+    int8_t rx_pin;                  /*!< RTCIO number of the ULP's TX, or -1 for no receiver */
+    int8_t tx_pin;                  /*!< RTCIO number of the ULP's RX, or -1 for no transmitter */
+    uint32_t baud;
+    const uint8_t* tx_data;         /*!< Data to transmit (must remain valid) */
+    size_t tx_len;
+    uint64_t tx_start_ns;           /*!< When to start transmitting */
+    uint32_t tx_gap_ns;             /*!< Idle time between transmitted bytes */
+} hulp_bus_uart_config_t;
+
+#define HULP_BUS_UART_CONFIG_DEFAULT() {    \
+        .rx_pin = -1,                       \
+        .tx_pin = -1,                       \
+        .baud = 9600,                       \
+        .tx_data = NULL,                    \
+        .tx_len = 0,                        \
+        .tx_start_ns = 0,                   \
+        .tx_gap_ns = 0                      \
+    }
+
+typedef struct {
+    hulp_bus_device_t dev;
+    hulp_bus_uart_config_t config;
+    uint64_t bit_ns;
+    // Receiver
+    bool in_frame;
+    uint64_t frame_ns;                              /*!< Start bit falling edge */
+    uint64_t edges_ns[HULP_BUS_UART_MAX_EDGES];     /*!< Edges within the frame (alternating, from low) */
+    size_t num_edges;
+    uint8_t rx[HULP_BUS_UART_RX_SIZE];              /*!< Received bytes */
+    size_t rx_len;
+    uint32_t frames;
+    uint32_t framing_errors;                        /*!< Stop bit sampled low */
+    uint32_t glitches;                              /*!< Start bit high at its centre */
+    uint64_t max_error_ns;                          /*!< Largest edge deviation from its ideal position */
+    uint64_t first_frame_ns;
+    uint64_t last_frame_end_ns;
+    // Transmitter
+    size_t tx_pos;
+} hulp_bus_uart_t;
+
+/**
+ * Initialise a UART and attach it to a bus. The lines idle high.
+ */
+esp_err_t hulp_bus_uart_attach(hulp_bus_t* bus, hulp_bus_uart_t* uart, const hulp_bus_uart_config_t* config);
+
+/**
+ * Print received data, throughput and bit-centre error (via printf). Returns false on any framing error, or if the
+ * bit-centre error is more than max_error_pct of a bit.
+ */
+bool hulp_bus_uart_print(const hulp_bus_uart_t* uart, float max_error_pct);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_BUS_UART_H */
@@ -0,0 +1,471 @@
+#include "hulp_sim.h"
+
+#include <string.h>
+
+#include "esp_log.h"
+#include "soc/rtc_cntl_reg.h"
+#include "soc/rtc_io_reg.h"
+#include "soc/sens_reg.h"
+
+#include "hulp_cfg.h"
+
+static const char* TAG = "HULP-SIM";
+
+#define HULP_SIM_PERIPH_SIZE (HULP_SIM_PERIPH_REGS * sizeof(uint32_t))
+#define HULP_SIM_RTC_GPIO_MASK (RTC_GPIO_OUT_DATA << RTC_GPIO_OUT_DATA_S)
+
+static inline uint32_t hulp_sim_field_mask(uint32_t low, uint32_t high)
+{
+    if(high < low)
+    {
+        return 0;
+    }
+    uint32_t width = high - low + 1;
+    return (width >= 32 ? 0xFFFFFFFF : ((1UL << width) - 1)) << low;
+}
+
+static inline uint32_t hulp_sim_sleep_cyc_reg(uint8_t index)
+{
+    return SENS_ULP_CP_SLEEP_CYC0_REG + index * sizeof(uint32_t);
+}
+
+static inline bool hulp_sim_timer_enabled(hulp_sim_t* sim)
+{
+    return *hulp_sim_reg(sim, RTC_CNTL_STATE0_REG) & RTC_CNTL_ULP_CP_SLP_TIMER_EN;
+}
+
+uint64_t hulp_sim_time_ns(const hulp_sim_t* sim)
+{
+    // Split to avoid overflowing on long simulations
+    return sim->sleep_ns + (sim->cycles / sim->fast_clk_hz) * 1000000000ULL + (sim->cycles % sim->fast_clk_hz) * 1000000000ULL / sim->fast_clk_hz;
+}
+
+uint64_t hulp_sim_rtc_ticks(const hulp_sim_t* sim)
+{
+    uint64_t ns = hulp_sim_time_ns(sim);
+    return (ns / 1000000000ULL) * sim->slow_clk_hz + (ns % 1000000000ULL) * sim->slow_clk_hz / 1000000000ULL;
+}
+
+uint32_t* hulp_sim_reg(hulp_sim_t* sim, uint32_t reg)
+{
+    if(reg < DR_REG_RTCCNTL_BASE || reg >= DR_REG_RTCCNTL_BASE + HULP_SIM_NUM_PERIPHS * HULP_SIM_PERIPH_SIZE || (reg % sizeof(uint32_t)))
+    {
+        return NULL;
+    }
+    uint32_t offset = reg - DR_REG_RTCCNTL_BASE;
+    return &sim->regs[offset / HULP_SIM_PERIPH_SIZE][(offset % HULP_SIM_PERIPH_SIZE) / sizeof(uint32_t)];
+}
+
+uint32_t hulp_sim_reg_read(hulp_sim_t* sim, uint32_t reg)
+{
+    uint32_t* p = hulp_sim_reg(sim, reg);
+    if(!p)
+    {
+        return 0;
+    }
+    if(reg == RTC_GPIO_IN_REG)
+    {
+        uint32_t enable = *hulp_sim_reg(sim, RTC_GPIO_ENABLE_REG) & HULP_SIM_RTC_GPIO_MASK;
+        return (*p & ~enable) | (*hulp_sim_reg(sim, RTC_GPIO_OUT_REG) & enable);
+    }
+    return *p;
+}
+
+void hulp_sim_reg_write(hulp_sim_t* sim, uint32_t reg, uint32_t mask, uint32_t value)
+{
+    uint32_t* p = hulp_sim_reg(sim, reg);
+    if(!p)
+    {
+        return;
+    }
+    uint32_t bits = value & mask;
+    switch(reg)
+    {
+        case RTC_GPIO_OUT_W1TS_REG:
+            *hulp_sim_reg(sim, RTC_GPIO_OUT_REG) |= bits & HULP_SIM_RTC_GPIO_MASK;
+            break;
+        case RTC_GPIO_OUT_W1TC_REG:
+            *hulp_sim_reg(sim, RTC_GPIO_OUT_REG) &= ~(bits & HULP_SIM_RTC_GPIO_MASK);
+            break;
+        case RTC_GPIO_ENABLE_W1TS_REG:
+            *hulp_sim_reg(sim, RTC_GPIO_ENABLE_REG) |= bits & HULP_SIM_RTC_GPIO_MASK;
+            break;
+        case RTC_GPIO_ENABLE_W1TC_REG:
+            *hulp_sim_reg(sim, RTC_GPIO_ENABLE_REG) &= ~(bits & HULP_SIM_RTC_GPIO_MASK);
+            break;
+        case RTC_GPIO_STATUS_W1TS_REG:
+            *hulp_sim_reg(sim, RTC_GPIO_STATUS_REG) |= bits & HULP_SIM_RTC_GPIO_MASK;
+            break;
+        case RTC_GPIO_STATUS_W1TC_REG:
+            *hulp_sim_reg(sim, RTC_GPIO_STATUS_REG) &= ~(bits & HULP_SIM_RTC_GPIO_MASK);
+            break;
+        case RTC_CNTL_TIME_UPDATE_REG:
+            *p = (*p & ~mask) | bits;
+            if(bits & RTC_CNTL_TIME_UPDATE)
+            {
+                uint64_t ticks = hulp_sim_rtc_ticks(sim);
+                *hulp_sim_reg(sim, RTC_CNTL_TIME0_REG) = (uint32_t)ticks;
+                *hulp_sim_reg(sim, RTC_CNTL_TIME1_REG) = (uint32_t)(ticks >> 32) & RTC_CNTL_TIME_HI;
+                *p = (*p & ~RTC_CNTL_TIME_UPDATE) | RTC_CNTL_TIME_VALID;
+            }
+            break;
+        default:
+            *p = (*p & ~mask) | bits;
+            break;
+    }
+}
+
+static uint32_t hulp_sim_periph_read(hulp_sim_t* sim, uint32_t reg)
+{
+    return sim->periph.read ? sim->periph.read(sim, sim->periph.arg, reg) : hulp_sim_reg_read(sim, reg);
+}
+
+static void hulp_sim_periph_write(hulp_sim_t* sim, uint32_t reg, uint32_t mask, uint32_t value)
+{
+    if(sim->periph.write)
+    {
+        sim->periph.write(sim, sim->periph.arg, reg, mask, value);
+    }
+    else
+    {
+        hulp_sim_reg_write(sim, reg, mask, value);
+    }
+}
+
+static inline uint32_t hulp_sim_insn_reg(const ulp_insn_t* insn)
+{
+    // As per I_RD_REG/I_WR_REG: 4-byte address within the peripheral selected
+    return DR_REG_RTCCNTL_BASE + insn->rd_reg.periph_sel * HULP_SIM_PERIPH_SIZE + insn->rd_reg.addr * sizeof(uint32_t);
+}
+
+static void hulp_sim_alu(hulp_sim_t* sim, uint8_t sel, uint8_t dreg, uint16_t a, uint16_t b)
+{
+    uint32_t result;
+    bool overflow = false;
+    switch(sel)
+    {
+        case ALU_SEL_ADD:
+            result = (uint32_t)a + b;
+            overflow = result > 0xFFFF;
+            break;
+        case ALU_SEL_SUB:
+            result = (uint32_t)a - b;
+            overflow = a < b;
+            break;
+        case ALU_SEL_AND:
+            result = a & b;
+            break;
+        case ALU_SEL_OR:
+            result = a | b;
+            break;
+        case ALU_SEL_MOV:
+            result = b;
+            break;
+        case ALU_SEL_LSH:
+            result = (b < 16) ? ((uint32_t)a << b) : 0;
+            break;
+        case ALU_SEL_RSH:
+            result = (b < 16) ? (a >> b) : 0;
+            break;
+        default:
+            result = 0;
+            break;
+    }
+    sim->reg[dreg] = (uint16_t)result;
+    sim->zero = (sim->reg[dreg] == 0);
+    sim->overflow = overflow;
+}
+
+static bool hulp_sim_branch(hulp_sim_t* sim, const ulp_insn_t* insn, uint16_t* next)
+{
+    bool taken;
+    switch(insn->b.sub_opcode)
+    {
+        case SUB_OPCODE_BX:
+            switch(insn->bx.type)
+            {
+                case BX_JUMP_TYPE_DIRECT:
+                    taken = true;
+                    break;
+                case BX_JUMP_TYPE_ZERO:
+                    taken = sim->zero;
+                    break;
+                case BX_JUMP_TYPE_OVF:
+                    taken = sim->overflow;
+                    break;
+                default:
+                    return false;
+            }
+            if(taken)
+            {
+                *next = insn->bx.reg ? sim->reg[insn->bx.dreg] : insn->bx.addr;
+            }
+            return true;
+        case SUB_OPCODE_BR:
+            taken = (insn->b.cmp == B_CMP_L) ? (sim->reg[R0] < insn->b.imm) : (sim->reg[R0] >= insn->b.imm);
+            if(taken)
+            {
+                *next = insn->b.sign ? sim->pc - insn->b.offset : sim->pc + insn->b.offset;
+            }
+            return true;
+        case SUB_OPCODE_BS:
+            switch(insn->bs.cmp)
+            {
+                case JUMPS_LT:
+                    taken = sim->stage < insn->bs.imm;
+                    break;
+                case JUMPS_GE:
+                    taken = sim->stage >= insn->bs.imm;
+                    break;
+                case JUMPS_LE:
+                    taken = sim->stage <= insn->bs.imm;
+                    break;
+                default:
+                    return false;
+            }
+            if(taken)
+            {
+                *next = insn->bs.sign ? sim->pc - insn->bs.offset : sim->pc + insn->bs.offset;
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Execute the instruction at sim->pc. Returns false if it is invalid.
+ */
+static bool hulp_sim_execute(hulp_sim_t* sim, const ulp_insn_t* insn, bool* halted)
+{
+    uint16_t next = sim->pc + 1;
+    uint32_t reg, mask, addr;
+    switch(insn->b.opcode)
+    {
+        case OPCODE_WR_REG:
+            mask = hulp_sim_field_mask(insn->wr_reg.low, insn->wr_reg.high);
+            hulp_sim_periph_write(sim, hulp_sim_insn_reg(insn), mask, ((uint32_t)insn->wr_reg.data << insn->wr_reg.low) & mask);
+            break;
+        case OPCODE_RD_REG:
+            reg = hulp_sim_periph_read(sim, hulp_sim_insn_reg(insn));
+            sim->reg[R0] = (uint16_t)((reg & hulp_sim_field_mask(insn->rd_reg.low, insn->rd_reg.high)) >> insn->rd_reg.low);
+            break;
+        case OPCODE_I2C:
+            reg = sim->periph.i2c ? sim->periph.i2c(sim, sim->periph.arg, insn->i2c.i2c_sel, insn->i2c.i2c_addr,
+                insn->i2c.rw == SUB_OPCODE_I2C_WR, insn->i2c.data) : 0xFF;
+            if(insn->i2c.rw == SUB_OPCODE_I2C_RD)
+            {
+                mask = hulp_sim_field_mask(insn->i2c.low_bits, insn->i2c.high_bits);
+                sim->reg[R0] = (uint16_t)((reg & mask) >> insn->i2c.low_bits);
+            }
+            break;
+        case OPCODE_DELAY:
+            break;
+        case OPCODE_ADC:
+            sim->reg[insn->adc.dreg] = sim->periph.adc ? sim->periph.adc(sim, sim->periph.arg, insn->adc.sar_sel, insn->adc.mux - 1) : 0;
+            break;
+        case OPCODE_ST:
+            if(insn->st.sub_opcode != SUB_OPCODE_ST)
+            {
+                return false;
+            }
+            // Upper half-word as per ulp_var_t: PC of the ST and the address register
+            addr = (sim->reg[insn->st.sreg] + insn->st.offset) % HULP_SIM_MEM_WORDS;
+            sim->mem[addr] = ((uint32_t)sim->pc << 21) | ((uint32_t)insn->st.sreg << 16) | sim->reg[insn->st.dreg];
+            break;
+        case OPCODE_LD:
+            addr = (sim->reg[insn->ld.sreg] + insn->ld.offset) % HULP_SIM_MEM_WORDS;
+            sim->reg[insn->ld.dreg] = (uint16_t)sim->mem[addr];
+            break;
+        case OPCODE_ALU:
+            switch(insn->alu_reg.sub_opcode)
+            {
+                case SUB_OPCODE_ALU_REG:
+                    // MOVE Rdst, Rsrc takes its operand from sreg
+                    hulp_sim_alu(sim, insn->alu_reg.sel, insn->alu_reg.dreg, sim->reg[insn->alu_reg.sreg],
+                        sim->reg[(insn->alu_reg.sel == ALU_SEL_MOV) ? insn->alu_reg.sreg : insn->alu_reg.treg]);
+                    break;
+                case SUB_OPCODE_ALU_IMM:
+                    hulp_sim_alu(sim, insn->alu_imm.sel, insn->alu_imm.dreg, sim->reg[insn->alu_imm.sreg], insn->alu_imm.imm);
+                    break;
+                case SUB_OPCODE_ALU_CNT:
+                    switch(insn->alu_reg_s.sel)
+                    {
+                        case ALU_SEL_SINC:
+                            sim->stage += insn->alu_reg_s.imm;
+                            break;
+                        case ALU_SEL_SDEC:
+                            sim->stage -= insn->alu_reg_s.imm;
+                            break;
+                        case ALU_SEL_SRST:
+                            sim->stage = 0;
+                            break;
+                        default:
+                            return false;
+                    }
+                    break;
+                default:
+                    return false;
+            }
+            break;
+        case OPCODE_BRANCH:
+            if(!hulp_sim_branch(sim, insn, &next))
+            {
+                return false;
+            }
+            break;
+        case OPCODE_END:
+            if(insn->end.sub_opcode == SUB_OPCODE_END)
+            {
+                if(insn->end.wakeup)
+                {
+                    ++sim->wakeups;
+                    if(sim->periph.wake)
+                    {
+                        sim->periph.wake(sim, sim->periph.arg);
+                    }
+                }
+            }
+            else if(insn->sleep.sub_opcode == SUB_OPCODE_SLEEP && insn->sleep.cycle_sel < HULP_SIM_NUM_SLEEP_CYC)
+            {
+                sim->sleep_sel = insn->sleep.cycle_sel;
+            }
+            else
+            {
+                return false;
+            }
+            break;
+        case OPCODE_TSENS:
+            sim->reg[insn->tsens.dreg] = sim->periph.tsens ? sim->periph.tsens(sim, sim->periph.arg) : 0;
+            break;
+        case OPCODE_HALT:
+            *halted = true;
+            break;
+        default:
+            return false;
+    }
+    sim->pc = next % HULP_SIM_MEM_WORDS;
+    return true;
+}
+
+hulp_sim_stop_t hulp_sim_run(hulp_sim_t* sim, uint32_t max_cycles)
+{
+    uint32_t run_cycles = 0;
+    bool halted = false;
+    while(!halted)
+    {
+        if(run_cycles >= max_cycles)
+        {
+            return HULP_SIM_CYCLE_LIMIT;
+        }
+        uint16_t pc = sim->pc;
+        const ulp_insn_t* insn = (const ulp_insn_t*)&sim->mem[pc];
+        // Counted before executing, so that callbacks see the time at the end of the instruction
+        uint32_t cycles = hulp_cfg_get_cycles(insn);
+        sim->cycles += cycles;
+        run_cycles += cycles;
+        sim->last_cycles += cycles;
+        if(sim->last_cycles > sim->max_cycles)
+        {
+            sim->max_cycles = sim->last_cycles;
+        }
+        if(sim->profile)
+        {
+            sim->profile[pc] += cycles;
+        }
+        if(!hulp_sim_execute(sim, insn, &halted))
+        {
+            ESP_LOGE(TAG, "[%s] invalid instruction 0x%08x at pc %u", __func__, (unsigned)insn->instruction, pc);
+            return HULP_SIM_ERROR;
+        }
+    }
+    return HULP_SIM_HALT;
+}
+
+hulp_sim_stop_t hulp_sim_start(hulp_sim_t* sim, uint16_t entry_pc, uint32_t max_cycles)
+{
+    hulp_sim_reg_write(sim, RTC_CNTL_STATE0_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN, RTC_CNTL_ULP_CP_SLP_TIMER_EN);
+    sim->entry_pc = entry_pc % HULP_SIM_MEM_WORDS;
+    hulp_sim_reg_write(sim, SENS_SAR_START_FORCE_REG, SENS_PC_INIT_M, (uint32_t)sim->entry_pc << SENS_PC_INIT_S);
+    sim->pc = sim->entry_pc;
+    sim->last_cycles = 0;
+    ++sim->runs;
+    return hulp_sim_run(sim, max_cycles);
+}
+
+hulp_sim_stop_t hulp_sim_wake(hulp_sim_t* sim, uint32_t max_cycles)
+{
+    if(!hulp_sim_timer_enabled(sim))
+    {
+        return HULP_SIM_TIMER_OFF;
+    }
+    // The period starts once the ULP halts
+    uint32_t sleep_cycles = *hulp_sim_reg(sim, hulp_sim_sleep_cyc_reg(sim->sleep_sel));
+    sim->sleep_ns += (uint64_t)sleep_cycles * 1000000000ULL / sim->slow_clk_hz;
+    // The program may have moved its entry point (M_SET_ENTRY)
+    sim->entry_pc = (*hulp_sim_reg(sim, SENS_SAR_START_FORCE_REG) >> SENS_PC_INIT_S) & SENS_PC_INIT_V;
+    sim->pc = sim->entry_pc;
+    sim->last_cycles = 0;
+    ++sim->runs;
+    return hulp_sim_run(sim, max_cycles);
+}
+
+esp_err_t hulp_sim_set_wakeup_period(hulp_sim_t* sim, size_t period_index, uint32_t period_us)
+{
+    if(period_index >= HULP_SIM_NUM_SLEEP_CYC)
+    {
+        ESP_LOGE(TAG, "[%s] invalid period index %u", __func__, (unsigned)period_index);
+        return ESP_ERR_INVALID_ARG;
+    }
+    *hulp_sim_reg(sim, hulp_sim_sleep_cyc_reg(period_index)) = (uint32_t)((uint64_t)period_us * sim->slow_clk_hz / 1000000);
+    return ESP_OK;
+}
+
+esp_err_t hulp_sim_load(hulp_sim_t* sim, uint32_t load_addr, const ulp_insn_t* program, size_t num_words)
+{
+    if(load_addr > HULP_SIM_MEM_WORDS || num_words > HULP_SIM_MEM_WORDS - load_addr)
+    {
+        ESP_LOGE(TAG, "[%s] %u words at %u exceed RTC_SLOW_MEM", __func__, (unsigned)num_words, (unsigned)load_addr);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    for(size_t i = 0; i < num_words; ++i)
+    {
+        sim->mem[load_addr + i] = program[i].instruction;
+    }
+    return ESP_OK;
+}
+
+esp_err_t hulp_sim_init(hulp_sim_t* sim, const hulp_sim_config_t* config)
+{
+    const hulp_sim_config_t default_config = HULP_SIM_CONFIG_DEFAULT();
+    if(!config)
+    {
+        config = &default_config;
+    }
+    if(!sim || config->fast_clk_hz == 0 || config->slow_clk_hz == 0)
+    {
+        ESP_LOGE(TAG, "[%s] invalid arg", __func__);
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(sim, 0, sizeof(*sim));
+    sim->fast_clk_hz = config->fast_clk_hz;
+    sim->slow_clk_hz = config->slow_clk_hz;
+    return hulp_sim_set_wakeup_period(sim, 0, config->period_us);
+}
+
+const char* hulp_sim_stop_name(hulp_sim_stop_t stop)
+{
+    switch(stop)
+    {
+        case HULP_SIM_HALT:
+            return "halt";
+        case HULP_SIM_CYCLE_LIMIT:
+            return "cycle limit";
+        case HULP_SIM_TIMER_OFF:
+            return "timer off";
+        case HULP_SIM_ERROR:
+            return "error";
+        default:
+            return "?";
+    }
+}
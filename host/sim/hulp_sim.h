@@ -0,0 +1,162 @@
+#ifndef HULP_SIM_H
+#define HULP_SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hulp_compat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Host simulator of the ESP32 ULP FSM coprocessor.
+ *
+ * Executes encoded instructions from a simulated RTC_SLOW_MEM with per-instruction cycle counts (as per
+ * hulp_cfg_get_cycles), so that programs can be run, profiled and regression-tested without hardware.
+ * RD_REG/WR_REG access a pluggable peripheral map (hulp_sim_periph_t), backed by default with an in-memory
+ * register file which models the RTC GPIO set/clear registers, the RTC timer and the ULP sleep timer.
+ *
+ * Time only advances with executed cycles and timer sleeps; the SoC side is whatever the caller does between runs
+ * (eg. reading sim->mem from the periph.wake callback).
+ */
+
+#define HULP_SIM_MEM_WORDS 2048
+#define HULP_SIM_NUM_PERIPHS 4
+#define HULP_SIM_PERIPH_REGS 256
+#define HULP_SIM_NUM_SLEEP_CYC 5
+
+typedef enum {
+    HULP_SIM_HALT,          /*!< Program halted (I_HALT) */
+    HULP_SIM_CYCLE_LIMIT,   /*!< Cycle limit reached before halting */
+    HULP_SIM_TIMER_OFF,     /*!< ULP timer is disabled (eg. I_END), so it will not wake again */
+    HULP_SIM_ERROR,         /*!< Invalid instruction or PC; see sim->pc */
+} hulp_sim_stop_t;
+
+typedef struct hulp_sim hulp_sim_t;
+
+/**
+ * Peripherals of the simulator. Any callback may be NULL.
+ *
+ * read/write: RD_REG/WR_REG, with reg as the SoC address (eg. RTC_GPIO_IN_REG). write's mask covers the
+ *  instruction's bit field and value is already shifted into it. NULL for the default register file
+ *  (hulp_sim_reg_read/hulp_sim_reg_write), which models can also delegate to.
+ * i2c: I_I2C_RW. Returns the byte read (ignored for writes). If NULL, reads return 0xFF.
+ * adc, tsens: I_ADC, I_TSENS. Return the conversion result. If NULL, 0.
+ * wake: I_WAKE, ie. the SoC is woken.
+ */
+typedef struct {
+    uint32_t (*read)(hulp_sim_t* sim, void* arg, uint32_t reg);
+    void (*write)(hulp_sim_t* sim, void* arg, uint32_t reg, uint32_t mask, uint32_t value);
+    uint8_t (*i2c)(hulp_sim_t* sim, void* arg, uint8_t slave_sel, uint8_t sub_addr, bool write, uint8_t data);
+    uint16_t (*adc)(hulp_sim_t* sim, void* arg, uint8_t adc_idx, uint8_t pad_idx);
+    uint16_t (*tsens)(hulp_sim_t* sim, void* arg);
+    void (*wake)(hulp_sim_t* sim, void* arg);
+    void* arg;
+} hulp_sim_periph_t;
+
+typedef struct {
+    uint32_t fast_clk_hz;       /*!< RTC_FAST_CLK, eg. hulp_get_fast_clk_freq() */
+    uint32_t slow_clk_hz;       /*!< RTC_SLOW_CLK, for the ULP timer and RTC ticks */
+    uint32_t period_us;         /*!< ULP wakeup period (SENS_ULP_CP_SLEEP_CYC0_REG) */
+} hulp_sim_config_t;
+
+#define HULP_SIM_CONFIG_DEFAULT() {     \
+        .fast_clk_hz = 8500000,         \
+        .slow_clk_hz = 150000,          \
+        .period_us = 100000             \
+    }
+
+struct hulp_sim {
+    uint32_t mem[HULP_SIM_MEM_WORDS];   /*!< RTC_SLOW_MEM */
+    uint32_t regs[HULP_SIM_NUM_PERIPHS][HULP_SIM_PERIPH_REGS]; /*!< Default register file: RTC_CNTL, RTC_IO, SENS, RTC_I2C */
+    uint16_t reg[4];                    /*!< R0-R3 */
+    uint16_t pc;
+    uint8_t stage;                      /*!< Stage counter */
+    bool zero;                          /*!< ALU zero flag */
+    bool overflow;                      /*!< ALU overflow flag */
+    uint8_t sleep_sel;                  /*!< Sleep cycle register selected by I_SLEEP_CYCLE_SEL */
+    uint16_t entry_pc;                  /*!< Where the ULP timer starts the program */
+    uint32_t fast_clk_hz;
+    uint32_t slow_clk_hz;
+    uint64_t cycles;                    /*!< Total cycles executed */
+    uint64_t sleep_ns;                  /*!< Total time spent halted */
+    uint32_t runs;                      /*!< Number of times the program has been started */
+    uint32_t wakeups;                   /*!< Number of I_WAKE executed */
+    uint32_t last_cycles;               /*!< Cycles of the last run */
+    uint32_t max_cycles;                /*!< Most cycles of any run */
+    uint64_t* profile;                  /*!< Optional (HULP_SIM_MEM_WORDS): cycles spent at each PC are added here */
+    hulp_sim_periph_t periph;
+};
+
+/**
+ * Initialise a simulator: memory and registers are cleared, and the wakeup period is set.
+ * config: NULL for HULP_SIM_CONFIG_DEFAULT()
+ * The struct is large (~20KB), so prefer static or heap allocation.
+ */
+esp_err_t hulp_sim_init(hulp_sim_t* sim, const hulp_sim_config_t* config);
+
+/**
+ * Copy a processed program (no macros), or any other words, into the simulated RTC_SLOW_MEM.
+ * load_addr: in words
+ */
+esp_err_t hulp_sim_load(hulp_sim_t* sim, uint32_t load_addr, const ulp_insn_t* program, size_t num_words);
+
+/**
+ * Set one of the ULP sleep cycle registers, as per ulp_set_wakeup_period.
+ */
+esp_err_t hulp_sim_set_wakeup_period(hulp_sim_t* sim, size_t period_index, uint32_t period_us);
+
+/**
+ * Enable the ULP timer and run the program from entry_pc immediately, as per ulp_run.
+ * max_cycles: give up after this many cycles if the program has not halted
+ */
+hulp_sim_stop_t hulp_sim_start(hulp_sim_t* sim, uint16_t entry_pc, uint32_t max_cycles);
+
+/**
+ * Sleep for the selected wakeup period, then run the program again from its entry point.
+ * Returns HULP_SIM_TIMER_OFF without advancing time if the ULP timer is disabled.
+ */
+hulp_sim_stop_t hulp_sim_wake(hulp_sim_t* sim, uint32_t max_cycles);
+
+/**
+ * Run from the current PC until halted or max_cycles have elapsed. Cycles are counted towards the current run.
+ */
+hulp_sim_stop_t hulp_sim_run(hulp_sim_t* sim, uint32_t max_cycles);
+
+/**
+ * Simulated time (in ns) since hulp_sim_init: cycles executed at fast_clk_hz plus time asleep.
+ */
+uint64_t hulp_sim_time_ns(const hulp_sim_t* sim);
+
+/**
+ * RTC timer (RTC_SLOW_CLK ticks) at the current simulated time.
+ */
+uint64_t hulp_sim_rtc_ticks(const hulp_sim_t* sim);
+
+/**
+ * Access the default register file by SoC address (eg. RTC_GPIO_IN_REG), NULL if out of range.
+ * Writes through this pointer have no side effects, so use it to set inputs.
+ */
+uint32_t* hulp_sim_reg(hulp_sim_t* sim, uint32_t reg);
+
+/**
+ * Default register file read/write, as used by RD_REG/WR_REG if periph.read/write are NULL.
+ * Writes to the RTC GPIO W1TS/W1TC registers set/clear OUT, ENABLE and STATUS, and RTC_CNTL_TIME_UPDATE latches
+ * the RTC timer into RTC_CNTL_TIME0/1_REG. RTC_GPIO_IN_REG reads enabled outputs as driven.
+ */
+uint32_t hulp_sim_reg_read(hulp_sim_t* sim, uint32_t reg);
+void hulp_sim_reg_write(hulp_sim_t* sim, uint32_t reg, uint32_t mask, uint32_t value);
+
+/**
+ * Get the name of a stop reason, eg. for printing.
+ */
+const char* hulp_sim_stop_name(hulp_sim_stop_t stop);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_SIM_H */
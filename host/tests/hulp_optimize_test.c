@@ -0,0 +1,318 @@
+/**
+ * Equivalence tests of hulp_optimize_program.
+ *
+ * Each case is run in the simulator before and after optimisation, from its first instruction and from each of its
+ * entry labels, with several initial register values. The runs must stop the same way with the same registers, stage
+ * count, RTC IO registers and data memory. Each case also checks that the pass it covers made the expected savings.
+ *
+ * Exits with 1 if any case fails.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "soc/rtc_io_reg.h"
+
+#include "hulp.h"
+#include "hulp_optimize.h"
+
+#include "hulp_sim.h"
+
+#define TEST_MAX_WORDS 64           // Programs are loaded below TEST_DATA_BASE
+#define TEST_DATA_BASE TEST_MAX_WORDS
+#define TEST_MAX_CYCLES 100000
+#define TEST_MAX_ENTRIES 4
+
+enum {
+    LBL_A,
+    LBL_B,
+    LBL_C,
+    LBL_TASK,
+    LBL_UNUSED,
+};
+
+typedef struct {
+    const char* name;
+    const ulp_insn_t* program;
+    size_t num_entries;
+    hulp_optimize_config_t config;
+    uint16_t entry_labels[TEST_MAX_ENTRIES];    /*!< Also run from these labels, besides the first instruction */
+    size_t num_entry_labels;
+    size_t min_rewrites;
+    size_t words_saved;
+} test_case_t;
+
+static const uint16_t s_initial_regs[][4] = {
+    {0, 0, 0, 0},
+    {7, 3, 1, 2},
+    {0xFFFF, 0, 0x8000, 5},
+};
+
+static hulp_sim_t s_sim[2];
+
+typedef struct {
+    ulp_insn_t program[TEST_MAX_WORDS * 2];
+    size_t num_entries;
+    ulp_insn_t words[TEST_MAX_WORDS];
+    size_t num_words;
+    hulp_program_index_t index;
+} test_program_t;
+
+static esp_err_t test_program_init(test_program_t* prog, const ulp_insn_t* program, size_t num_entries)
+{
+    if(num_entries > sizeof(prog->program) / sizeof(ulp_insn_t))
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(prog->program, program, num_entries * sizeof(ulp_insn_t));
+    prog->num_entries = num_entries;
+    return ESP_OK;
+}
+
+static esp_err_t test_program_assemble(test_program_t* prog)
+{
+    prog->num_words = prog->num_entries;
+    esp_err_t err = hulp_process_macros(prog->words, TEST_MAX_WORDS, prog->program, &prog->num_words);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+    return hulp_program_index_init(&prog->index, prog->program, prog->num_entries);
+}
+
+static hulp_sim_stop_t test_run(hulp_sim_t* sim, const test_program_t* prog, uint16_t entry_pc, const uint16_t* regs)
+{
+    hulp_sim_init(sim, NULL);
+    hulp_sim_load(sim, 0, prog->words, prog->num_words);
+    memcpy(sim->reg, regs, sizeof(sim->reg));
+    return hulp_sim_start(sim, entry_pc, TEST_MAX_CYCLES);
+}
+
+/**
+ * Compare the two runs. Stored words carry the PC of the ST in their upper half, which moves as words are removed.
+ */
+static bool test_same_state(const hulp_sim_t* a, const hulp_sim_t* b, const char** what)
+{
+    if(memcmp(a->reg, b->reg, sizeof(a->reg)))
+    {
+        *what = "registers";
+        return false;
+    }
+    if(a->stage != b->stage)
+    {
+        *what = "stage count";
+        return false;
+    }
+    if(memcmp(a->regs[1], b->regs[1], sizeof(a->regs[1])))
+    {
+        *what = "RTC IO registers";
+        return false;
+    }
+    for(size_t i = TEST_DATA_BASE; i < HULP_SIM_MEM_WORDS; ++i)
+    {
+        if((a->mem[i] & 0xFFFF) != (b->mem[i] & 0xFFFF))
+        {
+            *what = "data memory";
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_run_case(const test_case_t* tc)
+{
+    static test_program_t original, optimised;
+    hulp_optimize_stats_t stats;
+
+    if(test_program_init(&original, tc->program, tc->num_entries) != ESP_OK ||
+        test_program_init(&optimised, tc->program, tc->num_entries) != ESP_OK ||
+        hulp_optimize_program(optimised.program, &optimised.num_entries, &tc->config, &stats) != ESP_OK ||
+        test_program_assemble(&original) != ESP_OK || test_program_assemble(&optimised) != ESP_OK)
+    {
+        printf("%s: failed to optimise or assemble\n", tc->name);
+        return false;
+    }
+
+    bool pass = true;
+    if(stats.rewrites < tc->min_rewrites || stats.words_saved != tc->words_saved)
+    {
+        printf("%s: %u rewrites, %u words saved; expected at least %u, %u\n", tc->name, (unsigned)stats.rewrites,
+            (unsigned)stats.words_saved, (unsigned)tc->min_rewrites, (unsigned)tc->words_saved);
+        pass = false;
+    }
+    if(original.num_words - optimised.num_words != stats.words_saved)
+    {
+        printf("%s: %u words removed, but %u reported\n", tc->name, (unsigned)(original.num_words - optimised.num_words),
+            (unsigned)stats.words_saved);
+        pass = false;
+    }
+
+    bool same = true;
+    for(size_t e = 0; e <= tc->num_entry_labels && same; ++e)
+    {
+        uint16_t entry[2] = {0, 0};
+        if(e > 0 && (hulp_program_index_find_pc(&original.index, tc->entry_labels[e - 1], &entry[0]) != ESP_OK ||
+            hulp_program_index_find_pc(&optimised.index, tc->entry_labels[e - 1], &entry[1]) != ESP_OK))
+        {
+            printf("%s: entry label %u not found\n", tc->name, tc->entry_labels[e - 1]);
+            same = false;
+            break;
+        }
+        for(size_t r = 0; r < sizeof(s_initial_regs) / sizeof(s_initial_regs[0]); ++r)
+        {
+            hulp_sim_stop_t stop[2] = {
+                test_run(&s_sim[0], &original, entry[0], s_initial_regs[r]),
+                test_run(&s_sim[1], &optimised, entry[1], s_initial_regs[r]),
+            };
+            const char* what = "stop reason";
+            if(stop[0] != HULP_SIM_HALT || stop[0] != stop[1] || !test_same_state(&s_sim[0], &s_sim[1], &what))
+            {
+                printf("%s: from pc %u (optimised %u), registers set %u: %s differs (%s, %s)\n", tc->name, entry[0], entry[1],
+                    (unsigned)r, what, hulp_sim_stop_name(stop[0]), hulp_sim_stop_name(stop[1]));
+                same = false;
+                break;
+            }
+        }
+    }
+
+    pass &= same;
+    hulp_program_index_deinit(&original.index);
+    hulp_program_index_deinit(&optimised.index);
+    printf("%s: %s\n", tc->name, pass ? "ok" : "FAILED");
+    return pass;
+}
+
+int main(void)
+{
+    const ulp_insn_t zero[] = {
+        I_MOVI(R3, 0),
+        I_LD(R0, R3, TEST_DATA_BASE),
+        I_MOVI(R3, 0),                      // Removed
+        I_ADDI(R0, R0, 1),
+        I_ST(R0, R3, TEST_DATA_BASE + 1),
+        I_MOVI(R3, 0),                      // Removed
+        I_ST(R0, R3, TEST_DATA_BASE + 2),
+        I_MOVI(R3, 0),                      // Kept: the branch may use its flags
+        M_BGE(LBL_A, 1),
+        I_ST(R0, R3, TEST_DATA_BASE + 3),
+        M_LABEL(LBL_A),
+        I_MOVI(R3, 0),                      // Kept: a label may be reached from elsewhere
+        I_ST(R3, R3, TEST_DATA_BASE + 4),
+        I_HALT(),
+    };
+
+    // Entering at the I_ADDI (LBL_A + 2) through I_BXR, R1 is not known to be 0
+    const ulp_insn_t computed_jump[] = {
+        I_MOVI(R1, 7),
+        M_MOVL(R2, LBL_A),
+        I_ADDI(R2, R2, 2),
+        I_BXR(R2),
+        M_LABEL(LBL_A),
+        I_MOVI(R1, 0),
+        I_MOVI(R0, 5),
+        I_ADDI(R0, R0, 1),
+        I_MOVI(R1, 0),
+        I_ST(R0, R1, TEST_DATA_BASE),
+        I_HALT(),
+    };
+
+    const ulp_insn_t thread[] = {
+        I_ADDI(R0, R0, 0),
+        M_BL(LBL_A, 100),                   // Threaded through LBL_A to LBL_C
+        M_BX(LBL_B),                        // Threaded to LBL_C
+        M_LABEL(LBL_A),
+        M_BX(LBL_B),
+        I_ST(R0, R0, TEST_DATA_BASE),
+        M_LABEL(LBL_B),
+        M_BGE(LBL_C, 0),
+        I_ST(R0, R0, TEST_DATA_BASE + 1),
+        M_LABEL(LBL_C),
+        I_MOVI(R3, 0),
+        I_ST(R0, R3, TEST_DATA_BASE + 2),
+        I_HALT(),
+    };
+
+    const ulp_insn_t relative[] = {
+        I_MOVI(R3, 0),
+        M_BX(LBL_B),                        // Relative
+        M_LABEL(LBL_A),
+        I_ST(R0, R3, TEST_DATA_BASE),
+        I_HALT(),
+        M_LABEL(LBL_B),
+        I_ADDI(R0, R0, 1),
+        M_BX(LBL_A),                        // Relative
+    };
+
+    const ulp_insn_t wr_reg[] = {
+        I_WR_REG(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_FUN_SEL_S, RTC_IO_TOUCH_PAD2_FUN_SEL_S + 1, 2),
+        I_WR_REG_BIT(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_FUN_SEL_S + 2, 1),   // Merged
+        I_WR_REG_BIT(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_FUN_SEL_S - 1, 1),   // Merged
+        I_WR_REG(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_FUN_SEL_S, RTC_IO_PDAC1_FUN_SEL_S + 1, 0),
+        I_WR_REG_BIT(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_MUX_SEL_S, 1),              // Not merged: also a DAC control
+        I_HALT(),
+    };
+
+    // LBL_TASK is only run by address (eg. hulp_sched_init), so must be kept
+    const ulp_insn_t unreachable[] = {
+        I_MOVI(R3, 0),
+        I_ST(R0, R3, TEST_DATA_BASE),
+        I_HALT(),
+        M_LABEL(LBL_UNUSED),
+        I_ADDI(R0, R0, 1),
+        I_ST(R0, R3, TEST_DATA_BASE + 1),
+        I_HALT(),
+        M_LABEL(LBL_TASK),
+        I_MOVI(R3, 0),
+        I_ST(R1, R3, TEST_DATA_BASE + 2),
+        M_BX(LBL_B),
+        M_LABEL(LBL_A),
+        I_HALT(),
+        M_LABEL(LBL_B),
+        I_ST(R2, R3, TEST_DATA_BASE + 3),
+        I_HALT(),
+    };
+    static const uint16_t keep_labels[] = {LBL_TASK};
+
+    const hulp_optimize_config_t none = {0};
+    hulp_optimize_config_t config;
+    test_case_t cases[6];
+    size_t num_cases = 0;
+
+    config = none;
+    config.remove_redundant_zero = true;
+    cases[num_cases++] = (test_case_t) {"remove_redundant_zero", zero, sizeof(zero) / sizeof(ulp_insn_t), config,
+        {LBL_A}, 1, 2, 2};
+
+    config = (hulp_optimize_config_t)HULP_OPTIMIZE_CONFIG_DEFAULT();
+    cases[num_cases++] = (test_case_t) {"remove_redundant_zero computed jump", computed_jump,
+        sizeof(computed_jump) / sizeof(ulp_insn_t), config, {LBL_A}, 1, 0, 0};
+
+    config = none;
+    config.thread_branches = true;
+    cases[num_cases++] = (test_case_t) {"thread_branches", thread, sizeof(thread) / sizeof(ulp_insn_t), config,
+        {LBL_A, LBL_B, LBL_C}, 3, 3, 0};
+
+    config = none;
+    config.relative_branches = true;
+    cases[num_cases++] = (test_case_t) {"relative_branches", relative, sizeof(relative) / sizeof(ulp_insn_t), config,
+        {LBL_A, LBL_B}, 2, 2, 0};
+
+    config = none;
+    config.merge_wr_reg = true;
+    cases[num_cases++] = (test_case_t) {"merge_wr_reg", wr_reg, sizeof(wr_reg) / sizeof(ulp_insn_t), config,
+        {0}, 0, 2, 2};
+
+    config = none;
+    config.remove_unreachable = true;
+    config.keep_labels = keep_labels;
+    config.num_keep_labels = sizeof(keep_labels) / sizeof(keep_labels[0]);
+    cases[num_cases++] = (test_case_t) {"remove_unreachable keep_labels", unreachable,
+        sizeof(unreachable) / sizeof(ulp_insn_t), config, {LBL_TASK, LBL_B}, 2, 2, 4};
+
+    bool pass = true;
+    for(size_t i = 0; i < num_cases; ++i)
+    {
+        pass &= test_run_case(&cases[i]);
+    }
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,679 @@
+/**
+ * Code size and cycle benchmarks of HULP's driver macros, checked against a baseline.
+ *
+ * Usage: hulp_bench [-b baseline.csv] [-w] [-t tolerance_pct]
+ *
+ *  -b  compare against (or with -w, write) this baseline
+ *  -w  write the results as the new baseline instead of comparing
+ *  -t  allowed increase of any value over the baseline, in percent (default 0)
+ *
+ * Each building block is assembled at two payload sizes (eg. bytes or LEDs) and run in the simulator against a device
+ * model, at the fast clock frequency hulp_get_fast_clk_freq() reports. Reported per block:
+ *  words: instruction words of the block itself (excluding the calling code)
+ *  cycles: the most cycles of any run at the first (representative) payload size, including calling the block
+ *  cycles_per_unit: the increase in cycles per additional payload unit
+ *
+ * Exits with 1 if a block fails to run correctly, or any value regresses from the baseline.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_attr.h"
+
+#include "hulp.h"
+#include "hulp_apa.h"
+#include "hulp_hx711.h"
+#include "hulp_i2cbb.h"
+#include "hulp_sched.h"
+#include "hulp_uart.h"
+
+#include "hulp_bus.h"
+#include "hulp_bus_apa.h"
+#include "hulp_bus_hx711.h"
+#include "hulp_bus_i2c.h"
+#include "hulp_bus_uart.h"
+
+#define HULP_BENCH_MAX_INSNS 1024
+#define HULP_BENCH_MAX_UNITS 16
+#define HULP_BENCH_MAX_CYCLES 10000000
+#define HULP_BENCH_RUNS 3
+#define HULP_BENCH_PERIOD_US 100000
+
+#define HULP_BENCH_I2C_SCL GPIO_NUM_14
+#define HULP_BENCH_I2C_SDA GPIO_NUM_12
+#define HULP_BENCH_I2C_ADDR 0x3C
+#define HULP_BENCH_UART_TX GPIO_NUM_26
+#define HULP_BENCH_UART_BAUD 115200
+#define HULP_BENCH_APA_CLK GPIO_NUM_25
+#define HULP_BENCH_APA_DATA GPIO_NUM_26
+#define HULP_BENCH_HX711_DOUT GPIO_NUM_32
+#define HULP_BENCH_HX711_SCK GPIO_NUM_33
+#define HULP_BENCH_INTERVAL_MS 10
+#define HULP_BENCH_PRINTF_U_VALUE 59999      // Most iterations of the digit loops
+#define HULP_BENCH_PRINTF_X_VALUE 0x9999
+#define HULP_BENCH_SCHED_DUE_MS 10           // Less than the wake period, so every task is due on every wake
+#define HULP_BENCH_SCHED_IDLE_MS 60000
+
+enum {
+    LBL_ENTRY,
+    LBL_ENTRY2,
+    LBL_ERROR,
+    LBL_HALT,
+    LBL_RETURN,     // Calls use LBL_RETURN + call index
+    LBL_NEXT = LBL_RETURN + HULP_BENCH_MAX_UNITS,
+};
+
+static RTC_DATA_ATTR ulp_var_t s_bench_string HULP_UART_STRING_BUFFER(HULP_BENCH_MAX_UNITS);
+static RTC_DATA_ATTR ulp_var_t s_bench_printf HULP_UART_STRING_BUFFER(6);
+static RTC_DATA_ATTR ulp_apa_t s_bench_leds[HULP_BENCH_MAX_UNITS];
+static RTC_DATA_ATTR ulp_var_t s_bench_sched[HULP_SCHED_TABLE_WORDS(HULP_BENCH_MAX_UNITS)];
+static RTC_DATA_ATTR ulp_var_t s_bench_task_runs[HULP_BENCH_MAX_UNITS];
+
+typedef struct {
+    ulp_insn_t insns[HULP_BENCH_MAX_INSNS];
+    size_t len;
+} bench_prog_t;
+
+typedef union {
+    hulp_bus_i2c_t i2c;
+    hulp_bus_uart_t uart;
+    hulp_bus_apa_t apa;
+    hulp_bus_hx711_t hx711;
+} bench_device_t;
+
+typedef struct {
+    const char* name;
+    const char* unit;
+    unsigned units[2];      /*!< Payload sizes to run; the first is representative */
+    size_t (*build)(bench_prog_t* prog, unsigned units);    /*!< Returns the block's words */
+    esp_err_t (*attach)(hulp_bus_t* bus, bench_device_t* dev, unsigned units);
+    bool (*check)(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units);
+} bench_case_t;
+
+typedef struct {
+    char name[32];
+    size_t words;
+    uint32_t cycles;
+    double cycles_per_unit;
+} bench_result_t;
+
+/**
+ * Append instructions to a program, returning the number of words they assemble to (ie. excluding macros).
+ */
+static size_t bench_append(bench_prog_t* prog, const ulp_insn_t* insns, size_t num)
+{
+    size_t words = 0;
+    if(prog->len + num > HULP_BENCH_MAX_INSNS)
+    {
+        fprintf(stderr, "Benchmark program too large\n");
+        exit(2);
+    }
+    for(size_t i = 0; i < num; ++i)
+    {
+        words += (insns[i].macro.opcode != OPCODE_MACRO);
+        prog->insns[prog->len++] = insns[i];
+    }
+    return words;
+}
+
+#define BENCH_APPEND(prog, ...) ({ \
+            const ulp_insn_t piece_[] = { __VA_ARGS__ }; \
+            bench_append((prog), piece_, sizeof(piece_) / sizeof(piece_[0])); \
+        })
+
+/* Calling code ends with I_HALT; errors wake the SoC, which checks fail on. */
+static void bench_append_end(bench_prog_t* prog)
+{
+    BENCH_APPEND(prog,
+        M_BX(LBL_HALT),
+        M_LABEL(LBL_ERROR),
+            I_WAKE(),
+        M_LABEL(LBL_HALT),
+            I_HALT(),
+    );
+}
+
+static bool bench_no_errors(const hulp_sim_t* sim)
+{
+    return sim->wakeups == 0;
+}
+
+/* I2C bitbang */
+
+static size_t build_i2cbb(bench_prog_t* prog, unsigned units, bool write)
+{
+    for(unsigned i = 0; i < units; ++i)
+    {
+        if(write)
+        {
+            BENCH_APPEND(prog, M_I2CBB_WR(LBL_RETURN + i, LBL_ENTRY2, i, 0xA5));
+        }
+        else
+        {
+            BENCH_APPEND(prog, M_I2CBB_RD(LBL_RETURN + i, LBL_ENTRY, i));
+        }
+    }
+    bench_append_end(prog);
+    return BENCH_APPEND(prog,
+        M_INCLUDE_I2CBB(LBL_ENTRY, LBL_ENTRY2, LBL_ERROR, LBL_ERROR, HULP_BENCH_I2C_SCL, HULP_BENCH_I2C_SDA, HULP_BENCH_I2C_ADDR)
+    );
+}
+
+static size_t build_i2cbb_read(bench_prog_t* prog, unsigned units)
+{
+    return build_i2cbb(prog, units, false);
+}
+
+static size_t build_i2cbb_write(bench_prog_t* prog, unsigned units)
+{
+    return build_i2cbb(prog, units, true);
+}
+
+static esp_err_t attach_i2c(hulp_bus_t* bus, bench_device_t* dev, unsigned units)
+{
+    hulp_bus_i2c_config_t config = HULP_BUS_I2C_CONFIG_DEFAULT();
+    config.scl_pin = hulp_gtr(HULP_BENCH_I2C_SCL);
+    config.sda_pin = hulp_gtr(HULP_BENCH_I2C_SDA);
+    config.address = HULP_BENCH_I2C_ADDR;
+    return hulp_bus_i2c_attach(bus, &dev->i2c, &config);
+}
+
+static bool check_i2cbb_read(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    return bench_no_errors(sim) && dev->i2c.bytes_read == units * sim->runs && !dev->i2c.errors;
+}
+
+static bool check_i2cbb_write(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    return bench_no_errors(sim) && dev->i2c.bytes_written == units * sim->runs && !dev->i2c.errors;
+}
+
+/* UART TX */
+
+static size_t build_uart_tx(bench_prog_t* prog, unsigned units)
+{
+    char str[HULP_BENCH_MAX_UNITS + 1];
+    memset(str, 'U', units);
+    str[units] = '\0';
+    hulp_uart_string_set(s_bench_string, sizeof(s_bench_string) / sizeof(ulp_var_t), str);
+    BENCH_APPEND(prog,
+        I_MOVO(R1, s_bench_string),
+        M_MOVL(R3, LBL_RETURN),
+        M_BX(LBL_ENTRY),
+        M_LABEL(LBL_RETURN),
+    );
+    bench_append_end(prog);
+    return BENCH_APPEND(prog, M_INCLUDE_UART_TX(LBL_ENTRY, HULP_BENCH_UART_BAUD, HULP_BENCH_UART_TX));
+}
+
+static esp_err_t attach_uart(hulp_bus_t* bus, bench_device_t* dev, unsigned units)
+{
+    hulp_bus_uart_config_t config = HULP_BUS_UART_CONFIG_DEFAULT();
+    config.rx_pin = hulp_gtr(HULP_BENCH_UART_TX);
+    config.baud = HULP_BENCH_UART_BAUD;
+    hulp_bus_set_output(bus, config.rx_pin, 1);
+    return hulp_bus_uart_attach(bus, &dev->uart, &config);
+}
+
+static bool check_uart_tx(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    return bench_no_errors(sim) && dev->uart.frames == units * sim->runs && !dev->uart.framing_errors && !dev->uart.glitches;
+}
+
+/* APA */
+
+static size_t build_apa_tx(bench_prog_t* prog, unsigned units)
+{
+    for(unsigned i = 0; i < units; ++i)
+    {
+        s_bench_leds[i].brightness = 31;
+        s_bench_leds[i].red = 0x55;
+        s_bench_leds[i].green = 0xAA;
+        s_bench_leds[i].blue = (uint8_t)i;
+    }
+    BENCH_APPEND(prog,
+        M_MOVL(R3, LBL_RETURN),
+        M_BX(LBL_ENTRY),
+        M_LABEL(LBL_RETURN),
+    );
+    bench_append_end(prog);
+    return BENCH_APPEND(prog, M_APA_TX(LBL_ENTRY, HULP_BENCH_APA_CLK, HULP_BENCH_APA_DATA, s_bench_leds, units, R1, R3));
+}
+
+static esp_err_t attach_apa(hulp_bus_t* bus, bench_device_t* dev, unsigned units)
+{
+    hulp_bus_apa_config_t config = HULP_BUS_APA_CONFIG_DEFAULT();
+    config.clk_pin = hulp_gtr(HULP_BENCH_APA_CLK);
+    config.data_pin = hulp_gtr(HULP_BENCH_APA_DATA);
+    config.num_leds = (uint8_t)units;
+    hulp_bus_set_output(bus, config.clk_pin, 0);
+    hulp_bus_set_output(bus, config.data_pin, 0);
+    return hulp_bus_apa_attach(bus, &dev->apa, &config);
+}
+
+static bool check_apa_tx(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    return bench_no_errors(sim) && dev->apa.updates == sim->runs && !dev->apa.bad_frames &&
+        dev->apa.leds[units - 1].blue == units - 1 && dev->apa.leds[units - 1].green == 0xAA;
+}
+
+/* HX711 (inline, so the block is repeated per sample) */
+
+static size_t build_hx711_read(bench_prog_t* prog, unsigned units)
+{
+    size_t words = 0;
+    for(unsigned i = 0; i < units; ++i)
+    {
+        words = BENCH_APPEND(prog, M_HX711_READ(R1, R2, HULP_BENCH_HX711_DOUT, HULP_BENCH_HX711_SCK));
+    }
+    bench_append_end(prog);
+    return words;
+}
+
+static esp_err_t attach_hx711(hulp_bus_t* bus, bench_device_t* dev, unsigned units)
+{
+    hulp_bus_hx711_config_t config = HULP_BUS_HX711_CONFIG_DEFAULT();
+    config.dout_pin = hulp_gtr(HULP_BENCH_HX711_DOUT);
+    config.sck_pin = hulp_gtr(HULP_BENCH_HX711_SCK);
+    config.conversion_ns = 1000;
+    config.value = 0x123456;
+    hulp_bus_set_output(bus, config.sck_pin, 0);
+    return hulp_bus_hx711_attach(bus, &dev->hx711, &config);
+}
+
+static bool check_hx711_read(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    return bench_no_errors(sim) && dev->hx711.reads == units * sim->runs && dev->hx711.last_read == 0x123456;
+}
+
+/* PRINTF */
+
+static size_t build_printf(bench_prog_t* prog, unsigned units, bool hex)
+{
+    for(unsigned i = 0; i < units; ++i)
+    {
+        BENCH_APPEND(prog,
+            I_MOVI(R0, hex ? HULP_BENCH_PRINTF_X_VALUE : HULP_BENCH_PRINTF_U_VALUE),
+            I_MOVO(R1, s_bench_printf),
+            M_MOVL(R3, LBL_RETURN + i),
+            M_BX(LBL_ENTRY),
+            M_LABEL(LBL_RETURN + i),
+        );
+    }
+    bench_append_end(prog);
+    if(hex)
+    {
+        return BENCH_APPEND(prog, M_INCLUDE_PRINTF_X(LBL_ENTRY));
+    }
+    return BENCH_APPEND(prog, M_INCLUDE_PRINTF_U(LBL_ENTRY));
+}
+
+static size_t build_printf_u(bench_prog_t* prog, unsigned units)
+{
+    return build_printf(prog, units, false);
+}
+
+static size_t build_printf_x(bench_prog_t* prog, unsigned units)
+{
+    return build_printf(prog, units, true);
+}
+
+static bool check_printf(const char* expected)
+{
+    char buf[16];
+    return hulp_uart_string_get(s_bench_printf, buf, sizeof(buf), false) >= 0 && strcmp(buf, expected) == 0;
+}
+
+static bool check_printf_u(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    char expected[8];
+    snprintf(expected, sizeof(expected), "%05u\n", HULP_BENCH_PRINTF_U_VALUE);
+    return bench_no_errors(sim) && check_printf(expected);
+}
+
+static bool check_printf_x(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    char expected[8];
+    snprintf(expected, sizeof(expected), "%04X", HULP_BENCH_PRINTF_X_VALUE);
+    return bench_no_errors(sim) && check_printf(expected);
+}
+
+/* M_IF_MS_ELAPSED (the period exceeds the interval, so every check after the first run is elapsed) */
+
+static size_t build_if_ms_elapsed(bench_prog_t* prog, unsigned units)
+{
+    size_t words = 0;
+    BENCH_APPEND(prog, M_UPDATE_TICKS());
+    for(unsigned i = 0; i < units; ++i)
+    {
+        words = BENCH_APPEND(prog,
+            M_IF_MS_ELAPSED(LBL_RETURN + i, HULP_BENCH_INTERVAL_MS, LBL_NEXT + i),
+            M_LABEL(LBL_NEXT + i),
+        );
+    }
+    bench_append_end(prog);
+    return words;
+}
+
+static esp_err_t attach_none(hulp_bus_t* bus, bench_device_t* dev, unsigned units)
+{
+    return ESP_OK;
+}
+
+static bool check_if_ms_elapsed(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    return bench_no_errors(sim);
+}
+
+/* M_SCHED_RUN (the tasks only count their runs) */
+
+static size_t build_sched(bench_prog_t* prog, unsigned units, uint32_t period_ms)
+{
+    hulp_sched_task_t tasks[HULP_BENCH_MAX_UNITS];
+    for(unsigned i = 0; i < units; ++i)
+    {
+        tasks[i].entry_label = LBL_NEXT + i;
+        tasks[i].period_ms = period_ms;
+    }
+    uint8_t tick_shift = hulp_sched_tick_shift(tasks, units);
+    size_t words = BENCH_APPEND(prog, M_SCHED_RUN(LBL_RETURN, s_bench_sched, units, tick_shift));
+    bench_append_end(prog);
+    for(unsigned i = 0; i < units; ++i)
+    {
+        BENCH_APPEND(prog,
+            M_LABEL(LBL_NEXT + i),
+                I_MOVI(R2, 0),
+                I_LD(R0, R2, RTC_WORD_OFFSET(s_bench_task_runs[i])),
+                I_ADDI(R0, R0, 1),
+                I_ST(R0, R2, RTC_WORD_OFFSET(s_bench_task_runs[i])),
+                M_SCHED_TASK_END(LBL_RETURN),
+        );
+    }
+    memset(s_bench_task_runs, 0, sizeof(s_bench_task_runs));
+    if(hulp_sched_init(s_bench_sched, tasks, units, tick_shift, prog->insns, prog->len) != ESP_OK)
+    {
+        return 0;
+    }
+    return words;
+}
+
+static size_t build_sched_due(bench_prog_t* prog, unsigned units)
+{
+    return build_sched(prog, units, HULP_BENCH_SCHED_DUE_MS);
+}
+
+static size_t build_sched_idle(bench_prog_t* prog, unsigned units)
+{
+    size_t words = build_sched(prog, units, HULP_BENCH_SCHED_IDLE_MS);
+    // As if every task has just run
+    uint16_t next = s_bench_sched[HULP_SCHED_HDR_NOW].val + s_bench_sched[HULP_SCHED_HDR_WORDS + HULP_SCHED_TASK_PERIOD].val;
+    s_bench_sched[HULP_SCHED_HDR_NEXT].val = next;
+    for(unsigned i = 0; i < units; ++i)
+    {
+        s_bench_sched[HULP_SCHED_HDR_WORDS + HULP_SCHED_TASK_WORDS * i + HULP_SCHED_TASK_NEXT].val = next;
+    }
+    return words;
+}
+
+static bool check_sched_runs(const hulp_sim_t* sim, unsigned units, unsigned runs)
+{
+    for(unsigned i = 0; i < units; ++i)
+    {
+        if(s_bench_task_runs[i].val != runs)
+        {
+            return false;
+        }
+    }
+    return bench_no_errors(sim);
+}
+
+static bool check_sched_due(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    return check_sched_runs(sim, units, sim->runs);
+}
+
+static bool check_sched_idle(const hulp_sim_t* sim, const bench_device_t* dev, unsigned units)
+{
+    return check_sched_runs(sim, units, 0);
+}
+
+static const bench_case_t s_cases[] = {
+    {"i2cbb_read", "byte", {1, 2}, build_i2cbb_read, attach_i2c, check_i2cbb_read},
+    {"i2cbb_write", "byte", {1, 2}, build_i2cbb_write, attach_i2c, check_i2cbb_write},
+    {"uart_tx", "byte", {8, 16}, build_uart_tx, attach_uart, check_uart_tx},
+    {"apa_tx", "led", {4, 8}, build_apa_tx, attach_apa, check_apa_tx},
+    {"hx711_read", "sample", {1, 2}, build_hx711_read, attach_hx711, check_hx711_read},
+    {"printf_u", "conversion", {1, 2}, build_printf_u, attach_none, check_printf_u},
+    {"printf_x", "conversion", {1, 2}, build_printf_x, attach_none, check_printf_x},
+    {"if_ms_elapsed", "check", {1, 2}, build_if_ms_elapsed, attach_none, check_if_ms_elapsed},
+    {"sched_due", "task", {2, 4}, build_sched_due, attach_none, check_sched_due},
+    {"sched_idle", "task", {2, 4}, build_sched_idle, attach_none, check_sched_idle},
+};
+
+/**
+ * Assemble and run a case at a payload size. Returns the block's words, or 0 on failure.
+ */
+static size_t bench_run(const bench_case_t* c, unsigned units, hulp_sim_t* sim, hulp_bus_t* bus, uint32_t* max_cycles)
+{
+    static bench_prog_t prog;
+    static bench_device_t dev;
+    prog.len = 0;
+    size_t words = c->build(&prog, units);
+    size_t size = prog.len * sizeof(ulp_insn_t);
+    if(hulp_ulp_load(prog.insns, size, HULP_BENCH_PERIOD_US, 0) != ESP_OK)
+    {
+        return 0;
+    }
+
+    hulp_sim_config_t config = HULP_SIM_CONFIG_DEFAULT();
+    config.fast_clk_hz = hulp_get_fast_clk_freq();
+    config.period_us = HULP_BENCH_PERIOD_US;
+    if(hulp_sim_init(sim, &config) != ESP_OK ||
+        hulp_sim_load(sim, 0, (const ulp_insn_t*)RTC_SLOW_MEM, HULP_SIM_MEM_WORDS) != ESP_OK ||
+        hulp_bus_init(bus, sim) != ESP_OK ||
+        c->attach(bus, &dev, units) != ESP_OK)
+    {
+        return 0;
+    }
+
+    hulp_sim_stop_t stop = hulp_sim_start(sim, 0, HULP_BENCH_MAX_CYCLES);
+    while(stop == HULP_SIM_HALT && sim->runs < HULP_BENCH_RUNS)
+    {
+        stop = hulp_sim_wake(sim, HULP_BENCH_MAX_CYCLES);
+    }
+    hulp_bus_advance(bus, hulp_sim_time_ns(sim));
+    // The SoC sees the ULP's writes to its variables
+    memcpy(RTC_SLOW_MEM, sim->mem, sizeof(sim->mem));
+
+    if(stop != HULP_SIM_HALT || bus->contentions || !c->check(sim, &dev, units))
+    {
+        fprintf(stderr, "%s: failed with %u %s(s) (%s, %u contentions, %u wakeups)\n", c->name, units, c->unit,
+            hulp_sim_stop_name(stop), (unsigned)bus->contentions, (unsigned)sim->wakeups);
+        return 0;
+    }
+    *max_cycles = sim->max_cycles;
+    return words;
+}
+
+static bool bench_case(const bench_case_t* c, hulp_sim_t* sim, hulp_bus_t* bus, bench_result_t* result)
+{
+    uint32_t cycles[2];
+    memset(result, 0, sizeof(*result));
+    snprintf(result->name, sizeof(result->name), "%s", c->name);
+    for(int i = 0; i < 2; ++i)
+    {
+        size_t words = bench_run(c, c->units[i], sim, bus, &cycles[i]);
+        if(!words)
+        {
+            return false;
+        }
+        if(i == 0)
+        {
+            result->words = words;
+        }
+    }
+    result->cycles = cycles[0];
+    result->cycles_per_unit = ((double)cycles[1] - cycles[0]) / (c->units[1] - c->units[0]);
+    return true;
+}
+
+static size_t baseline_read(const char* path, bench_result_t* results, size_t max_results)
+{
+    FILE* f = fopen(path, "r");
+    if(!f)
+    {
+        perror(path);
+        return 0;
+    }
+    char line[128];
+    size_t num = 0;
+    while(num < max_results && fgets(line, sizeof(line), f))
+    {
+        bench_result_t* r = &results[num];
+        unsigned long words, cycles;
+        if(line[0] == '#' || sscanf(line, "%31[^,],%lu,%lu,%lf", r->name, &words, &cycles, &r->cycles_per_unit) != 4)
+        {
+            continue;
+        }
+        r->words = words;
+        r->cycles = (uint32_t)cycles;
+        ++num;
+    }
+    fclose(f);
+    return num;
+}
+
+static bool baseline_write(const char* path, const bench_result_t* results, size_t num)
+{
+    FILE* f = fopen(path, "w");
+    if(!f)
+    {
+        perror(path);
+        return false;
+    }
+    fprintf(f, "# Written by hulp_bench -w: name,words,cycles,cycles_per_unit\n");
+    for(size_t i = 0; i < num; ++i)
+    {
+        fprintf(f, "%s,%u,%u,%.1f\n", results[i].name, (unsigned)results[i].words, (unsigned)results[i].cycles, results[i].cycles_per_unit);
+    }
+    return fclose(f) == 0;
+}
+
+/**
+ * Print one value against its baseline. Returns false if it has regressed beyond the tolerance.
+ */
+static bool compare_value(const char* name, const char* what, double value, double base, double tolerance_pct)
+{
+    if(value > base * (1 + tolerance_pct / 100) + 1e-9)
+    {
+        printf("  %s %s regressed: %.1f -> %.1f (+%.1f%%)\n", name, what, base, value, base ? (value - base) * 100 / base : INFINITY);
+        return false;
+    }
+    if(value < base)
+    {
+        printf("  %s %s improved: %.1f -> %.1f\n", name, what, base, value);
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    const char* baseline_path = NULL;
+    bool write = false;
+    double tolerance_pct = 0;
+
+    int opt;
+    while((opt = getopt(argc, argv, "b:wt:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'b':
+                baseline_path = optarg;
+                break;
+            case 'w':
+                write = true;
+                break;
+            case 't':
+                tolerance_pct = strtod(optarg, NULL);
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-b baseline.csv] [-w] [-t tolerance_pct]\n", argv[0]);
+                return 2;
+        }
+    }
+    if(write && !baseline_path)
+    {
+        fprintf(stderr, "-w requires -b\n");
+        return 2;
+    }
+
+    const size_t num_cases = sizeof(s_cases) / sizeof(s_cases[0]);
+    bench_result_t results[sizeof(s_cases) / sizeof(s_cases[0])];
+    hulp_sim_t* sim = (hulp_sim_t*)malloc(sizeof(hulp_sim_t));
+    hulp_bus_t* bus = (hulp_bus_t*)malloc(sizeof(hulp_bus_t));
+    if(!sim || !bus)
+    {
+        free(sim);
+        free(bus);
+        return 2;
+    }
+
+    int ret = 0;
+    printf("@ %u Hz\n%-16s %-11s %6s %8s %10s\n", (unsigned)hulp_get_fast_clk_freq(), "block", "unit", "words", "cycles", "cycles/unit");
+    for(size_t i = 0; i < num_cases; ++i)
+    {
+        if(!bench_case(&s_cases[i], sim, bus, &results[i]))
+        {
+            ret = 1;
+            continue;
+        }
+        printf("%-16s %-11s %6u %8u %10.1f\n", results[i].name, s_cases[i].unit, (unsigned)results[i].words,
+            (unsigned)results[i].cycles, results[i].cycles_per_unit);
+    }
+    free(sim);
+    free(bus);
+
+    if(ret == 0 && write)
+    {
+        return baseline_write(baseline_path, results, num_cases) ? 0 : 2;
+    }
+    if(baseline_path && !write)
+    {
+        bench_result_t baseline[HULP_BENCH_MAX_INSNS / 8];
+        size_t num_baseline = baseline_read(baseline_path, baseline, sizeof(baseline) / sizeof(baseline[0]));
+        if(!num_baseline)
+        {
+            return 2;
+        }
+        for(size_t i = 0; i < num_cases; ++i)
+        {
+            if(!results[i].words)
+            {
+                continue;
+            }
+            const bench_result_t* base = NULL;
+            for(size_t b = 0; b < num_baseline && !base; ++b)
+            {
+                base = (strcmp(baseline[b].name, results[i].name) == 0) ? &baseline[b] : NULL;
+            }
+            if(!base)
+            {
+                printf("  %s is not in the baseline\n", results[i].name);
+                continue;
+            }
+            bool ok = compare_value(results[i].name, "words", results[i].words, base->words, tolerance_pct);
+            ok &= compare_value(results[i].name, "cycles", results[i].cycles, base->cycles, tolerance_pct);
+            ok &= compare_value(results[i].name, "cycles/unit", results[i].cycles_per_unit, base->cycles_per_unit, tolerance_pct);
+            if(!ok)
+            {
+                ret = 1;
+            }
+        }
+        printf(ret ? "Regressions against %s\n" : "No regressions against %s\n", baseline_path);
+    }
+    return ret;
+}
@@ -0,0 +1,334 @@
+/**
+ * Run a ULP program image against GPIO-level device models, and report bus throughput and timing margins at
+ * several fast clock frequencies.
+ *
+ * Usage: hulp_bus [-e entry_pc] [-n runs] [-p period_us] [-f fast_clk_hz]... [-c max_cycles] [-v out.vcd] [-o rtcio[:level]]... -d device... image.bin
+ *
+ *  -f  RTC_FAST_CLK to simulate; repeat to compare several (eg. the RC oscillator's tolerance)
+ *  -v  write the waveforms of the first frequency as VCD
+ *  -o  rtcio[:level]: an RTCIO the SoC configures as an output (default low) before starting the ULP, eg. for
+ *      I_GPIO_SET; repeatable
+ *  -d  a device, as type:key=value,... with pins as RTCIO numbers:
+ *        i2c:scl=N,sda=N,addr=N[,stretch=ns][,nack=1][,standard=1][,fill=N]
+ *        uart:rx=N[,tx=N,send=text,start=ns][,baud=N][,max_error=pct]
+ *        apa:clk=N,data=N[,leds=N]
+ *        hx711:dout=N,sck=N[,value=N][,conversion=ns]
+ *
+ * image.bin is as per hulp_run. Exits with 1 if the program fails or any device reports an error or timing violation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hulp_bus.h"
+#include "hulp_bus_apa.h"
+#include "hulp_bus_hx711.h"
+#include "hulp_bus_i2c.h"
+#include "hulp_bus_uart.h"
+
+#include "hulp_image.h"
+
+#define HULP_BUS_TOOL_MAX_CLOCKS 8
+#define HULP_BUS_TOOL_MAX_DEVICES HULP_BUS_MAX_DEVICES
+#define HULP_BUS_TOOL_DEFAULT_UART_ERROR_PCT 25.0f
+
+typedef union {
+    hulp_bus_i2c_t i2c;
+    hulp_bus_uart_t uart;
+    hulp_bus_apa_t apa;
+    hulp_bus_hx711_t hx711;
+} device_t;
+
+typedef struct {
+    const char* spec;
+    char type[8];
+    float uart_max_error_pct;
+    device_t model;
+} device_spec_t;
+
+static void usage(const char* name)
+{
+    fprintf(stderr, "Usage: %s [-e entry_pc] [-n runs] [-p period_us] [-f fast_clk_hz]... [-c max_cycles] [-v out.vcd] [-o rtcio[:level]]... -d device... image.bin\n", name);
+}
+
+/**
+ * Find key in "type:key=value,key=value", copying its value into value.
+ */
+static bool spec_get(const char* spec, const char* key, char* value, size_t size)
+{
+    const char* p = strchr(spec, ':');
+    size_t key_len = strlen(key);
+    while(p)
+    {
+        ++p;
+        const char* end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        if(len > key_len && strncmp(p, key, key_len) == 0 && p[key_len] == '=')
+        {
+            size_t value_len = len - key_len - 1;
+            value_len = (value_len < size - 1) ? value_len : size - 1;
+            memcpy(value, p + key_len + 1, value_len);
+            value[value_len] = '\0';
+            return true;
+        }
+        p = end;
+    }
+    return false;
+}
+
+static long spec_num(const char* spec, const char* key, long def)
+{
+    char value[32];
+    return spec_get(spec, key, value, sizeof(value)) ? strtol(value, NULL, 0) : def;
+}
+
+static esp_err_t device_attach(hulp_bus_t* bus, device_spec_t* d, char* send, size_t send_size)
+{
+    const char* spec = d->spec;
+    if(strcmp(d->type, "i2c") == 0)
+    {
+        hulp_bus_i2c_config_t config = HULP_BUS_I2C_CONFIG_DEFAULT();
+        const hulp_bus_i2c_timing_t standard = HULP_BUS_I2C_TIMING_STANDARD();
+        config.scl_pin = (uint8_t)spec_num(spec, "scl", -1);
+        config.sda_pin = (uint8_t)spec_num(spec, "sda", -1);
+        config.address = (uint8_t)spec_num(spec, "addr", 0);
+        config.stretch_ns = (uint32_t)spec_num(spec, "stretch", 0);
+        config.nack_data = spec_num(spec, "nack", 0);
+        if(spec_num(spec, "standard", 0))
+        {
+            config.timing = standard;
+        }
+        esp_err_t err = hulp_bus_i2c_attach(bus, &d->model.i2c, &config);
+        memset(d->model.i2c.regs, (int)spec_num(spec, "fill", 0), sizeof(d->model.i2c.regs));
+        return err;
+    }
+    if(strcmp(d->type, "uart") == 0)
+    {
+        hulp_bus_uart_config_t config = HULP_BUS_UART_CONFIG_DEFAULT();
+        char value[32];
+        config.rx_pin = (int8_t)spec_num(spec, "rx", -1);
+        config.tx_pin = (int8_t)spec_num(spec, "tx", -1);
+        config.baud = (uint32_t)spec_num(spec, "baud", config.baud);
+        config.tx_start_ns = (uint64_t)spec_num(spec, "start", 0);
+        if(spec_get(spec, "send", send, send_size))
+        {
+            config.tx_data = (const uint8_t*)send;
+            config.tx_len = strlen(send);
+        }
+        d->uart_max_error_pct = spec_get(spec, "max_error", value, sizeof(value)) ? strtof(value, NULL) : HULP_BUS_TOOL_DEFAULT_UART_ERROR_PCT;
+        return hulp_bus_uart_attach(bus, &d->model.uart, &config);
+    }
+    if(strcmp(d->type, "apa") == 0)
+    {
+        hulp_bus_apa_config_t config = HULP_BUS_APA_CONFIG_DEFAULT();
+        config.clk_pin = (uint8_t)spec_num(spec, "clk", -1);
+        config.data_pin = (uint8_t)spec_num(spec, "data", -1);
+        config.num_leds = (uint8_t)spec_num(spec, "leds", 1);
+        return hulp_bus_apa_attach(bus, &d->model.apa, &config);
+    }
+    if(strcmp(d->type, "hx711") == 0)
+    {
+        hulp_bus_hx711_config_t config = HULP_BUS_HX711_CONFIG_DEFAULT();
+        config.dout_pin = (uint8_t)spec_num(spec, "dout", -1);
+        config.sck_pin = (uint8_t)spec_num(spec, "sck", -1);
+        config.value = (int32_t)spec_num(spec, "value", 0);
+        config.conversion_ns = (uint32_t)spec_num(spec, "conversion", config.conversion_ns);
+        return hulp_bus_hx711_attach(bus, &d->model.hx711, &config);
+    }
+    fprintf(stderr, "Unknown device: %s\n", spec);
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static bool device_print(device_spec_t* d)
+{
+    if(strcmp(d->type, "i2c") == 0)
+    {
+        return hulp_bus_i2c_print(&d->model.i2c);
+    }
+    if(strcmp(d->type, "uart") == 0)
+    {
+        return hulp_bus_uart_print(&d->model.uart, d->uart_max_error_pct);
+    }
+    if(strcmp(d->type, "apa") == 0)
+    {
+        return hulp_bus_apa_print(&d->model.apa);
+    }
+    return hulp_bus_hx711_print(&d->model.hx711);
+}
+
+int main(int argc, char** argv)
+{
+    hulp_sim_config_t config = HULP_SIM_CONFIG_DEFAULT();
+    uint16_t entry_pc = 0;
+    unsigned long num_runs = 10;
+    uint32_t max_cycles = 1000000;
+    uint32_t clocks[HULP_BUS_TOOL_MAX_CLOCKS];
+    size_t num_clocks = 0;
+    const char* vcd_path = NULL;
+    static device_spec_t devices[HULP_BUS_TOOL_MAX_DEVICES];
+    static char sends[HULP_BUS_TOOL_MAX_DEVICES][HULP_BUS_UART_RX_SIZE];
+    size_t num_devices = 0;
+    uint32_t outputs = 0;
+    uint32_t output_levels = 0;
+
+    int opt;
+    while((opt = getopt(argc, argv, "e:n:p:f:c:v:o:d:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'e':
+                entry_pc = (uint16_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                num_runs = strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                config.period_us = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                if(num_clocks == HULP_BUS_TOOL_MAX_CLOCKS)
+                {
+                    fprintf(stderr, "Too many clocks\n");
+                    return 2;
+                }
+                clocks[num_clocks++] = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'c':
+                max_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'v':
+                vcd_path = optarg;
+                break;
+            case 'o':
+            {
+                char* level;
+                opt = (int)strtol(optarg, &level, 0);
+                if(opt < 0 || opt >= HULP_BUS_NUM_PINS)
+                {
+                    fprintf(stderr, "Invalid RTCIO: %s\n", optarg);
+                    return 2;
+                }
+                outputs |= 1UL << opt;
+                if(*level == ':' && strtol(level + 1, NULL, 0))
+                {
+                    output_levels |= 1UL << opt;
+                }
+                break;
+            }
+            case 'd':
+                if(num_devices == HULP_BUS_TOOL_MAX_DEVICES || !strchr(optarg, ':') || strchr(optarg, ':') - optarg >= (long)sizeof(devices[0].type))
+                {
+                    fprintf(stderr, "Invalid device: %s\n", optarg);
+                    return 2;
+                }
+                devices[num_devices].spec = optarg;
+                snprintf(devices[num_devices].type, sizeof(devices[0].type), "%.*s", (int)(strchr(optarg, ':') - optarg), optarg);
+                ++num_devices;
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if(optind != argc - 1 || num_runs == 0)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    if(num_clocks == 0)
+    {
+        clocks[num_clocks++] = config.fast_clk_hz;
+    }
+
+    size_t num_words;
+    ulp_insn_t* program = hulp_image_read_mem(argv[optind], &num_words);
+    hulp_sim_t* sim = (hulp_sim_t*)malloc(sizeof(hulp_sim_t));
+    hulp_bus_t* bus = (hulp_bus_t*)malloc(sizeof(hulp_bus_t));
+    if(!program || !sim || !bus)
+    {
+        free(program);
+        free(sim);
+        free(bus);
+        return 2;
+    }
+
+    int ret = 0;
+    for(size_t c = 0; c < num_clocks && ret != 2; ++c)
+    {
+        config.fast_clk_hz = clocks[c];
+        if(hulp_sim_init(sim, &config) != ESP_OK || hulp_sim_load(sim, 0, program, num_words) != ESP_OK || hulp_bus_init(bus, sim) != ESP_OK)
+        {
+            ret = 2;
+            break;
+        }
+        for(uint8_t pin = 0; pin < HULP_BUS_NUM_PINS; ++pin)
+        {
+            if(outputs & (1UL << pin))
+            {
+                hulp_bus_set_output(bus, pin, (output_levels >> pin) & 1);
+            }
+        }
+        for(size_t d = 0; d < num_devices; ++d)
+        {
+            if(device_attach(bus, &devices[d], sends[d], sizeof(sends[d])) != ESP_OK)
+            {
+                ret = 2;
+            }
+        }
+        FILE* vcd = NULL;
+        if(ret != 2 && c == 0 && vcd_path)
+        {
+            vcd = fopen(vcd_path, "w");
+            if(!vcd)
+            {
+                perror(vcd_path);
+                ret = 2;
+            }
+            else
+            {
+                hulp_bus_vcd_start(bus, vcd);
+            }
+        }
+        if(ret == 2)
+        {
+            break;
+        }
+
+        unsigned long runs = 0;
+        hulp_sim_stop_t stop = hulp_sim_start(sim, entry_pc, max_cycles);
+        while(stop == HULP_SIM_HALT && ++runs < num_runs)
+        {
+            stop = hulp_sim_wake(sim, max_cycles);
+        }
+        hulp_bus_advance(bus, hulp_sim_time_ns(sim));
+        if(vcd)
+        {
+            fclose(vcd);
+        }
+
+        printf("@ %u Hz: %lu runs, %s, max %u cycles\n", (unsigned)clocks[c], runs, hulp_sim_stop_name(stop), (unsigned)sim->max_cycles);
+        if(stop != HULP_SIM_HALT && stop != HULP_SIM_TIMER_OFF)
+        {
+            ret = 1;
+        }
+        for(size_t d = 0; d < num_devices; ++d)
+        {
+            if(!device_print(&devices[d]))
+            {
+                ret = 1;
+            }
+        }
+        if(bus->contentions)
+        {
+            printf("%u contentions\n", (unsigned)bus->contentions);
+            ret = 1;
+        }
+    }
+
+    free(program);
+    free(sim);
+    free(bus);
+    return ret;
+}
@@ -0,0 +1,153 @@
+/**
+ * Average current and battery life of a ULP program image running periodically in deep sleep.
+ *
+ * Usage: hulp_energy [-e entry_pc] [-p period_us]... [-f fast_clk_hz] [-P] [-A] [-T] [-b capacity_mah] [-M name=ua]... image.bin
+ *
+ *  -p  wakeup period; repeat to compare several
+ *  -P  RTC_PERIPH forced on (hulp_peripherals_on)
+ *  -A  SAR ADC forced on outside the program (eg. hulp_tsens_configure)
+ *  -T  touch sensor FSM measuring in sleep
+ *  -M  override a current in the model: sleep, ulp, rtc_periph, adc, hall, touch (uA), or wake_overhead (us)
+ *
+ * image.bin is as per hulp_wcet.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hulp_energy.h"
+
+#include "hulp_image.h"
+
+#define HULP_ENERGY_MAX_PERIODS 8
+#define HULP_ENERGY_DEFAULT_MAX_STATES (1 << 18)
+
+static void usage(const char* name)
+{
+    fprintf(stderr, "Usage: %s [-e entry_pc] [-p period_us]... [-f fast_clk_hz] [-P] [-A] [-T] [-b capacity_mah] [-M name=value]... image.bin\n", name);
+}
+
+static int set_model(hulp_energy_model_t* model, const char* arg)
+{
+    const char* eq = strchr(arg, '=');
+    if(!eq)
+    {
+        return -1;
+    }
+    size_t len = eq - arg;
+    float value = strtof(eq + 1, NULL);
+    struct {
+        const char* name;
+        float* ua;
+    } const currents[] = {
+        { "sleep", &model->sleep_ua },
+        { "ulp", &model->ulp_ua },
+        { "rtc_periph", &model->rtc_periph_ua },
+        { "adc", &model->adc_ua },
+        { "hall", &model->hall_ua },
+        { "touch", &model->touch_ua },
+    };
+    for(size_t i = 0; i < sizeof(currents) / sizeof(currents[0]); ++i)
+    {
+        if(strlen(currents[i].name) == len && strncmp(arg, currents[i].name, len) == 0)
+        {
+            *currents[i].ua = value;
+            return 0;
+        }
+    }
+    if(strncmp(arg, "wake_overhead", len) == 0 && len == strlen("wake_overhead"))
+    {
+        model->wake_overhead_us = (uint32_t)value;
+        return 0;
+    }
+    return -1;
+}
+
+int main(int argc, char** argv)
+{
+    hulp_energy_config_t config = HULP_ENERGY_CONFIG_DEFAULT();
+    config.timing.max_states = HULP_ENERGY_DEFAULT_MAX_STATES;
+    uint16_t entry_pc = 0;
+    uint32_t periods[HULP_ENERGY_MAX_PERIODS];
+    size_t num_periods = 0;
+    float capacity_mah = 0;
+
+    int opt;
+    while((opt = getopt(argc, argv, "e:p:f:PATb:M:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'e':
+                entry_pc = (uint16_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                if(num_periods == HULP_ENERGY_MAX_PERIODS)
+                {
+                    fprintf(stderr, "Too many periods\n");
+                    return 2;
+                }
+                periods[num_periods++] = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                config.fast_clk_hz = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'P':
+                config.rtc_periph_on = true;
+                break;
+            case 'A':
+                config.adc_on = true;
+                break;
+            case 'T':
+                config.touch_on = true;
+                break;
+            case 'b':
+                capacity_mah = strtof(optarg, NULL);
+                break;
+            case 'M':
+                if(set_model(&config.model, optarg) != 0)
+                {
+                    fprintf(stderr, "Unknown model parameter: %s\n", optarg);
+                    return 2;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if(optind != argc - 1)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    if(num_periods == 0)
+    {
+        periods[num_periods++] = config.period_us;
+    }
+
+    size_t num_words;
+    ulp_insn_t* program = hulp_image_read(argv[optind], &num_words);
+    if(!program)
+    {
+        return 2;
+    }
+
+    int ret = 0;
+    for(size_t p = 0; p < num_periods; ++p)
+    {
+        hulp_energy_estimate_t estimate;
+        config.period_us = periods[p];
+        printf("period %u us:\n", (unsigned)periods[p]);
+        if(hulp_energy_estimate(program, num_words, entry_pc, &config, &estimate) != ESP_OK)
+        {
+            ret = 2;
+            break;
+        }
+        hulp_energy_print(&estimate, capacity_mah);
+    }
+
+    free(program);
+    return ret;
+}
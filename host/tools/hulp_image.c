@@ -0,0 +1,72 @@
+#include "hulp_image.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ULP_BINARY_MAGIC 0x00706c75
+
+static ulp_insn_t* hulp_image_load(const char* path, size_t* num_words, bool with_data)
+{
+    FILE* f = fopen(path, "rb");
+    if(!f)
+    {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t* bytes = (uint8_t*)malloc(size > 0 ? size : 1);
+    if(!bytes || fread(bytes, 1, size, f) != (size_t)size)
+    {
+        fprintf(stderr, "%s: read failed\n", path);
+        fclose(f);
+        free(bytes);
+        return NULL;
+    }
+    fclose(f);
+
+    size_t offset = 0;
+    size_t length = (size_t)size;
+    size_t bss = 0;
+    if(length >= 12 && (bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24) == ULP_BINARY_MAGIC)
+    {
+        // Header: magic, text offset, text size, data size, bss size
+        offset = bytes[4] | bytes[5] << 8;
+        length = bytes[6] | bytes[7] << 8;
+        if(with_data)
+        {
+            // Data follows text, and bss is zeroed after it
+            length += bytes[8] | bytes[9] << 8;
+            bss = bytes[10] | bytes[11] << 8;
+        }
+        if(offset + length > (size_t)size)
+        {
+            fprintf(stderr, "%s: invalid ULP binary header\n", path);
+            free(bytes);
+            return NULL;
+        }
+    }
+
+    size_t file_words = length / sizeof(uint32_t);
+    *num_words = file_words + bss / sizeof(uint32_t);
+    ulp_insn_t* program = (ulp_insn_t*)calloc(*num_words ? *num_words : 1, sizeof(ulp_insn_t));
+    for(size_t i = 0; program && i < file_words; ++i)
+    {
+        const uint8_t* w = &bytes[offset + i * sizeof(uint32_t)];
+        program[i].instruction = w[0] | w[1] << 8 | w[2] << 16 | (uint32_t)w[3] << 24;
+    }
+    free(bytes);
+    return program;
+}
+
+ulp_insn_t* hulp_image_read(const char* path, size_t* num_words)
+{
+    return hulp_image_load(path, num_words, false);
+}
+
+ulp_insn_t* hulp_image_read_mem(const char* path, size_t* num_words)
+{
+    return hulp_image_load(path, num_words, true);
+}
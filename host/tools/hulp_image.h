@@ -0,0 +1,21 @@
+#ifndef HULP_IMAGE_H
+#define HULP_IMAGE_H
+
+#include <stddef.h>
+
+#include "hulp_compat.h"
+
+/**
+ * Read a program image for the host tools: either a ULP binary (as loaded by ulp_load_binary, in which case only
+ * its text section is returned), or raw little-endian instruction words (eg. dumped from hulp_process_macros).
+ * Returns NULL on failure. Free with free().
+ */
+ulp_insn_t* hulp_image_read(const char* path, size_t* num_words);
+
+/**
+ * As per hulp_image_read, but a ULP binary's data and (zeroed) bss sections are included after its text, as laid out
+ * in RTC_SLOW_MEM by ulp_load_binary.
+ */
+ulp_insn_t* hulp_image_read_mem(const char* path, size_t* num_words);
+
+#endif /* HULP_IMAGE_H */
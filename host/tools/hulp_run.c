@@ -0,0 +1,171 @@
+/**
+ * Run a ULP program image in the simulator for a number of wakeups, and report its cycles.
+ *
+ * Usage: hulp_run [-e entry_pc] [-n wakeups] [-p period_us] [-f fast_clk_hz] [-c max_cycles] [-P] [-d addr:count]... image.bin
+ *
+ *  -n  number of times the program is run (default 1000)
+ *  -c  cycle limit of each run (default 1000000)
+ *  -P  print the cycles spent at each PC
+ *  -d  dump RTC_SLOW_MEM words (addr and count in words) after the last run
+ *
+ * image.bin is as per hulp_wcet; a ULP binary's data and bss are loaded too. Inputs (registers, I2C, ADC) read 0.
+ * Exits with 1 if the program does not halt or executes an invalid instruction.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hulp_sim.h"
+
+#include "hulp_image.h"
+
+#define HULP_RUN_MAX_DUMPS 16
+
+static void usage(const char* name)
+{
+    fprintf(stderr, "Usage: %s [-e entry_pc] [-n wakeups] [-p period_us] [-f fast_clk_hz] [-c max_cycles] [-P] [-d addr:count]... image.bin\n", name);
+}
+
+static double host_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv)
+{
+    hulp_sim_config_t config = HULP_SIM_CONFIG_DEFAULT();
+    uint16_t entry_pc = 0;
+    unsigned long num_runs = 1000;
+    uint32_t max_cycles = 1000000;
+    bool print_profile = false;
+    struct {
+        uint32_t addr;
+        uint32_t count;
+    } dumps[HULP_RUN_MAX_DUMPS];
+    size_t num_dumps = 0;
+
+    int opt;
+    while((opt = getopt(argc, argv, "e:n:p:f:c:Pd:")) != -1)
+    {
+        char* end;
+        switch(opt)
+        {
+            case 'e':
+                entry_pc = (uint16_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                num_runs = strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                config.period_us = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                config.fast_clk_hz = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'c':
+                max_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'P':
+                print_profile = true;
+                break;
+            case 'd':
+                if(num_dumps == HULP_RUN_MAX_DUMPS)
+                {
+                    fprintf(stderr, "Too many dumps\n");
+                    return 2;
+                }
+                dumps[num_dumps].addr = (uint32_t)strtoul(optarg, &end, 0);
+                dumps[num_dumps].count = (*end == ':') ? (uint32_t)strtoul(end + 1, NULL, 0) : 1;
+                ++num_dumps;
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if(optind != argc - 1 || num_runs == 0)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    size_t num_words;
+    ulp_insn_t* program = hulp_image_read_mem(argv[optind], &num_words);
+    if(!program)
+    {
+        return 2;
+    }
+
+    hulp_sim_t* sim = (hulp_sim_t*)malloc(sizeof(hulp_sim_t));
+    uint64_t* profile = print_profile ? (uint64_t*)calloc(HULP_SIM_MEM_WORDS, sizeof(uint64_t)) : NULL;
+    if(!sim || (print_profile && !profile) || hulp_sim_init(sim, &config) != ESP_OK || hulp_sim_load(sim, 0, program, num_words) != ESP_OK)
+    {
+        free(program);
+        free(sim);
+        free(profile);
+        return 2;
+    }
+    free(program);
+    sim->profile = profile;
+
+    uint32_t min_cycles = UINT32_MAX;
+    unsigned long runs = 0;
+    double start = host_seconds();
+    hulp_sim_stop_t stop = hulp_sim_start(sim, entry_pc, max_cycles);
+    while(stop == HULP_SIM_HALT)
+    {
+        if(sim->last_cycles < min_cycles)
+        {
+            min_cycles = sim->last_cycles;
+        }
+        if(++runs == num_runs)
+        {
+            break;
+        }
+        stop = hulp_sim_wake(sim, max_cycles);
+    }
+    double elapsed = host_seconds() - start;
+
+    printf("%lu runs: %s", runs, hulp_sim_stop_name(stop));
+    if(stop != HULP_SIM_HALT && stop != HULP_SIM_TIMER_OFF)
+    {
+        printf(" at pc %u", sim->pc);
+    }
+    printf("\n");
+    if(runs)
+    {
+        printf("cycles per run: min %u, avg %.1f, max %u (%.1f us max @ %u Hz)\n", (unsigned)min_cycles,
+            (double)sim->cycles / sim->runs, (unsigned)sim->max_cycles, sim->max_cycles * 1e6 / config.fast_clk_hz, (unsigned)config.fast_clk_hz);
+    }
+    printf("wakeups: %u, simulated time: %.3f s, host: %.0f runs/s\n", (unsigned)sim->wakeups,
+        hulp_sim_time_ns(sim) / 1e9, elapsed > 0 ? sim->runs / elapsed : 0);
+
+    if(profile)
+    {
+        printf("profile (pc: cycles):\n");
+        for(size_t pc = 0; pc < HULP_SIM_MEM_WORDS; ++pc)
+        {
+            if(profile[pc])
+            {
+                printf("  %4u: %llu\n", (unsigned)pc, (unsigned long long)profile[pc]);
+            }
+        }
+    }
+    for(size_t d = 0; d < num_dumps; ++d)
+    {
+        for(uint32_t i = 0; i < dumps[d].count && dumps[d].addr + i < HULP_SIM_MEM_WORDS; ++i)
+        {
+            uint32_t word = sim->mem[dumps[d].addr + i];
+            printf("[%u] 0x%04x (pc %u)\n", (unsigned)(dumps[d].addr + i), (unsigned)(word & 0xFFFF), (unsigned)(word >> 21));
+        }
+    }
+
+    free(profile);
+    free(sim);
+    return (stop == HULP_SIM_HALT || stop == HULP_SIM_TIMER_OFF) ? 0 : 1;
+}
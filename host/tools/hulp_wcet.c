@@ -0,0 +1,141 @@
+/**
+ * Worst-case execution time of a ULP program image, per entry point.
+ *
+ * Usage: hulp_wcet [-e entry_pc]... [-f fast_clk_hz]... [-s max_states] [-m max_us] image.bin
+ *
+ * image.bin is either a ULP binary (as loaded by ulp_load_binary), or raw little-endian instruction words
+ * (eg. dumped from hulp_process_macros).
+ * With -m, exits with 1 if any entry point is unbounded or its worst case exceeds max_us at any given clock,
+ * so that it can be used as a regression gate.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hulp_timing.h"
+
+#include "hulp_image.h"
+
+#define HULP_WCET_MAX_ENTRIES 32
+#define HULP_WCET_MAX_CLOCKS 8
+#define HULP_WCET_DEFAULT_CLK_HZ 8500000
+#define HULP_WCET_DEFAULT_MAX_STATES (1 << 18)
+
+static void usage(const char* name)
+{
+    fprintf(stderr, "Usage: %s [-e entry_pc]... [-f fast_clk_hz]... [-s max_states] [-m max_us] image.bin\n", name);
+}
+
+int main(int argc, char** argv)
+{
+    uint16_t entries[HULP_WCET_MAX_ENTRIES];
+    size_t num_entries = 0;
+    uint32_t clocks[HULP_WCET_MAX_CLOCKS];
+    size_t num_clocks = 0;
+    long max_us = -1;
+    hulp_timing_config_t config = HULP_TIMING_CONFIG_DEFAULT();
+    config.max_states = HULP_WCET_DEFAULT_MAX_STATES;
+
+    int opt;
+    while((opt = getopt(argc, argv, "e:f:s:m:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'e':
+                if(num_entries == HULP_WCET_MAX_ENTRIES)
+                {
+                    fprintf(stderr, "Too many entry points\n");
+                    return 2;
+                }
+                entries[num_entries++] = (uint16_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                if(num_clocks == HULP_WCET_MAX_CLOCKS)
+                {
+                    fprintf(stderr, "Too many clocks\n");
+                    return 2;
+                }
+                clocks[num_clocks++] = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                config.max_states = strtoul(optarg, NULL, 0);
+                break;
+            case 'm':
+                max_us = strtol(optarg, NULL, 0);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if(optind != argc - 1)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    if(num_entries == 0)
+    {
+        entries[num_entries++] = 0;
+    }
+    if(num_clocks == 0)
+    {
+        clocks[num_clocks++] = HULP_WCET_DEFAULT_CLK_HZ;
+    }
+
+    size_t num_words;
+    ulp_insn_t* program = hulp_image_read(argv[optind], &num_words);
+    if(!program)
+    {
+        return 2;
+    }
+
+    int ret = 0;
+    for(size_t e = 0; e < num_entries; ++e)
+    {
+        hulp_timing_t timing;
+        esp_err_t err = hulp_timing_analyse(program, num_words, entries[e], &config, &timing);
+        if(err != ESP_OK)
+        {
+            printf("entry %u: analysis failed (0x%x)\n", entries[e], err);
+            ret = 2;
+            continue;
+        }
+        if(timing.bounded)
+        {
+            printf("entry %u: best %u cycles, worst %u cycles (%u states)\n", entries[e],
+                (unsigned)timing.best_cycles, (unsigned)timing.worst_cycles, (unsigned)timing.num_states);
+        }
+        else
+        {
+            printf("entry %u: best %u cycles, worst unbounded at pc %u (%u states)\n", entries[e],
+                (unsigned)timing.best_cycles, timing.unbounded_pc, (unsigned)timing.num_states);
+            if(max_us >= 0)
+            {
+                ret = ret ? ret : 1;
+            }
+        }
+        for(size_t c = 0; c < num_clocks; ++c)
+        {
+            uint32_t best_us = hulp_timing_cycles_to_us(timing.best_cycles, clocks[c]);
+            uint32_t worst_us = hulp_timing_cycles_to_us(timing.worst_cycles, clocks[c]);
+            if(timing.bounded)
+            {
+                printf("  @ %u Hz: best %u us, worst %u us\n", (unsigned)clocks[c], (unsigned)best_us, (unsigned)worst_us);
+            }
+            else
+            {
+                printf("  @ %u Hz: best %u us\n", (unsigned)clocks[c], (unsigned)best_us);
+            }
+            if(timing.bounded && max_us >= 0 && worst_us > (unsigned long)max_us)
+            {
+                printf("  exceeds %ld us\n", max_us);
+                ret = ret ? ret : 1;
+            }
+        }
+    }
+
+    free(program);
+    return ret;
+}
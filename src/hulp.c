@@ -1,9 +1,13 @@
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
 
 #include "esp_system.h"
 #include "esp_sleep.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
 #include "esp_idf_version.h"
 #include "esp32/rom/ets_sys.h"
 #include "driver/gpio.h"
@@ -16,6 +20,7 @@
 #include "soc/rtc.h"
 
 #include "hulp.h"
+#include "hulp_cfg.h"
 #include "hulp_compat.h"
 #include "hulp_config.h"
 
@@ -137,14 +142,48 @@ void hulp_peripherals_on(void)
     esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_PERIPH, ESP_PD_OPTION_ON);
 }
 
-static uint64_t hulp_us_to_ticks(uint64_t time_us)
+/**
+ * Cached fast clock calibration, so that building a program (many macros each querying the clock) does not repeat it.
+ * Refreshed after CONFIG_HULP_CLK_CACHE_REFRESH_MS (if not 0) or hulp_clk_cache_invalidate.
+ * Each field is a single word, so a task reading the cache while another recalibrates gets the old or the new frequency.
+ */
+static struct {
+    uint32_t fast_freq;     // 0 if not calibrated
+    uint32_t fast_time_ms;
+} s_clk_cache;
+
+static uint32_t hulp_clk_cache_now_ms(void)
 {
-    return rtc_time_us_to_slowclk(time_us, esp_clk_slowclk_cal_get());
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static bool hulp_clk_cache_expired(void)
+{
+#if CONFIG_HULP_CLK_CACHE_REFRESH_MS > 0
+    return (uint32_t)(hulp_clk_cache_now_ms() - s_clk_cache.fast_time_ms) >= CONFIG_HULP_CLK_CACHE_REFRESH_MS;
+#else
+    return false;
+#endif
+}
+
+void hulp_clk_cache_invalidate(void)
+{
+    s_clk_cache.fast_freq = 0;
+}
+
+uint32_t hulp_get_slow_clk_cal(void)
+{
+    return esp_clk_slowclk_cal_get();
+}
+
+static uint64_t hulp_ms_to_ticks(uint32_t time_ms)
+{
+    return rtc_time_us_to_slowclk(1000ULL * time_ms, hulp_get_slow_clk_cal());
 }
 
 uint16_t hulp_ms_to_ulp_ticks_with_shift(uint32_t time_ms, uint8_t shift)
 {
-    return (uint16_t)((hulp_us_to_ticks(1000ULL * time_ms) >> shift) & 0xFFFF);
+    return (uint16_t)((hulp_ms_to_ticks(time_ms) >> shift) & 0xFFFF);
 }
 
 uint16_t hulp_ms_to_ulp_ticks(uint32_t time_ms)
@@ -159,7 +198,7 @@ uint16_t hulp_get_current_ulp_ticks(uint8_t shift)
 
 uint8_t hulp_ms_to_ulp_tick_shift(uint32_t time_ms)
 {
-    uint64_t rtc_slow_ticks = hulp_us_to_ticks(1000ULL * time_ms);
+    uint64_t rtc_slow_ticks = hulp_ms_to_ticks(time_ms);
     if(rtc_slow_ticks == 0)
     {
         return 1;
@@ -210,382 +249,302 @@ uint16_t hulp_get_label_pc(uint16_t label, const ulp_insn_t *program)
     abort();
 }
 
-static uint32_t periph_sel_to_reg_base(uint32_t sel) {
-    if(sel == 0) {
-        return DR_REG_RTCCNTL_BASE;
-    } else if (sel == 1) {
-        return DR_REG_RTCIO_BASE;
-    } else if (sel == 2) {
-        return DR_REG_SENS_BASE;
-    } else /* if (sel == 3) */ {
-        return DR_REG_RTC_I2C_BASE;
-    }
+static int hulp_label_pc_cmp_label(const void* a, const void* b)
+{
+    return (int)((const hulp_label_pc_t*)a)->label - (int)((const hulp_label_pc_t*)b)->label;
 }
 
-int hulp_print_instruction(const ulp_insn_t *ins)
+esp_err_t hulp_program_index_init(hulp_program_index_t* index, const ulp_insn_t* program, size_t num_words)
 {
-    switch(ins->b.opcode)
+    if(!index || (!program && num_words > 0))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    index->by_label = NULL;
+    index->by_pc = NULL;
+    index->num_labels = 0;
+    index->num_words = 0;
+
+    size_t num_labels = 0;
+    for(size_t i = 0; i < num_words; ++i)
     {
-        case OPCODE_WR_REG:
+        if(program[i].macro.opcode == OPCODE_MACRO && program[i].macro.sub_opcode == SUB_OPCODE_MACRO_LABEL)
         {
-            return printf("I_WR_REG(0x%08X, %u, %u, %u)",
-                (unsigned int)(periph_sel_to_reg_base(ins->wr_reg.periph_sel) + ins->wr_reg.addr * sizeof(uint32_t)),
-                ins->wr_reg.low,
-                ins->wr_reg.high,
-                ins->wr_reg.data
-            );
+            ++num_labels;
         }
-        case OPCODE_RD_REG:
+    }
+
+    if(num_labels > 0)
+    {
+        // One allocation for both tables
+        index->by_pc = (hulp_label_pc_t*)malloc(2 * num_labels * sizeof(hulp_label_pc_t));
+        if(!index->by_pc)
         {
-            return printf("I_RD_REG(0x%08X, %u, %u)",
-                (unsigned int)(periph_sel_to_reg_base(ins->rd_reg.periph_sel) + ins->rd_reg.addr * sizeof(uint32_t)),
-                ins->rd_reg.low,
-                ins->rd_reg.high
-            );
+            ESP_LOGE(TAG, "[%s] no memory for %u labels", __func__, (unsigned)num_labels);
+            return ESP_ERR_NO_MEM;
         }
-        case OPCODE_I2C:
+        index->by_label = index->by_pc + num_labels;
+    }
+
+    // Labels are found in program order, so by_pc is sorted as it is populated
+    uint16_t pc = 0;
+    hulp_label_pc_t* entry = index->by_pc;
+    for(size_t i = 0; i < num_words; ++i)
+    {
+        if(program[i].macro.opcode == OPCODE_MACRO)
         {
-            return printf("I_I2C_RW(%u, %u, %u, %u, %u, %u)",
-                ins->i2c.i2c_addr,
-                ins->i2c.data,
-                ins->i2c.low_bits,
-                ins->i2c.high_bits,
-                ins->i2c.i2c_sel,
-                ins->i2c.rw
-            );
+            if(program[i].macro.sub_opcode == SUB_OPCODE_MACRO_LABEL)
+            {
+                entry->label = program[i].macro.label;
+                entry->pc = pc;
+                ++entry;
+            }
         }
-        case OPCODE_DELAY:
+        else
         {
-            return printf("I_DELAY(%u)",
-                ins->delay.cycles
-            );
+            ++pc;
         }
-        case OPCODE_ADC:
+    }
+    index->num_labels = num_labels;
+    index->num_words = pc;
+
+    if(num_labels > 0)
+    {
+        memcpy(index->by_label, index->by_pc, num_labels * sizeof(hulp_label_pc_t));
+        qsort(index->by_label, num_labels, sizeof(hulp_label_pc_t), hulp_label_pc_cmp_label);
+        for(size_t i = 1; i < num_labels; ++i)
         {
-            return printf("I_ADC(R%u, %u, %u)",
-                ins->adc.dreg,
-                ins->adc.sar_sel,
-                ins->adc.mux - 1
-            );
+            if(index->by_label[i].label == index->by_label[i - 1].label)
+            {
+                ESP_LOGE(TAG, "[%s] duplicate label %u", __func__, index->by_label[i].label);
+                hulp_program_index_deinit(index);
+                return ESP_ERR_ULP_DUPLICATE_LABEL;
+            }
         }
-        case OPCODE_ST:
+    }
+
+    return ESP_OK;
+}
+
+void hulp_program_index_deinit(hulp_program_index_t* index)
+{
+    if(index)
+    {
+        free(index->by_pc);
+        index->by_pc = NULL;
+        index->by_label = NULL;
+        index->num_labels = 0;
+        index->num_words = 0;
+    }
+}
+
+esp_err_t hulp_program_index_find_pc(const hulp_program_index_t* index, uint16_t label, uint16_t* pc)
+{
+    const hulp_label_pc_t key = {.label = label};
+    const hulp_label_pc_t* found = (const hulp_label_pc_t*)bsearch(&key, index->by_label, index->num_labels, sizeof(hulp_label_pc_t), hulp_label_pc_cmp_label);
+    if(!found)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+    *pc = found->pc;
+    return ESP_OK;
+}
+
+esp_err_t hulp_program_index_find_label(const hulp_program_index_t* index, uint16_t pc, uint16_t* label)
+{
+    // Lower bound, so that the first of several labels at the same PC is returned
+    size_t low = 0;
+    size_t high = index->num_labels;
+    while(low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+        if(index->by_pc[mid].pc < pc)
         {
-            return printf("I_ST(R%u, R%u, %u)",
-                ins->st.dreg,
-                ins->st.sreg,
-                ins->st.offset
-            );
+            low = mid + 1;
         }
-        case OPCODE_ALU:
+        else
+        {
+            high = mid;
+        }
+    }
+    if(low == index->num_labels || index->by_pc[low].pc != pc)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+    *label = index->by_pc[low].label;
+    return ESP_OK;
+}
+
+/**
+ * Apply a relocation macro to the (already copied) instruction(s) at pc.
+ * As with ulp_process_macros_and_load, label addresses are relative to the start of the program.
+ */
+static esp_err_t hulp_apply_macro(ulp_insn_t* code, size_t num_words, uint16_t pc, const ulp_insn_t* macro, uint16_t label_pc)
+{
+    ulp_insn_t* insn = &code[pc];
+    switch(macro->macro.sub_opcode)
+    {
+        case SUB_OPCODE_MACRO_BRANCH:
         {
-            switch(ins->alu_reg.sub_opcode)
+            if(insn->b.opcode != OPCODE_BRANCH)
+            {
+                break;
+            }
+            if(insn->b.sub_opcode == SUB_OPCODE_BX)
+            {
+                insn->bx.addr = label_pc;
+                return ESP_OK;
+            }
+            int32_t offset = (int32_t)label_pc - (int32_t)pc;
+            uint32_t abs_offset = (uint32_t)abs(offset);
+            if(abs_offset > 127)
             {
-                case SUB_OPCODE_ALU_REG:
-                {
-                    switch(ins->alu_reg.sel)
-                    {
-                        case ALU_SEL_ADD:
-                        {
-                            return printf("I_ADDR(R%u, R%u, R%u)",
-                                ins->alu_reg.dreg,
-                                ins->alu_reg.sreg,
-                                ins->alu_reg.treg
-                            );
-                        }
-                        case ALU_SEL_SUB:
-                        {
-                            return printf("I_SUBR(R%u, R%u, R%u)",
-                                ins->alu_reg.dreg,
-                                ins->alu_reg.sreg,
-                                ins->alu_reg.treg
-                            );
-                        }
-                        case ALU_SEL_AND:
-                        {
-                            return printf("I_ANDR(R%u, R%u, R%u)",
-                                ins->alu_reg.dreg,
-                                ins->alu_reg.sreg,
-                                ins->alu_reg.treg
-                            );
-                        }
-                        case ALU_SEL_OR:
-                        {
-                            return printf("I_ORR(R%u, R%u, R%u)",
-                                ins->alu_reg.dreg,
-                                ins->alu_reg.sreg,
-                                ins->alu_reg.treg
-                            );
-                        }
-                        case ALU_SEL_MOV:
-                        {
-                            return printf("I_MOVR(R%u, R%u)",
-                                ins->alu_reg.dreg,
-                                ins->alu_reg.sreg
-                            );
-                        }
-                        case ALU_SEL_LSH:
-                        {
-                            return printf("I_LSHR(R%u, R%u, R%u)",
-                                ins->alu_reg.dreg,
-                                ins->alu_reg.sreg,
-                                ins->alu_reg.treg
-                            );
-                        }
-                        case ALU_SEL_RSH:
-                        {
-                            return printf("I_RSHR(R%u, R%u, R%u)",
-                                ins->alu_reg.dreg,
-                                ins->alu_reg.sreg,
-                                ins->alu_reg.treg
-                            );
-                        }
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case SUB_OPCODE_ALU_IMM:
-                {
-                    switch(ins->alu_imm.sel)
-                    {
-                        case ALU_SEL_ADD:
-                        {
-                            return printf("I_ADDI(R%u, R%u, %u)",
-                                ins->alu_imm.dreg,
-                                ins->alu_imm.sreg,
-                                ins->alu_imm.imm
-                            );
-                        }
-                        case ALU_SEL_SUB:
-                        {
-                            return printf("I_SUBI(R%u, R%u, %u)",
-                                ins->alu_imm.dreg,
-                                ins->alu_imm.sreg,
-                                ins->alu_imm.imm
-                            );
-                        }
-                        case ALU_SEL_AND:
-                        {
-                            return printf("I_ANDI(R%u, R%u, %u)",
-                                ins->alu_imm.dreg,
-                                ins->alu_imm.sreg,
-                                ins->alu_imm.imm
-                            );
-                        }
-                        case ALU_SEL_OR:
-                        {
-                            return printf("I_ORI(R%u, R%u, %u)",
-                                ins->alu_imm.dreg,
-                                ins->alu_imm.sreg,
-                                ins->alu_imm.imm
-                            );
-                        }
-                        case ALU_SEL_MOV:
-                        {
-                            return printf("I_MOVI(R%u, %u)",
-                                ins->alu_imm.dreg,
-                                ins->alu_imm.imm
-                            );
-                        }
-                        case ALU_SEL_LSH:
-                        {
-                            return printf("I_LSHI(R%u, R%u, %u)",
-                                ins->alu_imm.dreg,
-                                ins->alu_imm.sreg,
-                                ins->alu_imm.imm
-                            );
-                        }
-                        case ALU_SEL_RSH:
-                        {
-                            return printf("I_RSHI(R%u, R%u, %u)",
-                                ins->alu_imm.dreg,
-                                ins->alu_imm.sreg,
-                                ins->alu_imm.imm
-                            );
-                        }
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case SUB_OPCODE_ALU_CNT:
-                {
-                    switch(ins->alu_reg_s.sel)
-                    {
-                        case ALU_SEL_SINC:
-                        {
-                            return printf("I_STAGE_INC(%u)",
-                                ins->alu_reg_s.imm
-                            );
-                        }
-                        case ALU_SEL_SDEC:
-                        {
-                            return printf("I_STAGE_DEC(%u)",
-                                ins->alu_reg_s.imm
-                            );
-                        }
-                        case ALU_SEL_SRST:
-                        {
-                            return printf("I_STAGE_RST()");
-                        }
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
+                ESP_LOGE(TAG, "[%s] branch to label %u out of range (pc %u, offset %" PRIi32 ")", __func__, macro->macro.label, pc, offset);
+                return ESP_ERR_ULP_BRANCH_OUT_OF_RANGE;
+            }
+            if(insn->b.sub_opcode == SUB_OPCODE_BR)
+            {
+                insn->b.offset = abs_offset;
+                insn->b.sign = (offset < 0) ? 1 : 0;
+                return ESP_OK;
+            }
+            if(insn->bs.sub_opcode == SUB_OPCODE_BS)
+            {
+                insn->bs.offset = abs_offset;
+                insn->bs.sign = (offset < 0) ? 1 : 0;
+                return ESP_OK;
             }
             break;
         }
-        case OPCODE_BRANCH:
+        case SUB_OPCODE_MACRO_LABELPC:
         {
-            switch(ins->b.sub_opcode)
+            if(insn->alu_imm.opcode != OPCODE_ALU || insn->alu_imm.sub_opcode != SUB_OPCODE_ALU_IMM || insn->alu_imm.sel != ALU_SEL_MOV)
             {
-                case SUB_OPCODE_BX:
-                {
-                    switch(ins->bx.type)
-                    {
-                        case BX_JUMP_TYPE_DIRECT:
-                        {
-                            if(ins->bx.reg)
-                            {
-                                return printf("I_BXR(R%u)",
-                                    ins->bx.dreg
-                                );
-                            }
-                            else
-                            {
-                                return printf("I_BXI(%u)",
-                                    ins->bx.addr
-                                );
-                            }
-                        }
-                        case BX_JUMP_TYPE_ZERO:
-                        {
-                            if(ins->bx.reg)
-                            {
-                                return printf("I_BXZR(R%u)",
-                                    ins->bx.dreg
-                                );
-                            }
-                            else
-                            {
-                                return printf("I_BXZI(%u)",
-                                    ins->bx.addr
-                                );
-                            }
-                        }
-                        case BX_JUMP_TYPE_OVF:
-                        {
-                            if(ins->bx.reg)
-                            {
-                                return printf("I_BXFR(R%u)",
-                                    ins->bx.dreg
-                                );
-                            }
-                            else
-                            {
-                                return printf("I_BXFI(%u)",
-                                    ins->bx.addr
-                                );
-                            }
-                        }
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case SUB_OPCODE_BR:
-                {
-                    if(ins->b.cmp == B_CMP_L)
-                    {
-                        return printf("I_BL(%s%u, %u)",
-                            ins->b.sign ? "-" : "",
-                            ins->b.offset,
-                            ins->b.imm
-                        );
-                    }
-                    else
-                    {
-                        return printf("I_BGE(%s%u, %u)",
-                            ins->b.sign ? "-" : "",
-                            ins->b.offset,
-                            ins->b.imm
-                        );
-                    }
-                }
-                case SUB_OPCODE_BS:
-                {
-                    return printf("I_JUMPS(%s%u, %u, %s)",
-                        ins->bs.sign ? "-" : "",
-                        ins->bs.offset,
-                        ins->bs.imm,
-                            (   ins->bs.cmp == JUMPS_LT ?   "JUMPS_LT" :
-                            (   ins->bs.cmp == JUMPS_GE ?   "JUMPS_GE" :
-                                                            "JUMPS_LE"
-                            ))
-                    );
-                }
-                default:
-                    break;
+                break;
             }
-            break;
+            insn->alu_imm.imm = label_pc;
+            return ESP_OK;
         }
-        case OPCODE_END:
+        case HULP_SUB_OPCODE_MACRO_ENTRYPC:
         {
-            switch(ins->end.sub_opcode)
+            // M_SET_ENTRY: upper 3 bits, then lower 8 bits
+            if(pc + 1u >= num_words || insn[0].wr_reg.opcode != OPCODE_WR_REG || insn[1].wr_reg.opcode != OPCODE_WR_REG)
             {
-                case SUB_OPCODE_END:
-                {
-                    return printf("I_WAKE()");
-                }
-                case SUB_OPCODE_SLEEP:
-                {
-                    return printf("I_SLEEP_CYCLE_SEL(%u)",
-                        ins->sleep.cycle_sel
-                    );
-                }
-                default:
-                    break;
+                break;
             }
-            break;
+            uint32_t entry = (uint32_t)label_pc + macro->macro.unused;
+            insn[0].wr_reg.data = (entry >> 8) & 0x7;
+            insn[1].wr_reg.data = entry & 0xFF;
+            return ESP_OK;
         }
-        case OPCODE_TSENS:
+        default:
+            break;
+    }
+    ESP_LOGE(TAG, "[%s] macro (sub_opcode %u, label %u) not followed by a compatible instruction (pc %u)", __func__, macro->macro.sub_opcode, macro->macro.label, pc);
+    return ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t hulp_process_macros(ulp_insn_t* dest, size_t max_words, const ulp_insn_t* program, size_t* psize)
+{
+    hulp_program_index_t index;
+    esp_err_t err = hulp_program_index_init(&index, program, *psize);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+
+    if(index.num_words > max_words)
+    {
+        hulp_program_index_deinit(&index);
+        return ESP_ERR_ULP_SIZE_TOO_BIG;
+    }
+
+    uint16_t pc = 0;
+    for(size_t i = 0; i < *psize; ++i)
+    {
+        if(program[i].macro.opcode != OPCODE_MACRO)
         {
-            return printf("I_TSENS(R%u, %u)",
-                ins->tsens.dreg,
-                ins->tsens.wait_delay
-            );
+            dest[pc++] = program[i];
         }
-        case OPCODE_HALT:
+    }
+
+    pc = 0;
+    for(size_t i = 0; i < *psize && err == ESP_OK; ++i)
+    {
+        const ulp_insn_t* insn = &program[i];
+        if(insn->macro.opcode != OPCODE_MACRO)
         {
-            return printf("I_HALT()");
+            ++pc;
         }
-        case OPCODE_LD:
+        else if(insn->macro.sub_opcode != SUB_OPCODE_MACRO_LABEL)
         {
-            return printf("I_LD(R%u, R%u, %u)",
-                ins->ld.dreg,
-                ins->ld.sreg,
-                ins->ld.offset
-            );
+            uint16_t label_pc;
+            if(pc >= index.num_words)
+            {
+                ESP_LOGE(TAG, "[%s] program ends with a macro (label %u)", __func__, insn->macro.label);
+                err = ESP_ERR_INVALID_ARG;
+            }
+            else if(hulp_program_index_find_pc(&index, insn->macro.label, &label_pc) != ESP_OK)
+            {
+                ESP_LOGE(TAG, "[%s] undefined label %u", __func__, insn->macro.label);
+                err = ESP_ERR_ULP_UNDEFINED_LABEL;
+            }
+            else
+            {
+                err = hulp_apply_macro(dest, index.num_words, pc, insn, label_pc);
+            }
         }
-        default:
-            break;
     }
-    return -1;
+
+    if(err == ESP_OK)
+    {
+        *psize = index.num_words;
+    }
+    hulp_program_index_deinit(&index);
+    return err;
 }
 
-void hulp_print_program(const ulp_insn_t *program, size_t num_instructions)
+/**
+ * Equivalent of ulp_process_macros_and_load, with support for HULP macros.
+ *
+ * psize: in: number of elements in program; out: number of instructions loaded
+ */
+static esp_err_t hulp_process_macros_and_load(uint32_t load_addr, const ulp_insn_t* program, size_t* psize)
 {
-    for(size_t i = 0; i < num_instructions; ++i)
+    const size_t max_words = HULP_ULP_RESERVE_MEM / sizeof(ulp_insn_t);
+    if(load_addr >= max_words)
     {
-        if(hulp_print_instruction(&program[i]) < 0)
-        {
-            printf("I_INVALID(0x%08X)", (unsigned int)program[i].instruction);
-        }
-        printf(",\n");
+        return ESP_ERR_ULP_INVALID_LOAD_ADDR;
     }
+    return hulp_process_macros((ulp_insn_t*)(RTC_SLOW_MEM + load_addr), max_words - load_addr, program, psize);
+}
+
+int hulp_print_instruction(const ulp_insn_t *ins)
+{
+    char buf[64];
+    hulp_decoded_insn_t decoded;
+    if(hulp_disasm_decode(ins, 0, &decoded) != ESP_OK)
+    {
+        return -1;
+    }
+    size_t len = hulp_disasm_format(&decoded, ins->instruction, NULL, buf, sizeof(buf));
+    return (int)fwrite(buf, 1, len, stdout);
+}
+
+static void hulp_print_sink(void* ctx, const char* text, size_t len)
+{
+    fwrite(text, 1, len, stdout);
+}
+
+void hulp_print_program(const ulp_insn_t *program, size_t num_instructions)
+{
+    hulp_disasm_range(program, num_instructions, 0, num_instructions, NULL, hulp_print_sink, NULL);
+}
+
+void hulp_print_program_symbolic(const ulp_insn_t *program, size_t num_instructions, const hulp_disasm_symbols_t* symbols)
+{
+    hulp_disasm_range(program, num_instructions, 0, num_instructions, symbols, hulp_print_sink, NULL);
 }
 
 esp_err_t hulp_ulp_run(uint32_t entry_point)
@@ -618,17 +577,267 @@ esp_err_t hulp_ulp_run_once(uint32_t entry_point)
 esp_err_t hulp_ulp_load(const ulp_insn_t *program, size_t size_of_program, uint32_t period_us, uint32_t entry_point)
 {
     size_t num_words = size_of_program / sizeof(ulp_insn_t);
-    esp_err_t err = ulp_process_macros_and_load(entry_point, program, &num_words);
+    esp_err_t err = hulp_process_macros_and_load(entry_point, program, &num_words);
+    if(err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "[%s] load error (0x%x)", __func__, err);
+        return err;
+    }
+    hulp_set_start_delay();
+    ulp_set_wakeup_period(0, period_us);
+    return ESP_OK;
+}
+
+esp_err_t hulp_ulp_load_delta(const ulp_insn_t *program, size_t size_of_program, uint32_t period_us, uint32_t load_addr, size_t *num_changed)
+{
+    const size_t max_words = HULP_ULP_RESERVE_MEM / sizeof(ulp_insn_t);
+    if(load_addr >= max_words)
+    {
+        return ESP_ERR_ULP_INVALID_LOAD_ADDR;
+    }
+
+    size_t num_words = size_of_program / sizeof(ulp_insn_t);
+    ulp_insn_t* image = (ulp_insn_t*)malloc(num_words * sizeof(ulp_insn_t));
+    if(!image)
+    {
+        ESP_LOGE(TAG, "[%s] no memory for program image", __func__);
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t err = hulp_process_macros(image, max_words - load_addr, program, &num_words);
     if(err != ESP_OK)
     {
         ESP_LOGE(TAG, "[%s] load error (0x%x)", __func__, err);
+        free(image);
         return err;
     }
+
+    size_t changed = 0;
+    volatile uint32_t* resident = RTC_SLOW_MEM + load_addr;
+    for(size_t i = 0; i < num_words; ++i)
+    {
+        if(resident[i] != image[i].instruction)
+        {
+            resident[i] = image[i].instruction;
+            ++changed;
+        }
+    }
+    free(image);
+
+    ESP_LOGD(TAG, "[%s] %u of %u words changed", __func__, (unsigned)changed, (unsigned)num_words);
+    if(num_changed)
+    {
+        *num_changed = changed;
+    }
+
     hulp_set_start_delay();
     ulp_set_wakeup_period(0, period_us);
     return ESP_OK;
 }
 
+#define HULP_RESIDENT_MAGIC 0x484C5052
+
+/**
+ * Describes the program loaded by hulp_ulp_ensure_loaded. Retained in RTC slow memory through deep sleep.
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t load_addr;
+    uint16_t num_words;
+    uint32_t program_hash;  /*!< Of the unprocessed program (less delay lengths), to detect a different program */
+    uint32_t image_hash;    /*!< Of the reachable instructions in RTC memory, to detect corruption */
+} hulp_resident_header_t;
+
+static RTC_DATA_ATTR hulp_resident_header_t s_resident;
+
+static inline uint32_t hulp_hash_words(uint32_t hash, uint32_t word)
+{
+    // FNV-1a, a word at a time
+    return (hash ^ word) * 16777619UL;
+}
+
+/**
+ * Hash an instruction of the unprocessed program. Delay lengths are left out, as they are calculated from the fast
+ * clock calibration (eg. M_DELAY_US_*, UART baud rates) which differs slightly on every boot.
+ */
+static inline uint32_t hulp_hash_source_insn(uint32_t hash, ulp_insn_t insn)
+{
+    if(insn.delay.opcode == OPCODE_DELAY)
+    {
+        insn.delay.cycles = 0;
+    }
+    return hulp_hash_words(hash, insn.instruction);
+}
+
+/**
+ * Hash the resident program, excluding words that are never executed as they may be written by the ULP (eg. M_IF_TICKS_ELAPSED).
+ * program is only used for the positions of its labels, which are the possible targets of indirect branches (M_MOVL/I_BXR).
+ */
+static esp_err_t hulp_hash_resident_image(const ulp_insn_t* program, size_t program_entries, uint32_t load_addr, size_t num_words, uint32_t* hash)
+{
+    const ulp_insn_t* image = (const ulp_insn_t*)(RTC_SLOW_MEM + load_addr);
+    bool* reachable = (bool*)calloc(num_words, sizeof(bool));
+    if(!reachable)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    reachable[0] = true;
+    size_t pc = 0;
+    for(size_t i = 0; i < program_entries; ++i)
+    {
+        if(program[i].macro.opcode != OPCODE_MACRO)
+        {
+            ++pc;
+        }
+        else if(program[i].macro.sub_opcode == SUB_OPCODE_MACRO_LABEL && pc < num_words)
+        {
+            reachable[pc] = true;
+        }
+    }
+
+    esp_err_t err = hulp_cfg_mark_reachable(image, num_words, reachable);
+    if(err == ESP_OK)
+    {
+        uint32_t h = 2166136261UL;
+        for(pc = 0; pc < num_words; ++pc)
+        {
+            if(reachable[pc])
+            {
+                h = hulp_hash_words(h, image[pc].instruction);
+            }
+        }
+        *hash = h;
+    }
+    free(reachable);
+    return err;
+}
+
+esp_err_t hulp_ulp_ensure_loaded(const ulp_insn_t *program, size_t size_of_program, uint32_t period_us, uint32_t load_addr, bool *reloaded)
+{
+    const size_t program_entries = size_of_program / sizeof(ulp_insn_t);
+    uint32_t program_hash = 2166136261UL;
+    size_t num_words = 0;
+    for(size_t i = 0; i < program_entries; ++i)
+    {
+        program_hash = hulp_hash_source_insn(program_hash, program[i]);
+        if(program[i].macro.opcode != OPCODE_MACRO)
+        {
+            ++num_words;
+        }
+    }
+
+    if(reloaded)
+    {
+        *reloaded = false;
+    }
+
+    uint32_t image_hash;
+    if(s_resident.magic == HULP_RESIDENT_MAGIC &&
+        s_resident.load_addr == load_addr &&
+        s_resident.num_words == num_words &&
+        s_resident.program_hash == program_hash &&
+        hulp_hash_resident_image(program, program_entries, load_addr, num_words, &image_hash) == ESP_OK &&
+        s_resident.image_hash == image_hash
+    )
+    {
+        ESP_LOGD(TAG, "[%s] resident program verified (%u words)", __func__, (unsigned)num_words);
+        // The period may differ from the one it was loaded with
+        ulp_set_wakeup_period(0, period_us);
+        return ESP_OK;
+    }
+
+    if(s_resident.magic == HULP_RESIDENT_MAGIC && s_resident.program_hash == program_hash)
+    {
+        ESP_LOGW(TAG, "[%s] resident program corrupted, reloading", __func__);
+    }
+
+    s_resident.magic = 0;
+    esp_err_t err = hulp_ulp_load(program, size_of_program, period_us, load_addr);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+    if(reloaded)
+    {
+        *reloaded = true;
+    }
+
+    if(hulp_hash_resident_image(program, program_entries, load_addr, num_words, &image_hash) == ESP_OK)
+    {
+        s_resident.load_addr = load_addr;
+        s_resident.num_words = num_words;
+        s_resident.program_hash = program_hash;
+        s_resident.image_hash = image_hash;
+        s_resident.magic = HULP_RESIDENT_MAGIC;
+    }
+    return ESP_OK;
+}
+
+esp_err_t hulp_ulp_load_image(const uint32_t *image, size_t num_words, const hulp_var_reloc_t *relocs, size_t num_relocs, uint32_t period_us, uint32_t load_addr)
+{
+    const size_t max_words = HULP_ULP_RESERVE_MEM / sizeof(uint32_t);
+    if(load_addr >= max_words)
+    {
+        return ESP_ERR_ULP_INVALID_LOAD_ADDR;
+    }
+    if(load_addr + num_words > max_words)
+    {
+        return ESP_ERR_ULP_SIZE_TOO_BIG;
+    }
+
+    ulp_insn_t* code = (ulp_insn_t*)(RTC_SLOW_MEM + load_addr);
+    memcpy(code, image, num_words * sizeof(uint32_t));
+
+    for(size_t i = 0; i < num_relocs; ++i)
+    {
+        const volatile uint32_t* var = (const volatile uint32_t*)relocs[i].var;
+        if(relocs[i].pc >= num_words || var < RTC_SLOW_MEM || var >= RTC_SLOW_MEM + (SOC_RTC_DATA_HIGH - SOC_RTC_DATA_LOW) / sizeof(uint32_t))
+        {
+            ESP_LOGE(TAG, "[%s] invalid reloc %u (pc %u, var %p)", __func__, (unsigned)i, relocs[i].pc, relocs[i].var);
+            return ESP_ERR_INVALID_ARG;
+        }
+        int32_t offset = (int32_t)(var - RTC_SLOW_MEM) + relocs[i].addend;
+        ulp_insn_t* insn = &code[relocs[i].pc];
+        if(insn->ld.opcode == OPCODE_LD || insn->st.opcode == OPCODE_ST)
+        {
+            insn->ld.offset = (uint32_t)offset;
+        }
+        else if(insn->alu_imm.opcode == OPCODE_ALU && insn->alu_imm.sub_opcode == SUB_OPCODE_ALU_IMM)
+        {
+            insn->alu_imm.imm = (uint32_t)offset;
+        }
+        else
+        {
+            ESP_LOGE(TAG, "[%s] reloc %u applied to incompatible instruction (pc %u)", __func__, (unsigned)i, relocs[i].pc);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    hulp_set_start_delay();
+    ulp_set_wakeup_period(0, period_us);
+    return ESP_OK;
+}
+
+esp_err_t hulp_set_wake_periods(const uint32_t *periods_us, size_t num_periods)
+{
+    if(!periods_us || num_periods == 0 || num_periods > HULP_NUM_WAKE_PERIODS)
+    {
+        ESP_LOGE(TAG, "[%s] invalid periods (%u)", __func__, (unsigned)num_periods);
+        return ESP_ERR_INVALID_ARG;
+    }
+    hulp_set_start_delay();
+    for(size_t i = 0; i < num_periods; ++i)
+    {
+        esp_err_t err = ulp_set_wakeup_period(i, periods_us[i]);
+        if(err != ESP_OK)
+        {
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
 void hulp_ulp_end(void)
 {
     CLEAR_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN);
@@ -720,6 +929,11 @@ uint32_t hulp_get_fast_clk_freq(void)
 #ifdef CONFIG_HULP_USE_APPROX_FAST_CLK
     return (uint32_t)RTC_FAST_CLK_FREQ_APPROX;
 #else
+    const uint32_t cached = s_clk_cache.fast_freq;
+    if(cached && !hulp_clk_cache_expired())
+    {
+        return cached;
+    }
     const bool clk_8m_enabled = rtc_clk_8m_enabled();
     const bool clk_8md256_enabled = rtc_clk_8md256_enabled();
     if (!clk_8m_enabled || !clk_8md256_enabled) {
@@ -729,6 +943,8 @@ uint32_t hulp_get_fast_clk_freq(void)
     if (!clk_8m_enabled || !clk_8md256_enabled) {
         rtc_clk_8m_enable(clk_8m_enabled, clk_8md256_enabled);
     }
+    s_clk_cache.fast_time_ms = hulp_clk_cache_now_ms();
+    s_clk_cache.fast_freq = ret;
     return ret;
 #endif
 }
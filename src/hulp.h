@@ -8,6 +8,7 @@
 
 #include "hulp_macros.h"
 #include "hulp_types.h"
+#include "hulp_disasm.h"
 
 #include "hulp_config.h"
 
@@ -125,9 +126,45 @@ uint8_t hulp_ms_to_ulp_tick_shift(uint32_t time_ms);
 
 /**
  * Returns the offset of a label (after processing) in an array of ULP macros.
+ * Scans the program on each call; use hulp_program_index_init for repeated lookups.
  */
 uint16_t hulp_get_label_pc(uint16_t label, const ulp_insn_t *program);
 
+/**
+ * Label table for a program, built by a single scan with hulp_program_index_init.
+ */
+typedef struct {
+    hulp_label_pc_t* by_label;  /*!< Labels sorted by label number */
+    hulp_label_pc_t* by_pc;     /*!< Labels in program order (sorted by PC) */
+    size_t num_labels;          /*!< Number of entries in each table */
+    size_t num_words;           /*!< Number of instructions in the program after macro processing */
+} hulp_program_index_t;
+
+/**
+ * Build a label table for a program, for repeated label lookups without rescanning the program.
+ * Free with hulp_program_index_deinit.
+ *
+ * num_words: number of elements in the program array (including macros), eg. sizeof(program) / sizeof(ulp_insn_t)
+ *
+ * Returns ESP_ERR_ULP_DUPLICATE_LABEL if a label is defined more than once.
+ */
+esp_err_t hulp_program_index_init(hulp_program_index_t* index, const ulp_insn_t* program, size_t num_words);
+
+/**
+ * Free a label table built by hulp_program_index_init.
+ */
+void hulp_program_index_deinit(hulp_program_index_t* index);
+
+/**
+ * Get the PC of a label. Returns ESP_ERR_NOT_FOUND if the label does not exist.
+ */
+esp_err_t hulp_program_index_find_pc(const hulp_program_index_t* index, uint16_t label, uint16_t* pc);
+
+/**
+ * Get the (first) label at a PC. Returns ESP_ERR_NOT_FOUND if there is no label at this PC.
+ */
+esp_err_t hulp_program_index_find_label(const hulp_program_index_t* index, uint16_t pc, uint16_t* label);
+
 /**
  * Start the ULP coprocessor. Upon a I_HALT() instruction, the ULP will power down for the interval period before restarting.
  */
@@ -138,13 +175,79 @@ esp_err_t hulp_ulp_run(uint32_t entry_point);
  */
 esp_err_t hulp_ulp_run_once(uint32_t entry_point);
 
+/**
+ * Process program macros (including HULP macros, eg. M_SET_ENTRY_LABEL) into dest, without loading.
+ * As with ulp_process_macros_and_load, label addresses are relative to the start of the program.
+ *
+ * max_words: capacity of dest, in instructions
+ * psize: in: number of elements in program (including macros); out: number of instructions in dest
+ */
+esp_err_t hulp_process_macros(ulp_insn_t* dest, size_t max_words, const ulp_insn_t* program, size_t* psize);
+
 /**
  * Process program macros and load it into RTC memory, and set the wakeup interval.
  * This is typically followed by hulp_ulp_run or hulp_ulp_run_once to start the ULP coprocessor.
  * For simplicity, expects program_size in bytes (not words).
+ * Resolves HULP macros (eg. M_SET_ENTRY_LABEL) in addition to those supported by ulp_process_macros_and_load.
  */
 esp_err_t hulp_ulp_load(const ulp_insn_t *program, size_t program_size, uint32_t period_us, uint32_t entry_point);
 
+/**
+ * Variant of hulp_ulp_load that only writes the words that differ from the program already in RTC memory.
+ * Useful to reconfigure a loaded program (eg. change a threshold) without rewriting it, or anything beside it.
+ * Words are written individually, so if the ULP may be running, changes must be safe to apply in any order.
+ * Note that slots which the ULP writes to within the program (eg. M_IF_TICKS_ELAPSED) are reset if they have changed.
+ *
+ * num_changed: (optional) number of words that were written
+ */
+esp_err_t hulp_ulp_load_delta(const ulp_insn_t *program, size_t program_size, uint32_t period_us, uint32_t load_addr, size_t *num_changed);
+
+/**
+ * Load the program, unless it is already resident and intact (eg. when waking from deep sleep).
+ * A small header describing the loaded program is kept in RTC slow memory. On later calls, the resident
+ * instructions are checked against it and the program is only processed and reloaded if they differ.
+ * Words which the program never executes (eg. reserved words written by the ULP) are not checked.
+ * Arguments are as per hulp_ulp_load. period_us is applied whether or not the program is reloaded.
+ *
+ * Delay lengths (I_DELAY, eg. from M_DELAY_US_* or UART baud rates) are calculated from the fast clock calibration, which
+ * differs slightly on every boot, so they are left out of the comparison and the resident delays are kept. A program
+ * that differs only in its delays is therefore not reloaded. Other constants calculated from a clock calibration are
+ * compared, so a program using them is reloaded whenever they change (eg. M_IF_MS_ELAPSED, whose tick count follows the
+ * slow clock). To avoid this, calculate such constants once and keep them through deep sleep (eg. in RTC_DATA_ATTR
+ * variables) to build the program from.
+ *
+ * reloaded: (optional) set true if the program was loaded, in which case it must be (re)started with hulp_ulp_run/hulp_ulp_run_once
+ */
+esp_err_t hulp_ulp_ensure_loaded(const ulp_insn_t *program, size_t program_size, uint32_t period_us, uint32_t load_addr, bool *reloaded);
+
+/**
+ * Reference from an instruction in a pre-assembled image to a variable in RTC slow memory (eg. ulp_var_t).
+ * The variable's word offset (plus addend) is written to the instruction's LD/ST offset or ALU immediate when loaded.
+ */
+typedef struct {
+    uint16_t pc;                /*!< Instruction (word) in the image */
+    int16_t addend;             /*!< Added to the variable's word offset */
+    const volatile void* var;   /*!< Variable in RTC slow memory */
+} hulp_var_reloc_t;
+
+/**
+ * Load a pre-assembled program image (eg. from hulp_asm.hpp) into RTC memory, and set the wakeup interval.
+ * The image is copied as-is; only variable references (relocs) are patched.
+ */
+esp_err_t hulp_ulp_load_image(const uint32_t *image, size_t num_words, const hulp_var_reloc_t *relocs, size_t num_relocs, uint32_t period_us, uint32_t load_addr);
+
+/**
+ * Number of ULP wakeup periods (SENS_ULP_CP_SLEEP_CYCn_REG), selected with I_SLEEP_CYCLE_SEL.
+ */
+#define HULP_NUM_WAKE_PERIODS 5
+
+/**
+ * Set ULP wakeup periods 0 to num_periods - 1, for the ULP to switch between with I_SLEEP_CYCLE_SEL (eg. M_WAKE_PERIOD_IDLE).
+ * Period 0 is used until another is selected, and is also set by hulp_ulp_load, so call this after loading.
+ * eg. {10000, 100000, 1000000} for 10ms when active, backing off to 100ms then 1s when idle.
+ */
+esp_err_t hulp_set_wake_periods(const uint32_t *periods_us, size_t num_periods);
+
 /**
  * Disables the timer so that the ULP will not wake up again. Equivalent to I_END()
  * If it is currently running, the ULP will continue until the next I_HALT() instruction.
@@ -163,15 +266,22 @@ bool hulp_is_deep_sleep_wakeup(void);
 bool hulp_is_ulp_wakeup(void);
 
 /**
- * Dump the provided instruction (via printf) in macro form
+ * Dump the provided instruction (to stdout) in macro form. Returns -1 if it is not a valid instruction.
+ * See hulp_disasm.h to disassemble into a buffer or other output.
  */
 int hulp_print_instruction(const ulp_insn_t *instruction);
 
 /**
- * Dump the provided program (via printf) in macro form
+ * Dump the provided program (to stdout) in macro form, one instruction per line
  */
 void hulp_print_program(const ulp_insn_t *program, size_t num_instructions);
 
+/**
+ * As hulp_print_program, with register names, variable names and labels from symbols.
+ * eg. labels from hulp_program_index_init on the unprocessed program, to read back the resident program (RTC_SLOW_MEM + load_addr).
+ */
+void hulp_print_program_symbolic(const ulp_insn_t *program, size_t num_instructions, const hulp_disasm_symbols_t* symbols);
+
 /**
  * Get the current ULP state.
  * Note: when using hulp_ulp_run_once, only IDLE or DONE may be returned
@@ -215,9 +325,21 @@ esp_err_t hulp_configure_pin_int(gpio_num_t gpio_num, gpio_int_type_t intr_type)
 
 /**
  * @brief Get the frequency of RTC Fast Clock
+ * The calibrated value is cached; see hulp_clk_cache_invalidate and CONFIG_HULP_CLK_CACHE_REFRESH_MS.
  */
 uint32_t hulp_get_fast_clk_freq(void);
 
+/**
+ * @brief Get the RTC Slow Clock calibration value (as esp_clk_slowclk_cal_get).
+ */
+uint32_t hulp_get_slow_clk_cal(void);
+
+/**
+ * @brief Discard the cached fast clock calibration, so that the next hulp_get_fast_clk_freq recalibrates.
+ * Use after changing clock sources, or if temperature drift within CONFIG_HULP_CLK_CACHE_REFRESH_MS is a concern.
+ */
+void hulp_clk_cache_invalidate(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -87,7 +87,7 @@ _Static_assert(sizeof(ulp_apa_t) == (2 * sizeof(uint32_t)), "ulp_apa_t size shou
         I_BGE(-5, 0), \
         I_ADDI(reg_scr, reg_scr, 2), \
         I_MOVR(R0, reg_scr), \
-        I_BL(-18, NUM_LEDS * 2), \
+        I_BL(-18, (num_apas) * 2), \
         I_GPIO_SET(data_gpio, 1), \
         I_GPIO_SET(clk_gpio, 1), \
         I_STAGE_INC(1), \
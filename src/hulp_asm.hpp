@@ -0,0 +1,395 @@
+#ifndef HULP_ASM_HPP
+#define HULP_ASM_HPP
+
+/**
+ * Compile-time ULP program assembler (C++17).
+ *
+ * Programs are written with the usual I_ and M_ macros, and are resolved (labels, branch offsets, entry points)
+ * by the compiler into a flat array of instruction words in flash. Loading is then a single memcpy:
+ *
+ *      RTC_DATA_ATTR ulp_var_t ulp_count;
+ *
+ *      HULP_ASM_PROGRAM(program,
+ *          I_MOVI(R2, 0),
+ *          M_LABEL(1),
+ *              hulp_asm::get(R0, R2, ulp_count),
+ *              I_ADDI(R0, R0, 1),
+ *              hulp_asm::put(R0, R2, ulp_count),
+ *              I_HALT(),
+ *      );
+ *
+ *      hulp_asm::load(program, 1000000);
+ *
+ * Limitations:
+ *  - Addresses of RTC variables are only known after linking, so I_GET, I_PUT, I_MOVO etc. are replaced with their
+ *    hulp_asm:: equivalents here. These are recorded as relocations and patched after the copy.
+ *  - Macros that depend on runtime values (eg. calibrated clocks in M_DELAY_*, M_IF_MS_ELAPSED) cannot be used.
+ *  - GPIO macros require CONFIG_HULP_MACRO_OPTIMISATIONS.
+ */
+
+#if __cplusplus < 201703L
+    #error "hulp_asm.hpp requires C++17"
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "hulp.h"
+
+namespace hulp_asm {
+
+constexpr uint32_t unset = 0xFFFFFFFF;
+
+/**
+ * An instruction or macro in a program source.
+ * This has the same members and fields as ulp_insn_t so that I_ and M_ macros can initialise it in a constant expression.
+ */
+struct insn {
+    struct { uint32_t cycles; uint32_t unused; uint32_t opcode = unset; } delay;
+    struct { uint32_t dreg; uint32_t wait_delay; uint32_t reserved; uint32_t opcode = unset; } tsens;
+    struct { uint32_t dreg; uint32_t mux; uint32_t sar_sel; uint32_t unused1; uint32_t cycles; uint32_t unused2; uint32_t opcode = unset; } adc;
+    struct { uint32_t dreg; uint32_t sreg; uint32_t unused1; uint32_t offset; uint32_t unused2; uint32_t sub_opcode; uint32_t opcode = unset; } st;
+    struct { uint32_t dreg; uint32_t sreg; uint32_t unused1; uint32_t offset; uint32_t unused2; uint32_t opcode = unset; } ld;
+    struct { uint32_t unused; uint32_t opcode = unset; } halt;
+    struct { uint32_t dreg; uint32_t addr; uint32_t unused; uint32_t reg; uint32_t type; uint32_t sub_opcode; uint32_t opcode = unset; } bx;
+    struct { uint32_t imm; uint32_t cmp; uint32_t offset; uint32_t sign; uint32_t sub_opcode; uint32_t opcode = unset; } b;
+    struct { uint32_t imm; uint32_t unused; uint32_t cmp; uint32_t offset; uint32_t sign; uint32_t sub_opcode; uint32_t opcode = unset; } bs;
+    struct { uint32_t dreg; uint32_t sreg; uint32_t treg; uint32_t unused; uint32_t sel; uint32_t sub_opcode; uint32_t opcode = unset; } alu_reg;
+    struct { uint32_t unused1; uint32_t imm; uint32_t unused2; uint32_t sel; uint32_t sub_opcode; uint32_t opcode = unset; } alu_reg_s;
+    struct { uint32_t dreg; uint32_t sreg; uint32_t imm; uint32_t unused; uint32_t sel; uint32_t sub_opcode; uint32_t opcode = unset; } alu_imm;
+    struct { uint32_t addr; uint32_t periph_sel; uint32_t data; uint32_t low; uint32_t high; uint32_t opcode = unset; } wr_reg;
+    struct { uint32_t addr; uint32_t periph_sel; uint32_t unused; uint32_t low; uint32_t high; uint32_t opcode = unset; } rd_reg;
+    struct { uint32_t i2c_addr; uint32_t data; uint32_t low_bits; uint32_t high_bits; uint32_t i2c_sel; uint32_t unused; uint32_t rw; uint32_t opcode = unset; } i2c;
+    struct { uint32_t wakeup; uint32_t unused; uint32_t sub_opcode; uint32_t opcode = unset; } end;
+    struct { uint32_t cycle_sel; uint32_t unused; uint32_t sub_opcode; uint32_t opcode = unset; } sleep;
+    struct { uint32_t label; uint32_t unused; uint32_t sub_opcode; uint32_t opcode = unset; } macro;
+    // Variable reference (see get, put, etc.)
+    const volatile void* var = nullptr;
+    int32_t var_addend = 0;
+};
+
+/**
+ * Assembled program: instruction words, and variable references to be patched when loaded.
+ */
+template<size_t N, size_t R>
+struct image {
+    std::array<uint32_t, N> words;
+    std::array<hulp_var_reloc_t, R> relocs;
+};
+
+// Compile errors. These are deliberately not constexpr; reaching one in a constant expression fails compilation with its name.
+inline void error_undefined_label() {}
+inline void error_duplicate_label() {}
+inline void error_branch_out_of_range() {}
+inline void error_macro_without_instruction() {}
+inline void error_macro_incompatible_instruction() {}
+inline void error_invalid_instruction() {}
+
+namespace detail {
+
+constexpr uint32_t field(uint32_t val, unsigned shift, unsigned width)
+{
+    return (val & ((width >= 32) ? 0xFFFFFFFFu : ((1u << width) - 1))) << shift;
+}
+
+constexpr bool is_macro(const insn& i)
+{
+    return i.macro.opcode != unset;
+}
+
+/**
+ * Encode the member of insn that was initialised.
+ */
+constexpr uint32_t encode(const insn& i)
+{
+    if(i.delay.opcode != unset)
+        return field(i.delay.cycles, 0, 16) | field(i.delay.opcode, 28, 4);
+    if(i.tsens.opcode != unset)
+        return field(i.tsens.dreg, 0, 2) | field(i.tsens.wait_delay, 2, 14) | field(i.tsens.opcode, 28, 4);
+    if(i.adc.opcode != unset)
+        return field(i.adc.dreg, 0, 2) | field(i.adc.mux, 2, 4) | field(i.adc.sar_sel, 6, 1) | field(i.adc.cycles, 8, 16) | field(i.adc.opcode, 28, 4);
+    if(i.st.opcode != unset)
+        return field(i.st.dreg, 0, 2) | field(i.st.sreg, 2, 2) | field(i.st.offset, 10, 11) | field(i.st.sub_opcode, 25, 3) | field(i.st.opcode, 28, 4);
+    if(i.ld.opcode != unset)
+        return field(i.ld.dreg, 0, 2) | field(i.ld.sreg, 2, 2) | field(i.ld.offset, 10, 11) | field(i.ld.opcode, 28, 4);
+    if(i.halt.opcode != unset)
+        return field(i.halt.opcode, 28, 4);
+    if(i.bx.opcode != unset)
+        return field(i.bx.dreg, 0, 2) | field(i.bx.addr, 2, 11) | field(i.bx.reg, 21, 1) | field(i.bx.type, 22, 3) | field(i.bx.sub_opcode, 25, 3) | field(i.bx.opcode, 28, 4);
+    if(i.b.opcode != unset)
+        return field(i.b.imm, 0, 16) | field(i.b.cmp, 16, 1) | field(i.b.offset, 17, 7) | field(i.b.sign, 24, 1) | field(i.b.sub_opcode, 25, 3) | field(i.b.opcode, 28, 4);
+    if(i.bs.opcode != unset)
+        return field(i.bs.imm, 0, 8) | field(i.bs.cmp, 15, 2) | field(i.bs.offset, 17, 7) | field(i.bs.sign, 24, 1) | field(i.bs.sub_opcode, 25, 3) | field(i.bs.opcode, 28, 4);
+    if(i.alu_reg.opcode != unset)
+        return field(i.alu_reg.dreg, 0, 2) | field(i.alu_reg.sreg, 2, 2) | field(i.alu_reg.treg, 4, 2) | field(i.alu_reg.sel, 21, 4) | field(i.alu_reg.sub_opcode, 25, 3) | field(i.alu_reg.opcode, 28, 4);
+    if(i.alu_reg_s.opcode != unset)
+        return field(i.alu_reg_s.imm, 4, 8) | field(i.alu_reg_s.sel, 21, 4) | field(i.alu_reg_s.sub_opcode, 25, 3) | field(i.alu_reg_s.opcode, 28, 4);
+    if(i.alu_imm.opcode != unset)
+        return field(i.alu_imm.dreg, 0, 2) | field(i.alu_imm.sreg, 2, 2) | field(i.alu_imm.imm, 4, 16) | field(i.alu_imm.sel, 21, 4) | field(i.alu_imm.sub_opcode, 25, 3) | field(i.alu_imm.opcode, 28, 4);
+    if(i.wr_reg.opcode != unset)
+        return field(i.wr_reg.addr, 0, 8) | field(i.wr_reg.periph_sel, 8, 2) | field(i.wr_reg.data, 10, 8) | field(i.wr_reg.low, 18, 5) | field(i.wr_reg.high, 23, 5) | field(i.wr_reg.opcode, 28, 4);
+    if(i.rd_reg.opcode != unset)
+        return field(i.rd_reg.addr, 0, 8) | field(i.rd_reg.periph_sel, 8, 2) | field(i.rd_reg.low, 18, 5) | field(i.rd_reg.high, 23, 5) | field(i.rd_reg.opcode, 28, 4);
+    if(i.i2c.opcode != unset)
+        return field(i.i2c.i2c_addr, 0, 8) | field(i.i2c.data, 8, 8) | field(i.i2c.low_bits, 16, 3) | field(i.i2c.high_bits, 19, 3) | field(i.i2c.i2c_sel, 22, 4) | field(i.i2c.rw, 27, 1) | field(i.i2c.opcode, 28, 4);
+    if(i.end.opcode != unset)
+        return field(i.end.wakeup, 0, 1) | field(i.end.sub_opcode, 25, 3) | field(i.end.opcode, 28, 4);
+    if(i.sleep.opcode != unset)
+        return field(i.sleep.cycle_sel, 0, 4) | field(i.sleep.sub_opcode, 25, 3) | field(i.sleep.opcode, 28, 4);
+    error_invalid_instruction();
+    return 0;
+}
+
+constexpr uint32_t opcode_of(uint32_t word) { return word >> 28; }
+constexpr uint32_t sub_opcode_of(uint32_t word) { return (word >> 25) & 0x7; }
+
+constexpr uint32_t set_field(uint32_t word, uint32_t val, unsigned shift, unsigned width)
+{
+    return (word & ~field(0xFFFFFFFFu, shift, width)) | field(val, shift, width);
+}
+
+/**
+ * Apply a relocation macro to words[pc] (as hulp_ulp_load / ulp_process_macros_and_load would).
+ */
+template<size_t N>
+constexpr void apply_macro(std::array<uint32_t, N>& words, size_t pc, const insn& macro, uint32_t label_pc)
+{
+    uint32_t word = words[pc];
+    switch(macro.macro.sub_opcode)
+    {
+        case SUB_OPCODE_MACRO_BRANCH:
+        {
+            if(opcode_of(word) != OPCODE_BRANCH)
+            {
+                error_macro_incompatible_instruction();
+            }
+            if(sub_opcode_of(word) == SUB_OPCODE_BX)
+            {
+                words[pc] = set_field(word, label_pc, 2, 11);
+                return;
+            }
+            int32_t offset = (int32_t)label_pc - (int32_t)pc;
+            uint32_t abs_offset = (uint32_t)(offset < 0 ? -offset : offset);
+            if(abs_offset > 127)
+            {
+                error_branch_out_of_range();
+            }
+            word = set_field(word, abs_offset, 17, 7);
+            words[pc] = set_field(word, offset < 0 ? 1 : 0, 24, 1);
+            return;
+        }
+        case SUB_OPCODE_MACRO_LABELPC:
+        {
+            if(opcode_of(word) != OPCODE_ALU || sub_opcode_of(word) != SUB_OPCODE_ALU_IMM || ((word >> 21) & 0xF) != ALU_SEL_MOV)
+            {
+                error_macro_incompatible_instruction();
+            }
+            words[pc] = set_field(word, label_pc, 4, 16);
+            return;
+        }
+        case HULP_SUB_OPCODE_MACRO_ENTRYPC:
+        {
+            if(pc + 1 >= N || opcode_of(word) != OPCODE_WR_REG || opcode_of(words[pc + 1]) != OPCODE_WR_REG)
+            {
+                error_macro_incompatible_instruction();
+            }
+            uint32_t entry = label_pc + macro.macro.unused;
+            words[pc] = set_field(word, (entry >> 8) & 0x7, 10, 8);
+            words[pc + 1] = set_field(words[pc + 1], entry & 0xFF, 10, 8);
+            return;
+        }
+        default:
+            error_macro_incompatible_instruction();
+    }
+}
+
+} // namespace detail
+
+/**
+ * Number of instructions in a program source (excluding macros).
+ */
+template<size_t M>
+constexpr size_t num_words(const insn (&src)[M])
+{
+    size_t n = 0;
+    for(size_t i = 0; i < M; ++i)
+    {
+        if(!detail::is_macro(src[i]))
+        {
+            ++n;
+        }
+    }
+    return n;
+}
+
+/**
+ * Number of variable references in a program source.
+ */
+template<size_t M>
+constexpr size_t num_relocs(const insn (&src)[M])
+{
+    size_t n = 0;
+    for(size_t i = 0; i < M; ++i)
+    {
+        if(src[i].var != nullptr)
+        {
+            ++n;
+        }
+    }
+    return n;
+}
+
+/**
+ * Assemble a program source. Use in a constant expression (see HULP_ASM_PROGRAM) so that errors are reported at compile time.
+ * As with hulp_ulp_load, label addresses are relative to the start of the program.
+ */
+template<size_t N, size_t R, size_t M>
+constexpr image<N, R> assemble(const insn (&src)[M])
+{
+    static_assert(N <= HULP_ULP_RESERVE_MEM / sizeof(uint32_t), "ULP program does not fit in HULP_ULP_RESERVE_MEM");
+
+    image<N, R> out{};
+    std::array<hulp_label_pc_t, M> labels{};
+    size_t num_labels = 0;
+
+    size_t pc = 0;
+    size_t reloc = 0;
+    for(size_t i = 0; i < M; ++i)
+    {
+        if(detail::is_macro(src[i]))
+        {
+            if(src[i].macro.sub_opcode == SUB_OPCODE_MACRO_LABEL)
+            {
+                for(size_t l = 0; l < num_labels; ++l)
+                {
+                    if(labels[l].label == src[i].macro.label)
+                    {
+                        error_duplicate_label();
+                    }
+                }
+                labels[num_labels].label = (uint16_t)src[i].macro.label;
+                labels[num_labels].pc = (uint16_t)pc;
+                ++num_labels;
+            }
+            continue;
+        }
+        out.words[pc] = detail::encode(src[i]);
+        if(src[i].var != nullptr)
+        {
+            out.relocs[reloc].pc = (uint16_t)pc;
+            out.relocs[reloc].addend = (int16_t)src[i].var_addend;
+            out.relocs[reloc].var = src[i].var;
+            ++reloc;
+        }
+        ++pc;
+    }
+
+    pc = 0;
+    for(size_t i = 0; i < M; ++i)
+    {
+        if(!detail::is_macro(src[i]))
+        {
+            ++pc;
+            continue;
+        }
+        if(src[i].macro.sub_opcode == SUB_OPCODE_MACRO_LABEL)
+        {
+            continue;
+        }
+        if(pc >= N)
+        {
+            error_macro_without_instruction();
+        }
+        size_t l = 0;
+        while(l < num_labels && labels[l].label != src[i].macro.label)
+        {
+            ++l;
+        }
+        if(l == num_labels)
+        {
+            error_undefined_label();
+        }
+        detail::apply_macro(out.words, pc, src[i], labels[l].pc);
+    }
+
+    return out;
+}
+
+/**
+ * Load an assembled program into RTC memory and set the wakeup interval (as hulp_ulp_load).
+ */
+template<size_t N, size_t R>
+inline esp_err_t load(const image<N, R>& img, uint32_t period_us, uint32_t load_addr = 0)
+{
+    return hulp_ulp_load_image(img.words.data(), N, R > 0 ? img.relocs.data() : nullptr, R, period_us, load_addr);
+}
+
+namespace detail {
+
+template<typename T>
+constexpr insn with_var(insn i, const T& var, int32_t addend)
+{
+    static_assert(sizeof(T) % sizeof(uint32_t) == 0, "ULP variables must be word-sized (eg. ulp_var_t)");
+    i.var = &var;
+    i.var_addend = addend;
+    return i;
+}
+
+} // namespace detail
+
+/**
+ * Equivalent of I_MOVO: move the word offset of var into reg_dest.
+ */
+template<typename T>
+constexpr insn movo(uint32_t reg_dest, const T& var)
+{
+    return detail::with_var<T>(insn I_MOVI(reg_dest, 0), var, 0);
+}
+
+/**
+ * Equivalent of I_GET: load var into reg_dest. reg_zero must be 0.
+ */
+template<typename T>
+constexpr insn get(uint32_t reg_dest, uint32_t reg_zero, const T& var)
+{
+    return detail::with_var<T>(insn I_LD(reg_dest, reg_zero, 0), var, 0);
+}
+
+/**
+ * Equivalent of I_PUT: store reg_src into var. reg_zero must be 0.
+ */
+template<typename T>
+constexpr insn put(uint32_t reg_src, uint32_t reg_zero, const T& var)
+{
+    return detail::with_var<T>(insn I_ST(reg_src, reg_zero, 0), var, 0);
+}
+
+/**
+ * Equivalent of I_GETO: load var into reg_dest, where reg_offset holds val_offset.
+ */
+template<typename T>
+constexpr insn geto(uint32_t reg_dest, uint32_t reg_offset, int32_t val_offset, const T& var)
+{
+    return detail::with_var<T>(insn I_LD(reg_dest, reg_offset, 0), var, -val_offset);
+}
+
+/**
+ * Equivalent of I_PUTO: store reg_src into var, where reg_offset holds val_offset.
+ */
+template<typename T>
+constexpr insn puto(uint32_t reg_src, uint32_t reg_offset, int32_t val_offset, const T& var)
+{
+    return detail::with_var<T>(insn I_ST(reg_src, reg_offset, 0), var, -val_offset);
+}
+
+} // namespace hulp_asm
+
+/**
+ * Define a compile-time assembled program (hulp_asm::image) named name.
+ */
+#define HULP_ASM_PROGRAM(name, ...) \
+    static constexpr ::hulp_asm::insn name##_src[] = { __VA_ARGS__ }; \
+    static constexpr auto name = ::hulp_asm::assemble<::hulp_asm::num_words(name##_src), ::hulp_asm::num_relocs(name##_src)>(name##_src)
+
+#endif /* HULP_ASM_HPP */
@@ -0,0 +1,145 @@
+#include "hulp_cfg.h"
+
+#include <stdlib.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "HULP-CFG";
+
+static void hulp_cfg_add(hulp_cfg_successors_t* successors, size_t num_words, int32_t pc)
+{
+    if(pc < 0 || pc >= (int32_t)num_words)
+    {
+        successors->indirect = true;
+        return;
+    }
+    for(uint8_t i = 0; i < successors->count; ++i)
+    {
+        if(successors->pc[i] == pc)
+        {
+            return;
+        }
+    }
+    successors->pc[successors->count++] = (uint16_t)pc;
+}
+
+void hulp_cfg_get_successors(const ulp_insn_t* program, size_t num_words, uint16_t pc, hulp_cfg_successors_t* successors)
+{
+    const ulp_insn_t* insn = &program[pc];
+    bool taken = false;
+    bool not_taken = true;
+    int32_t target = 0;
+
+    successors->count = 0;
+    successors->indirect = false;
+
+    switch(insn->b.opcode)
+    {
+        case OPCODE_HALT:
+            return;
+        case OPCODE_BRANCH:
+            if(insn->bx.sub_opcode == SUB_OPCODE_BX)
+            {
+                if(insn->bx.reg)
+                {
+                    successors->indirect = true;
+                }
+                else
+                {
+                    taken = true;
+                    target = insn->bx.addr;
+                }
+                not_taken = (insn->bx.type != BX_JUMP_TYPE_DIRECT);
+            }
+            else if(insn->b.sub_opcode == SUB_OPCODE_BR)
+            {
+                target = (int32_t)pc + (insn->b.sign ? -(int32_t)insn->b.offset : (int32_t)insn->b.offset);
+                // R0 is unsigned, so R0 >= 0 is always true and R0 < 0 never is
+                taken = !(insn->b.cmp == B_CMP_L && insn->b.imm == 0);
+                not_taken = !(insn->b.cmp == B_CMP_GE && insn->b.imm == 0);
+            }
+            else if(insn->bs.sub_opcode == SUB_OPCODE_BS)
+            {
+                target = (int32_t)pc + (insn->bs.sign ? -(int32_t)insn->bs.offset : (int32_t)insn->bs.offset);
+                // Likewise for the 8-bit stage counter
+                taken = !(insn->bs.cmp == JUMPS_LT && insn->bs.imm == 0);
+                not_taken = !((insn->bs.cmp == JUMPS_GE && insn->bs.imm == 0) || (insn->bs.cmp == JUMPS_LE && insn->bs.imm == 0xFF));
+            }
+            break;
+        default:
+            break;
+    }
+
+    if(taken)
+    {
+        hulp_cfg_add(successors, num_words, target);
+    }
+    if(not_taken)
+    {
+        hulp_cfg_add(successors, num_words, (int32_t)pc + 1);
+    }
+}
+
+uint32_t hulp_cfg_get_cycles(const ulp_insn_t* insn)
+{
+    // Execution cycles plus fetch, per the ESP32 ULP instruction set reference
+    switch(insn->b.opcode)
+    {
+        case OPCODE_WR_REG:
+            return 12;
+        case OPCODE_RD_REG:
+        case OPCODE_ST:
+        case OPCODE_LD:
+            return 8;
+        case OPCODE_BRANCH:
+            return 4;
+        case OPCODE_HALT:
+            return 2;
+        case OPCODE_DELAY:
+            return 6 + insn->delay.cycles;
+        case OPCODE_TSENS:
+            return 2 + 4 + insn->tsens.wait_delay;
+        case OPCODE_ADC:
+            return 23 + 4;
+        default:
+            // ALU, stage counter, I_WAKE, I_SLEEP_CYCLE_SEL, I_I2C_RW (minimum)
+            return 6;
+    }
+}
+
+esp_err_t hulp_cfg_mark_reachable(const ulp_insn_t* program, size_t num_words, bool* reachable)
+{
+    uint16_t* stack = (uint16_t*)malloc(num_words * sizeof(uint16_t));
+    if(!stack)
+    {
+        ESP_LOGE(TAG, "[%s] no memory for %u words", __func__, (unsigned)num_words);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Each instruction is pushed at most once: when it is first marked.
+    size_t depth = 0;
+    for(size_t pc = 0; pc < num_words; ++pc)
+    {
+        if(reachable[pc])
+        {
+            stack[depth++] = (uint16_t)pc;
+        }
+    }
+
+    while(depth > 0)
+    {
+        hulp_cfg_successors_t successors;
+        hulp_cfg_get_successors(program, num_words, stack[--depth], &successors);
+        for(uint8_t i = 0; i < successors.count; ++i)
+        {
+            if(!reachable[successors.pc[i]])
+            {
+                reachable[successors.pc[i]] = true;
+                stack[depth++] = successors.pc[i];
+            }
+        }
+    }
+
+    free(stack);
+    return ESP_OK;
+}
@@ -0,0 +1,53 @@
+#ifndef HULP_CFG_H
+#define HULP_CFG_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "hulp_compat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Control flow of processed ULP programs (ie. after macros have been resolved).
+ *
+ * As with ulp_process_macros_and_load, PCs are relative to the start of the program, and I_BX/M_BX
+ * targets are assumed to be too.
+ */
+
+/**
+ * Successors of a single instruction.
+ */
+typedef struct {
+    uint16_t pc[2];     /*!< Possible next PCs (within the program) */
+    uint8_t count;      /*!< Number of entries in pc (0-2) */
+    bool indirect;      /*!< Execution may also continue at an address held in a register (eg. I_BXR), or beyond the program */
+} hulp_cfg_successors_t;
+
+/**
+ * Get the instructions that may execute after the instruction at pc.
+ * Branches that are always or never taken (eg. I_BGE(n, 0), I_BL(n, 0)) have only one successor.
+ * I_HALT has none.
+ */
+void hulp_cfg_get_successors(const ulp_insn_t* program, size_t num_words, uint16_t pc, hulp_cfg_successors_t* successors);
+
+/**
+ * Get the number of RTC_FAST_CLK cycles an instruction takes, including its fetch.
+ * For instructions with a variable duration (I_TSENS, I_ADC, I_I2C_RW), this is the minimum.
+ */
+uint32_t hulp_cfg_get_cycles(const ulp_insn_t* insn);
+
+/**
+ * Mark every instruction reachable from a set of roots.
+ * On entry, reachable[] (num_words elements) must be true for the roots (eg. entry points, labels) and false otherwise.
+ * Targets of indirect branches are not followed, so any possible targets (eg. return labels) should be included as roots.
+ */
+esp_err_t hulp_cfg_mark_reachable(const ulp_insn_t* program, size_t num_words, bool* reachable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_CFG_H */
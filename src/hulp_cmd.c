@@ -0,0 +1,87 @@
+#include "hulp_cmd.h"
+
+#include "esp_log.h"
+
+static const char* TAG = "HULP-CMD";
+
+esp_err_t hulp_cmd_init(ulp_var_t* queue, ulp_var_t* handlers, const uint16_t* handler_labels, size_t num_opcodes, const ulp_insn_t* program, size_t program_entries)
+{
+    if(!queue || !handlers || !handler_labels || !num_opcodes || !program)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    hulp_program_index_t index;
+    esp_err_t err = hulp_program_index_init(&index, program, program_entries);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+
+    for(size_t i = 0; i < num_opcodes && err == ESP_OK; ++i)
+    {
+        uint16_t entry;
+        if(hulp_program_index_find_pc(&index, handler_labels[i], &entry) != ESP_OK)
+        {
+            ESP_LOGE(TAG, "[%s] opcode %u: label %u not found", __func__, (unsigned)i, handler_labels[i]);
+            err = ESP_ERR_NOT_FOUND;
+        }
+        else
+        {
+            handlers[i].val = entry;
+        }
+    }
+    hulp_program_index_deinit(&index);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+
+    queue[HULP_CMD_HEAD].val = 0;
+    queue[HULP_CMD_TAIL].val = 0;
+    queue[HULP_CMD_ACK].val = 0;
+    queue[HULP_CMD_SENT].val = 0;
+    queue[HULP_CMD_NUM_OPCODES].val = (uint16_t)num_opcodes;
+    return ESP_OK;
+}
+
+esp_err_t hulp_cmd_send(ulp_var_t* queue, size_t capacity, uint16_t opcode, uint16_t arg0, uint16_t arg1, uint16_t* seq)
+{
+    volatile ulp_var_t* q = (volatile ulp_var_t*)queue;
+    if(opcode >= q[HULP_CMD_NUM_OPCODES].val)
+    {
+        ESP_LOGE(TAG, "[%s] invalid opcode %u", __func__, opcode);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint16_t head = q[HULP_CMD_HEAD].val;
+    uint16_t next = head + HULP_CMD_WORDS;
+    if(next >= HULP_CMD_DATA_WORDS(capacity))
+    {
+        next = 0;
+    }
+    if(next == q[HULP_CMD_TAIL].val)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Write the command before publishing it with the head
+    volatile ulp_var_t* cmd = &q[HULP_CMD_HDR_WORDS + head];
+    cmd[HULP_CMD_OPCODE].val = opcode;
+    cmd[HULP_CMD_ARG0].val = arg0;
+    cmd[HULP_CMD_ARG1].val = arg1;
+    uint16_t sent = q[HULP_CMD_SENT].val + 1;
+    q[HULP_CMD_SENT].val = sent;
+    q[HULP_CMD_HEAD].val = next;
+    if(seq)
+    {
+        *seq = sent;
+    }
+    return ESP_OK;
+}
+
+bool hulp_cmd_is_done(const ulp_var_t* queue, uint16_t seq)
+{
+    uint16_t ack = ((const volatile ulp_var_t*)queue)[HULP_CMD_ACK].val;
+    return (int16_t)(ack - seq) >= 0;
+}
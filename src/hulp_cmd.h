@@ -0,0 +1,134 @@
+#ifndef HULP_CMD_H
+#define HULP_CMD_H
+
+#include "hulp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * SoC to ULP command queue, for changing the ULP's behaviour (thresholds, intervals, pin states etc.) while it runs.
+ *
+ * The SoC sends commands (an opcode with two arguments) with hulp_cmd_send, and M_CMD_DISPATCH runs each waiting
+ * command's handler through a jump table of handler entry points in RTC memory. Every command run is acknowledged, so
+ * the SoC can tell when its command has taken effect with hulp_cmd_is_done. With no commands waiting, M_CMD_DISPATCH
+ * is 5 instructions.
+ *
+ * Example:
+ *      enum { CMD_SET_THRESHOLD, CMD_SET_LED, CMD_MAX };
+ *      RTC_DATA_ATTR ulp_var_t ulp_cmd_queue[HULP_CMD_QUEUE_WORDS(4)];
+ *      RTC_DATA_ATTR ulp_var_t ulp_cmd_handlers[CMD_MAX];
+ *
+ *      const ulp_insn_t program[] = {
+ *          M_CMD_DISPATCH(LBL_CMD_RESUME, ulp_cmd_queue, 4, ulp_cmd_handlers),
+ *          //...
+ *          I_HALT(),
+ *
+ *          M_LABEL(LBL_CMD_SET_THRESHOLD),
+ *              I_LD(R0, R1, HULP_CMD_ARG0),
+ *              I_MOVI(R2, 0),
+ *              I_PUT(R0, R2, ulp_threshold),
+ *              M_CMD_END(LBL_CMD_RESUME),
+ *          //...
+ *      };
+ *
+ *      const uint16_t handler_labels[CMD_MAX] = {LBL_CMD_SET_THRESHOLD, LBL_CMD_SET_LED};
+ *      hulp_cmd_init(ulp_cmd_queue, ulp_cmd_handlers, handler_labels, CMD_MAX, program, sizeof(program) / sizeof(ulp_insn_t));
+ *
+ *      uint16_t seq;
+ *      hulp_cmd_send(ulp_cmd_queue, 4, CMD_SET_THRESHOLD, 1200, 0, &seq);
+ *
+ * As with M_BX, handler entries are relative to the start of the program, so it should be loaded at 0.
+ */
+
+// Queue header
+#define HULP_CMD_HEAD 0         /*!< Word offset of the next command to send (SoC) */
+#define HULP_CMD_TAIL 1         /*!< Word offset of the next command to run (ULP) */
+#define HULP_CMD_ACK 2          /*!< Number of commands run (ULP) */
+#define HULP_CMD_SENT 3         /*!< Number of commands sent (SoC) */
+#define HULP_CMD_NUM_OPCODES 4  /*!< Number of handlers */
+#define HULP_CMD_HDR_WORDS 5
+
+// Each command, following the header
+#define HULP_CMD_OPCODE 0
+#define HULP_CMD_ARG0 1
+#define HULP_CMD_ARG1 2
+#define HULP_CMD_WORDS 3
+
+/**
+ * Number of words of commands. One slot is always free, to tell a full queue from an empty one.
+ */
+#define HULP_CMD_DATA_WORDS(capacity) (((capacity) + 1) * HULP_CMD_WORDS)
+
+/**
+ * Size of the queue (ulp_var_t array) for up to capacity commands waiting.
+ */
+#define HULP_CMD_QUEUE_WORDS(capacity) (HULP_CMD_HDR_WORDS + HULP_CMD_DATA_WORDS(capacity))
+
+/**
+ * Initialise the queue (empty) and the handler table in RTC memory. Only while the ULP is not running.
+ *
+ * handlers: ulp_var_t array of num_opcodes, given to M_CMD_DISPATCH
+ * handler_labels: label at the start of the handler for each opcode
+ * program, program_entries: the program (including macros) that contains the handlers' labels
+ */
+esp_err_t hulp_cmd_init(ulp_var_t* queue, ulp_var_t* handlers, const uint16_t* handler_labels, size_t num_opcodes, const ulp_insn_t* program, size_t program_entries);
+
+/**
+ * Send a command to the ULP, to be run on its next M_CMD_DISPATCH.
+ *
+ * seq: optional, set to the sequence number of the command, for hulp_cmd_is_done
+ *
+ * Returns ESP_ERR_NO_MEM if capacity commands are already waiting.
+ */
+esp_err_t hulp_cmd_send(ulp_var_t* queue, size_t capacity, uint16_t opcode, uint16_t arg0, uint16_t arg1, uint16_t* seq);
+
+/**
+ * Check if the ULP has run the command with this sequence number (and all before it).
+ */
+bool hulp_cmd_is_done(const ulp_var_t* queue, uint16_t seq);
+
+/**
+ * Run all waiting commands, then continue. R0-R3 are clobbered.
+ * Each handler starts with R1 pointing at its command, so its arguments are I_LD(reg, R1, HULP_CMD_ARG0/1).
+ *
+ * label_resume: Label for handlers to return to (M_CMD_END)
+ * queue: The ulp_var_t array given to hulp_cmd_init
+ * capacity: As given to HULP_CMD_QUEUE_WORDS
+ * handlers: The handler table given to hulp_cmd_init
+ */
+#define M_CMD_DISPATCH(label_resume, queue, capacity, handlers) \
+    I_MOVI(R3, 0), \
+    I_LD(R1, R3, RTC_WORD_OFFSET((queue)[HULP_CMD_TAIL])), \
+    I_LD(R0, R3, RTC_WORD_OFFSET((queue)[HULP_CMD_HEAD])), \
+    I_SUBR(R0, R0, R1),                                 /*None waiting if the tail is the head*/ \
+    I_BL(16, 1), \
+    I_ADDI(R1, R1, RTC_WORD_OFFSET((queue)[HULP_CMD_HDR_WORDS])), \
+    I_LD(R0, R1, HULP_CMD_OPCODE),                      /*Run the handler for the opcode*/ \
+    I_LD(R0, R0, RTC_WORD_OFFSET((handlers)[0])), \
+    I_BXR(R0), \
+    M_LABEL(label_resume), \
+    I_MOVI(R3, 0), \
+    I_LD(R1, R3, RTC_WORD_OFFSET((queue)[HULP_CMD_TAIL])), \
+    I_ADDI(R1, R1, HULP_CMD_WORDS), \
+    I_MOVR(R0, R1), \
+    I_BL(2, HULP_CMD_DATA_WORDS(capacity)), \
+    I_MOVI(R1, 0),                                      /*Wrap*/ \
+    I_ST(R1, R3, RTC_WORD_OFFSET((queue)[HULP_CMD_TAIL])), \
+    I_LD(R0, R3, RTC_WORD_OFFSET((queue)[HULP_CMD_ACK])), \
+    I_ADDI(R0, R0, 1), \
+    I_ST(R0, R3, RTC_WORD_OFFSET((queue)[HULP_CMD_ACK])), \
+    I_BGE(-18, 0)
+
+/**
+ * End a command handler, returning to M_CMD_DISPATCH. Registers need not be preserved.
+ */
+#define M_CMD_END(label_resume) \
+    M_BX(label_resume)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_CMD_H */
@@ -10,5 +10,8 @@
 #ifndef CONFIG_HULP_FAST_CLK_CAL_CYCLES
     #define CONFIG_HULP_FAST_CLK_CAL_CYCLES 100
 #endif
+#ifndef CONFIG_HULP_CLK_CACHE_REFRESH_MS
+    #define CONFIG_HULP_CLK_CACHE_REFRESH_MS 1000
+#endif
 
 #endif /* HULP_CONFIG_H */
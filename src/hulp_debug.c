@@ -10,17 +10,9 @@
 
 static const char* TAG = "HULP-DBG";
 
-typedef struct {
-    uint16_t label_num;
-    uint16_t pc;
-} hulp_debug_label_pc_pair_t;
-
 struct hulp_debug_bp_state_t {
     ulp_debug_bp_data_t* data;
-    struct {
-        hulp_debug_label_pc_pair_t* pc_pairs;
-        size_t num;
-    } labels;
+    hulp_program_index_t labels;
     struct {
         hulp_debug_bp_cb_t fn;
         void* ctx;
@@ -192,17 +184,9 @@ static void hulp_debug_isr_handler(void* ctx)
     bp_data.meta.return_addr = bp_data.bp.pc + HULP_DEBUG_SET_BP_INSN_NUM;
 
     // Get the label number for this pc, if available
-    if(handle->labels.pc_pairs != NULL)
+    if(hulp_program_index_find_label(&handle->labels, bp_data.bp.pc, &bp_data.bp.label.num) == ESP_OK)
     {
-        for(size_t i = 0; i < handle->labels.num; ++i)
-        {
-            if(handle->labels.pc_pairs[i].pc == bp_data.bp.pc)
-            {
-                bp_data.bp.label.num = handle->labels.pc_pairs[i].label_num;
-                bp_data.bp.label.valid = true;
-                break;
-            }
-        }
+        bp_data.bp.label.valid = true;
     }
 
     //Set handle so other data (eg. label list) can be accessed by callbacks and continue
@@ -217,87 +201,31 @@ esp_err_t hulp_debug_bp_deinit(hulp_debug_bp_handle_t handle)
     hulp_ulp_isr_deregister(hulp_debug_isr_handler, handle);
     if(handle)
     {
-        if(handle->labels.pc_pairs)
-        {
-            free(handle->labels.pc_pairs);
-        }
+        hulp_program_index_deinit(&handle->labels);
         free(handle);
         handle = NULL;
     }
     return ESP_OK;
 }
 
-static size_t hulp_debug_count_ulp_program_labels(const ulp_insn_t* program, size_t num_words)
+static esp_err_t hulp_debug_get_pc_from_label(hulp_debug_bp_handle_t handle, uint16_t label_num, uint16_t* dest)
 {
-    size_t num_labels = 0;
-    const ulp_insn_t* program_end = program + num_words;
-    while(program < program_end)
-    {
-        if(program->macro.opcode == OPCODE_MACRO && program->macro.sub_opcode == SUB_OPCODE_MACRO_LABEL)
-        {
-            ++num_labels;
-        }
-        ++program;
-    }
-    return num_labels;
-}
-
-static size_t hulp_debug_populate_ulp_program_label_pcs(hulp_debug_label_pc_pair_t* label_pairs, size_t max_label_pairs, const ulp_insn_t* program, size_t num_words)
-{
-    size_t current_pc = 0;
-
-    const ulp_insn_t* program_end = program + num_words;
-    const hulp_debug_label_pc_pair_t* labelpairs_end = label_pairs + max_label_pairs;
-
-    while(program < program_end && label_pairs < labelpairs_end)
-    {
-        if(program->macro.opcode == OPCODE_MACRO)
-        {
-            if(program->macro.sub_opcode == SUB_OPCODE_MACRO_LABEL)
-            {
-                label_pairs->label_num = program->macro.label;
-                label_pairs->pc = current_pc;
-                ++label_pairs;
-            }
-        }
-        else
-        {
-            ++current_pc;
-        }
-        ++program;
-    }
-
-    size_t num_populated = max_label_pairs - (labelpairs_end - label_pairs);
-    return num_populated;
-}
-
-static esp_err_t hulp_debug_get_pc_from_label_pairs(hulp_debug_bp_handle_t handle, uint16_t label_num, uint16_t* dest)
-{
-    if(!handle->labels.pc_pairs)
+    if(!handle->labels.by_label)
     {
         return ESP_ERR_INVALID_STATE;
     }
 
-    for(size_t i = 0; i < handle->labels.num; ++i)
-    {
-        if(handle->labels.pc_pairs[i].label_num == label_num)
-        {
-            *dest = handle->labels.pc_pairs[i].pc;
-            return ESP_OK;
-        }
-    }
-
-    return ESP_ERR_NOT_FOUND;
+    return hulp_program_index_find_pc(&handle->labels, label_num, dest);
 }
 
 esp_err_t hulp_debug_bp_set_continue_label(hulp_debug_bp_cb_data_t* bp_data, uint16_t label_num)
 {
-    if(!bp_data->meta.handle->labels.pc_pairs)
+    if(!bp_data->meta.handle->labels.by_label)
     {
         return ESP_ERR_INVALID_STATE;
     }
 
-    return hulp_debug_get_pc_from_label_pairs(bp_data->meta.handle, label_num, &(bp_data->meta.return_addr));
+    return hulp_debug_get_pc_from_label(bp_data->meta.handle, label_num, &(bp_data->meta.return_addr));
 
 }
 
@@ -337,7 +265,7 @@ esp_err_t hulp_debug_bp_disable_by_pc(uint16_t pc)
 esp_err_t hulp_debug_bp_enable_by_label(hulp_debug_bp_handle_t handle, uint16_t label_num)
 {
     uint16_t pc;
-    esp_err_t err = hulp_debug_get_pc_from_label_pairs(handle, label_num, &pc);
+    esp_err_t err = hulp_debug_get_pc_from_label(handle, label_num, &pc);
     if(err == ESP_OK)
     {
         err = hulp_debug_bp_enable_by_pc(pc);
@@ -348,7 +276,7 @@ esp_err_t hulp_debug_bp_enable_by_label(hulp_debug_bp_handle_t handle, uint16_t
 esp_err_t hulp_debug_bp_disable_by_label(hulp_debug_bp_handle_t handle, uint16_t label_num)
 {
     uint16_t pc;
-    esp_err_t err = hulp_debug_get_pc_from_label_pairs(handle, label_num, &pc);
+    esp_err_t err = hulp_debug_get_pc_from_label(handle, label_num, &pc);
     if(err == ESP_OK)
     {
         err = hulp_debug_bp_disable_by_pc(pc);
@@ -369,19 +297,12 @@ esp_err_t hulp_debug_bp_init(const hulp_debug_bp_config_t* config, hulp_debug_bp
 
     if(config->program.ptr)
     {
-        size_t num_labels_in_program = hulp_debug_count_ulp_program_labels(config->program.ptr, config->program.num_words);
-        if(num_labels_in_program > 0)
+        esp_err_t err = hulp_program_index_init(&dbg_state->labels, config->program.ptr, config->program.num_words);
+        if(err != ESP_OK)
         {
-            dbg_state->labels.pc_pairs = (hulp_debug_label_pc_pair_t*)malloc(num_labels_in_program * sizeof(hulp_debug_label_pc_pair_t));
-            if(!dbg_state->labels.pc_pairs)
-            {
-                ESP_LOGE(TAG, "no memory for debug labels");
-                hulp_debug_bp_deinit(dbg_state);
-                return ESP_ERR_NO_MEM;
-            }
-            hulp_debug_populate_ulp_program_label_pcs(dbg_state->labels.pc_pairs, num_labels_in_program, config->program.ptr, config->program.num_words);
-            dbg_state->labels.num = num_labels_in_program;
-
+            ESP_LOGE(TAG, "failed to index debug labels (%d)", err);
+            hulp_debug_bp_deinit(dbg_state);
+            return err;
         }
     }
 
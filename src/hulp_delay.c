@@ -0,0 +1,238 @@
+#include "hulp_delay.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "hulp_cfg.h"
+
+static const char* TAG = "HULP-DELAY";
+
+#define HULP_DELAY_MAX_DELAY_CYCLES 0xFFFF
+
+#define HULP_DELAY_STAGE_MAX_ITERATIONS 0xFF
+#define HULP_DELAY_R0_MAX_ITERATIONS 0xFFFF
+
+typedef struct {
+    size_t num_words;
+    uint64_t cycles;
+    uint32_t iterations;        /*!< Loop iterations, or 0 for I_DELAY only */
+    uint16_t loop_delay;        /*!< I_DELAY cycles in the loop */
+    bool remainder;             /*!< Loop is followed by an I_DELAY */
+} hulp_delay_plan_t;
+
+/**
+ * Loop of I_DELAY, counted by the stage counter or R0
+ */
+typedef struct {
+    ulp_insn_t insns[HULP_DELAY_MAX_LOOP_WORDS - 1];
+    uint32_t max_iterations;
+    uint32_t setup_cycles;      /*!< Cycles before the loop */
+    uint32_t body_cycles;       /*!< Cycles of each iteration, with I_DELAY(0) */
+} hulp_delay_loop_t;
+
+static void hulp_delay_loop_init(hulp_delay_loop_t* loop, hulp_delay_clobber_t clobber, uint32_t iterations, uint16_t loop_delay)
+{
+    if(clobber == HULP_DELAY_CLOBBER_STAGE)
+    {
+        const ulp_insn_t insns[] = {
+            I_STAGE_RST(),
+            I_STAGE_INC(1),
+            I_DELAY(loop_delay),
+            I_JUMPS(-2, iterations, JUMPS_LT),
+        };
+        memcpy(loop->insns, insns, sizeof(insns));
+        loop->max_iterations = HULP_DELAY_STAGE_MAX_ITERATIONS;
+    }
+    else
+    {
+        const ulp_insn_t insns[] = {
+            I_MOVI(R0, 0),
+            I_ADDI(R0, R0, 1),
+            I_DELAY(loop_delay),
+            I_BL(-2, iterations),
+        };
+        memcpy(loop->insns, insns, sizeof(insns));
+        loop->max_iterations = HULP_DELAY_R0_MAX_ITERATIONS;
+    }
+    loop->setup_cycles = hulp_cfg_get_cycles(&loop->insns[0]);
+    loop->body_cycles = hulp_cfg_get_cycles(&loop->insns[1]) + hulp_cfg_get_cycles(&loop->insns[3]) + (hulp_cfg_get_cycles(&loop->insns[2]) - loop_delay);
+}
+
+static uint64_t hulp_delay_abs_diff(uint64_t a, uint64_t b)
+{
+    return (a > b) ? (a - b) : (b - a);
+}
+
+/**
+ * Prefer fewer words, then less error.
+ */
+static bool hulp_delay_plan_better(const hulp_delay_plan_t* plan, const hulp_delay_plan_t* best, uint64_t target, uint64_t max_error)
+{
+    uint64_t error = hulp_delay_abs_diff(plan->cycles, target);
+    uint64_t best_error = hulp_delay_abs_diff(best->cycles, target);
+    bool ok = error <= max_error;
+    bool best_ok = best_error <= max_error;
+    if(ok != best_ok)
+    {
+        return ok;
+    }
+    if(ok && plan->num_words != best->num_words)
+    {
+        return plan->num_words < best->num_words;
+    }
+    return error < best_error;
+}
+
+/**
+ * I_DELAY only: each word is 6 to 65541 cycles.
+ */
+static void hulp_delay_plan_straight(uint64_t target, uint64_t max_error, size_t max_words, uint32_t delay_cycles, hulp_delay_plan_t* best)
+{
+    uint64_t max_cycles = delay_cycles + HULP_DELAY_MAX_DELAY_CYCLES;
+    uint64_t words_needed = (target + max_cycles - 1) / max_cycles;
+    size_t max_k = (words_needed < max_words) ? (size_t)words_needed : max_words;
+    for(size_t k = 0; k <= max_k; ++k)
+    {
+        uint64_t lo = (uint64_t)delay_cycles * k;
+        uint64_t hi = max_cycles * k;
+        hulp_delay_plan_t plan = {
+            .num_words = k,
+            .cycles = (target < lo) ? lo : ((target > hi) ? hi : target),
+        };
+        if(k == 0 || hulp_delay_plan_better(&plan, best, target, max_error))
+        {
+            *best = plan;
+        }
+    }
+}
+
+/**
+ * A loop of iterations * I_DELAY(loop_delay), optionally followed by I_DELAY for the remainder.
+ */
+static void hulp_delay_plan_loop(uint64_t target, uint64_t max_error, size_t max_words, uint32_t delay_cycles, const hulp_delay_loop_t* loop, hulp_delay_plan_t* best)
+{
+    if(max_words < HULP_DELAY_MAX_LOOP_WORDS - 1 || target <= loop->setup_cycles)
+    {
+        return;
+    }
+    uint64_t loop_target = target - loop->setup_cycles;
+    for(uint32_t iterations = 1; iterations <= loop->max_iterations; ++iterations)
+    {
+        // Loop alone: nearest I_DELAY
+        uint64_t per_iteration = (loop_target + iterations / 2) / iterations;
+        uint64_t loop_delay = (per_iteration > loop->body_cycles) ? (per_iteration - loop->body_cycles) : 0;
+        if(loop_delay > HULP_DELAY_MAX_DELAY_CYCLES)
+        {
+            loop_delay = HULP_DELAY_MAX_DELAY_CYCLES;
+        }
+        hulp_delay_plan_t plan = {
+            .num_words = HULP_DELAY_MAX_LOOP_WORDS - 1,
+            .cycles = loop->setup_cycles + (uint64_t)iterations * (loop->body_cycles + loop_delay),
+            .iterations = iterations,
+            .loop_delay = (uint16_t)loop_delay,
+        };
+        if(hulp_delay_plan_better(&plan, best, target, max_error))
+        {
+            *best = plan;
+        }
+
+        // Loop, then I_DELAY for the remainder
+        if(max_words >= HULP_DELAY_MAX_LOOP_WORDS && loop_target >= delay_cycles + (uint64_t)iterations * loop->body_cycles)
+        {
+            loop_delay = (loop_target - delay_cycles) / iterations - loop->body_cycles;
+            if(loop_delay > HULP_DELAY_MAX_DELAY_CYCLES)
+            {
+                loop_delay = HULP_DELAY_MAX_DELAY_CYCLES;
+            }
+            uint64_t remainder = loop_target - (uint64_t)iterations * (loop->body_cycles + loop_delay);
+            if(remainder > delay_cycles + HULP_DELAY_MAX_DELAY_CYCLES)
+            {
+                remainder = delay_cycles + HULP_DELAY_MAX_DELAY_CYCLES;
+            }
+            plan.num_words = HULP_DELAY_MAX_LOOP_WORDS;
+            plan.cycles = loop->setup_cycles + (uint64_t)iterations * (loop->body_cycles + loop_delay) + remainder;
+            plan.loop_delay = (uint16_t)loop_delay;
+            plan.remainder = true;
+            if(hulp_delay_plan_better(&plan, best, target, max_error))
+            {
+                *best = plan;
+            }
+            plan.remainder = false;
+        }
+
+        if(hulp_delay_abs_diff(best->cycles, target) == 0 && best->num_words == HULP_DELAY_MAX_LOOP_WORDS - 1)
+        {
+            break;
+        }
+    }
+}
+
+static void hulp_delay_emit(const hulp_delay_plan_t* plan, hulp_delay_clobber_t clobber, uint32_t delay_cycles, ulp_insn_t* insns)
+{
+    uint64_t remaining = plan->cycles;
+    size_t num_delays = plan->num_words;
+    if(plan->iterations)
+    {
+        hulp_delay_loop_t loop;
+        hulp_delay_loop_init(&loop, clobber, plan->iterations, plan->loop_delay);
+        memcpy(insns, loop.insns, sizeof(loop.insns));
+        insns += HULP_DELAY_MAX_LOOP_WORDS - 1;
+        remaining -= loop.setup_cycles + (uint64_t)plan->iterations * (loop.body_cycles + plan->loop_delay);
+        num_delays = plan->remainder ? 1 : 0;
+    }
+    // Spread evenly over the I_DELAYs
+    for(size_t i = 0; i < num_delays; ++i)
+    {
+        uint64_t cycles = remaining / (num_delays - i);
+        const ulp_insn_t delay = I_DELAY((uint16_t)(cycles - delay_cycles));
+        insns[i] = delay;
+        remaining -= cycles;
+    }
+}
+
+uint64_t hulp_delay_ns_to_cycles(uint64_t delay_ns, uint32_t fast_clk_hz)
+{
+    return (delay_ns * fast_clk_hz + 500000000ULL) / 1000000000ULL;
+}
+
+esp_err_t hulp_delay_generate(uint64_t delay_ns, uint32_t fast_clk_hz, hulp_delay_clobber_t clobber, uint32_t max_error_ns, ulp_insn_t* insns, size_t max_words, hulp_delay_t* result)
+{
+    if(!fast_clk_hz || (max_words && !insns) || clobber > HULP_DELAY_CLOBBER_R0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const ulp_insn_t delay = I_DELAY(0);
+    uint32_t delay_cycles = hulp_cfg_get_cycles(&delay);
+    uint64_t target = hulp_delay_ns_to_cycles(delay_ns, fast_clk_hz);
+    uint64_t max_error = (uint64_t)max_error_ns * fast_clk_hz / 1000000000ULL;
+
+    hulp_delay_plan_t best;
+    hulp_delay_plan_straight(target, max_error, max_words, delay_cycles, &best);
+    // A loop is only shorter than 4 I_DELAYs
+    if(clobber != HULP_DELAY_CLOBBER_NONE && (best.num_words >= HULP_DELAY_MAX_LOOP_WORDS - 1 || hulp_delay_abs_diff(best.cycles, target) > max_error))
+    {
+        hulp_delay_loop_t loop;
+        hulp_delay_loop_init(&loop, clobber, 0, 0);
+        hulp_delay_plan_loop(target, max_error, max_words, delay_cycles, &loop, &best);
+    }
+
+    int64_t error_cycles = (int64_t)best.cycles - (int64_t)target;
+    if(result)
+    {
+        result->num_words = best.num_words;
+        result->target_cycles = target;
+        result->cycles = best.cycles;
+        result->error_ns = error_cycles * 1000000000LL / (int64_t)fast_clk_hz;
+    }
+    if(hulp_delay_abs_diff(best.cycles, target) > max_error)
+    {
+        ESP_LOGE(TAG, "[%s] %" PRIu64 " ns: closest in %u words is %" PRIi64 " cycles off", __func__, delay_ns, (unsigned)max_words, error_cycles);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    hulp_delay_emit(&best, clobber, delay_cycles, insns);
+    return ESP_OK;
+}
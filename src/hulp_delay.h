@@ -0,0 +1,67 @@
+#ifndef HULP_DELAY_H
+#define HULP_DELAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hulp_compat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Delay generator: the shortest sequence of instructions that takes a given time, for any duration.
+ *
+ * Rather than choosing one of the M_DELAY_* macros for the range of the delay, the generator considers I_DELAY
+ * sequences and (if allowed to clobber them) loops on the stage counter or R0, costing each instruction as per
+ * hulp_cfg_get_cycles at the given fast clock frequency (eg. hulp_get_fast_clk_freq()).
+ *
+ * Example:
+ *      ulp_insn_t delay[HULP_DELAY_MAX_LOOP_WORDS];
+ *      hulp_delay_t result;
+ *      hulp_delay_generate(13000000, hulp_get_fast_clk_freq(), HULP_DELAY_CLOBBER_R0, 1000, delay, HULP_DELAY_MAX_LOOP_WORDS, &result);
+ *      //Copy result.num_words of delay into the program
+ */
+
+/**
+ * Most words used by a loop (loop of 4, plus I_DELAY for the remainder)
+ */
+#define HULP_DELAY_MAX_LOOP_WORDS 5
+
+typedef enum {
+    HULP_DELAY_CLOBBER_NONE,    /*!< I_DELAY only */
+    HULP_DELAY_CLOBBER_STAGE,   /*!< May loop on the stage counter (up to ~2s at 8.5MHz) */
+    HULP_DELAY_CLOBBER_R0,      /*!< May loop on R0, clobbering R0 and the ALU flags (up to ~500s at 8.5MHz) */
+} hulp_delay_clobber_t;
+
+typedef struct {
+    size_t num_words;           /*!< Number of instructions generated */
+    uint64_t target_cycles;     /*!< Delay requested, in RTC_FAST_CLK cycles */
+    uint64_t cycles;            /*!< Delay achieved, in RTC_FAST_CLK cycles */
+    int64_t error_ns;           /*!< Achieved minus requested delay (ns) */
+} hulp_delay_t;
+
+/**
+ * Convert a time (ns) to RTC_FAST_CLK cycles (rounded to nearest).
+ */
+uint64_t hulp_delay_ns_to_cycles(uint64_t delay_ns, uint32_t fast_clk_hz);
+
+/**
+ * Generate the shortest sequence of instructions that delays for delay_ns to within max_error_ns.
+ * Of sequences of the same length, the one with the least error is chosen.
+ *
+ * fast_clk_hz: eg. hulp_get_fast_clk_freq()
+ * clobber: what the delay may use besides I_DELAY
+ * insns, max_words: destination
+ * result: optional, the achieved delay (even if no sequence was within max_error_ns)
+ *
+ * Returns ESP_ERR_INVALID_SIZE if no sequence of up to max_words is within max_error_ns, and nothing is written to insns.
+ */
+esp_err_t hulp_delay_generate(uint64_t delay_ns, uint32_t fast_clk_hz, hulp_delay_clobber_t clobber, uint32_t max_error_ns, ulp_insn_t* insns, size_t max_words, hulp_delay_t* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_DELAY_H */
@@ -0,0 +1,969 @@
+#include "hulp_disasm.h"
+
+#include <string.h>
+
+#include "soc/rtc_cntl_reg.h"
+#include "soc/rtc_i2c_reg.h"
+#include "soc/rtc_io_reg.h"
+#include "soc/sens_reg.h"
+#include "soc/soc.h"
+
+#define HULP_DISASM_LINE_MAX 160
+#define HULP_DISASM_BATCH_SIZE 512
+
+typedef enum {
+    HULP_DISASM_FMT_NONE,       /*!< No operands */
+    HULP_DISASM_FMT_WR_REG,     /*!< addr, low, high, data */
+    HULP_DISASM_FMT_RD_REG,     /*!< addr, low, high */
+    HULP_DISASM_FMT_I2C,        /*!< sub_addr, data, low, high, sel, rw */
+    HULP_DISASM_FMT_DELAY,      /*!< cycles */
+    HULP_DISASM_FMT_ADC,        /*!< Rdst, sar_sel, pad */
+    HULP_DISASM_FMT_ST,         /*!< Rsrc, Raddr, offset */
+    HULP_DISASM_FMT_LD,         /*!< Rdst, Raddr, offset */
+    HULP_DISASM_FMT_ALU_REG,    /*!< Rdst, Rsrc1, Rsrc2 */
+    HULP_DISASM_FMT_MOVR,       /*!< Rdst, Rsrc */
+    HULP_DISASM_FMT_ALU_IMM,    /*!< Rdst, Rsrc, imm */
+    HULP_DISASM_FMT_MOVI,       /*!< Rdst, imm */
+    HULP_DISASM_FMT_STAGE,      /*!< imm */
+    HULP_DISASM_FMT_BX_REG,     /*!< Raddr */
+    HULP_DISASM_FMT_BX_IMM,     /*!< addr */
+    HULP_DISASM_FMT_BR,         /*!< offset, imm */
+    HULP_DISASM_FMT_BS,         /*!< offset, imm, cmp */
+    HULP_DISASM_FMT_SLEEP,      /*!< cycle_sel */
+    HULP_DISASM_FMT_TSENS,      /*!< Rdst, wait_delay */
+} hulp_disasm_fmt_t;
+
+typedef struct {
+    const char* name;
+    uint8_t fmt;
+} hulp_disasm_op_desc_t;
+
+static const hulp_disasm_op_desc_t s_ops[HULP_DISASM_MAX] = {
+    [HULP_DISASM_INVALID] =         {"I_INVALID", HULP_DISASM_FMT_NONE},
+    [HULP_DISASM_WR_REG] =          {"I_WR_REG", HULP_DISASM_FMT_WR_REG},
+    [HULP_DISASM_RD_REG] =          {"I_RD_REG", HULP_DISASM_FMT_RD_REG},
+    [HULP_DISASM_I2C_RW] =          {"I_I2C_RW", HULP_DISASM_FMT_I2C},
+    [HULP_DISASM_DELAY] =           {"I_DELAY", HULP_DISASM_FMT_DELAY},
+    [HULP_DISASM_ADC] =             {"I_ADC", HULP_DISASM_FMT_ADC},
+    [HULP_DISASM_ST] =              {"I_ST", HULP_DISASM_FMT_ST},
+    [HULP_DISASM_ADDR] =            {"I_ADDR", HULP_DISASM_FMT_ALU_REG},
+    [HULP_DISASM_SUBR] =            {"I_SUBR", HULP_DISASM_FMT_ALU_REG},
+    [HULP_DISASM_ANDR] =            {"I_ANDR", HULP_DISASM_FMT_ALU_REG},
+    [HULP_DISASM_ORR] =             {"I_ORR", HULP_DISASM_FMT_ALU_REG},
+    [HULP_DISASM_MOVR] =            {"I_MOVR", HULP_DISASM_FMT_MOVR},
+    [HULP_DISASM_LSHR] =            {"I_LSHR", HULP_DISASM_FMT_ALU_REG},
+    [HULP_DISASM_RSHR] =            {"I_RSHR", HULP_DISASM_FMT_ALU_REG},
+    [HULP_DISASM_ADDI] =            {"I_ADDI", HULP_DISASM_FMT_ALU_IMM},
+    [HULP_DISASM_SUBI] =            {"I_SUBI", HULP_DISASM_FMT_ALU_IMM},
+    [HULP_DISASM_ANDI] =            {"I_ANDI", HULP_DISASM_FMT_ALU_IMM},
+    [HULP_DISASM_ORI] =             {"I_ORI", HULP_DISASM_FMT_ALU_IMM},
+    [HULP_DISASM_MOVI] =            {"I_MOVI", HULP_DISASM_FMT_MOVI},
+    [HULP_DISASM_LSHI] =            {"I_LSHI", HULP_DISASM_FMT_ALU_IMM},
+    [HULP_DISASM_RSHI] =            {"I_RSHI", HULP_DISASM_FMT_ALU_IMM},
+    [HULP_DISASM_STAGE_INC] =       {"I_STAGE_INC", HULP_DISASM_FMT_STAGE},
+    [HULP_DISASM_STAGE_DEC] =       {"I_STAGE_DEC", HULP_DISASM_FMT_STAGE},
+    [HULP_DISASM_STAGE_RST] =       {"I_STAGE_RST", HULP_DISASM_FMT_NONE},
+    [HULP_DISASM_BXR] =             {"I_BXR", HULP_DISASM_FMT_BX_REG},
+    [HULP_DISASM_BXI] =             {"I_BXI", HULP_DISASM_FMT_BX_IMM},
+    [HULP_DISASM_BXZR] =            {"I_BXZR", HULP_DISASM_FMT_BX_REG},
+    [HULP_DISASM_BXZI] =            {"I_BXZI", HULP_DISASM_FMT_BX_IMM},
+    [HULP_DISASM_BXFR] =            {"I_BXFR", HULP_DISASM_FMT_BX_REG},
+    [HULP_DISASM_BXFI] =            {"I_BXFI", HULP_DISASM_FMT_BX_IMM},
+    [HULP_DISASM_BL] =              {"I_BL", HULP_DISASM_FMT_BR},
+    [HULP_DISASM_BGE] =             {"I_BGE", HULP_DISASM_FMT_BR},
+    [HULP_DISASM_JUMPS] =           {"I_JUMPS", HULP_DISASM_FMT_BS},
+    [HULP_DISASM_WAKE] =            {"I_WAKE", HULP_DISASM_FMT_NONE},
+    [HULP_DISASM_SLEEP_CYCLE_SEL] = {"I_SLEEP_CYCLE_SEL", HULP_DISASM_FMT_SLEEP},
+    [HULP_DISASM_TSENS] =           {"I_TSENS", HULP_DISASM_FMT_TSENS},
+    [HULP_DISASM_HALT] =            {"I_HALT", HULP_DISASM_FMT_NONE},
+    [HULP_DISASM_LD] =              {"I_LD", HULP_DISASM_FMT_LD},
+};
+
+// Ops by opcode, where the opcode alone determines it
+static const uint8_t s_opcode_ops[16] = {
+    [OPCODE_WR_REG] = HULP_DISASM_WR_REG,
+    [OPCODE_RD_REG] = HULP_DISASM_RD_REG,
+    [OPCODE_I2C] = HULP_DISASM_I2C_RW,
+    [OPCODE_DELAY] = HULP_DISASM_DELAY,
+    [OPCODE_ADC] = HULP_DISASM_ADC,
+    [OPCODE_ST] = HULP_DISASM_ST,
+    [OPCODE_TSENS] = HULP_DISASM_TSENS,
+    [OPCODE_HALT] = HULP_DISASM_HALT,
+    [OPCODE_LD] = HULP_DISASM_LD,
+};
+
+// ALU ops by sub_opcode and sel
+static const uint8_t s_alu_ops[3][8] = {
+    [SUB_OPCODE_ALU_REG] = {
+        [ALU_SEL_ADD] = HULP_DISASM_ADDR, [ALU_SEL_SUB] = HULP_DISASM_SUBR, [ALU_SEL_AND] = HULP_DISASM_ANDR,
+        [ALU_SEL_OR] = HULP_DISASM_ORR, [ALU_SEL_MOV] = HULP_DISASM_MOVR, [ALU_SEL_LSH] = HULP_DISASM_LSHR,
+        [ALU_SEL_RSH] = HULP_DISASM_RSHR,
+    },
+    [SUB_OPCODE_ALU_IMM] = {
+        [ALU_SEL_ADD] = HULP_DISASM_ADDI, [ALU_SEL_SUB] = HULP_DISASM_SUBI, [ALU_SEL_AND] = HULP_DISASM_ANDI,
+        [ALU_SEL_OR] = HULP_DISASM_ORI, [ALU_SEL_MOV] = HULP_DISASM_MOVI, [ALU_SEL_LSH] = HULP_DISASM_LSHI,
+        [ALU_SEL_RSH] = HULP_DISASM_RSHI,
+    },
+    [SUB_OPCODE_ALU_CNT] = {
+        [ALU_SEL_SINC] = HULP_DISASM_STAGE_INC, [ALU_SEL_SDEC] = HULP_DISASM_STAGE_DEC, [ALU_SEL_SRST] = HULP_DISASM_STAGE_RST,
+    },
+};
+
+// I_BX ops by type and reg
+static const uint8_t s_bx_ops[3][2] = {
+    [BX_JUMP_TYPE_DIRECT] = {HULP_DISASM_BXI, HULP_DISASM_BXR},
+    [BX_JUMP_TYPE_ZERO] = {HULP_DISASM_BXZI, HULP_DISASM_BXZR},
+    [BX_JUMP_TYPE_OVF] = {HULP_DISASM_BXFI, HULP_DISASM_BXFR},
+};
+
+static const uint32_t s_periph_bases[4] = {
+    DR_REG_RTCCNTL_BASE,
+    DR_REG_RTCIO_BASE,
+    DR_REG_SENS_BASE,
+    DR_REG_RTC_I2C_BASE,
+};
+
+static const char* const s_jumps_cmps[4] = {"JUMPS_LT", "JUMPS_GE", "JUMPS_LE", "JUMPS_LE"};
+
+// Label forms of branches with static targets
+static const char* const s_label_macros[HULP_DISASM_MAX] = {
+    [HULP_DISASM_BXI] = "M_BX",
+    [HULP_DISASM_BXZI] = "M_BXZ",
+    [HULP_DISASM_BXFI] = "M_BXF",
+    [HULP_DISASM_BL] = "M_BL",
+    [HULP_DISASM_BGE] = "M_BGE",
+};
+static const char* const s_label_jumps[4] = {"M_BSLT", "M_BSGE", "M_BSLE", "M_BSLE"};
+
+typedef struct {
+    uint32_t addr;
+    const char* name;
+} hulp_disasm_reg_t;
+
+typedef struct {
+    uint32_t addr;
+    uint8_t shift;
+    uint8_t width;
+    const char* name;
+} hulp_disasm_field_t;
+
+#define HULP_DISASM_REG(reg) {(reg), #reg}
+#define HULP_DISASM_FIELD(reg, field) {(reg), field##_S, (uint8_t)__builtin_popcount(field##_V), #field "_S"}
+
+// Sorted by address
+static const hulp_disasm_reg_t s_regs[] = {
+    HULP_DISASM_REG(RTC_CNTL_OPTIONS0_REG),
+    HULP_DISASM_REG(RTC_CNTL_TIME_UPDATE_REG),
+    HULP_DISASM_REG(RTC_CNTL_TIME0_REG),
+    HULP_DISASM_REG(RTC_CNTL_TIME1_REG),
+    HULP_DISASM_REG(RTC_CNTL_STATE0_REG),
+    HULP_DISASM_REG(RTC_CNTL_TIMER2_REG),
+    HULP_DISASM_REG(RTC_CNTL_WAKEUP_STATE_REG),
+    HULP_DISASM_REG(RTC_CNTL_INT_ENA_REG),
+    HULP_DISASM_REG(RTC_CNTL_INT_RAW_REG),
+    HULP_DISASM_REG(RTC_CNTL_INT_ST_REG),
+    HULP_DISASM_REG(RTC_CNTL_INT_CLR_REG),
+    HULP_DISASM_REG(RTC_CNTL_EXT_WAKEUP_CONF_REG),
+    HULP_DISASM_REG(RTC_CNTL_PWC_REG),
+    HULP_DISASM_REG(RTC_CNTL_LOW_POWER_ST_REG),
+    HULP_DISASM_REG(RTC_CNTL_HOLD_FORCE_REG),
+    HULP_DISASM_REG(RTC_CNTL_EXT_WAKEUP1_REG),
+    HULP_DISASM_REG(RTC_CNTL_EXT_WAKEUP1_STATUS_REG),
+    HULP_DISASM_REG(RTC_GPIO_OUT_REG),
+    HULP_DISASM_REG(RTC_GPIO_OUT_W1TS_REG),
+    HULP_DISASM_REG(RTC_GPIO_OUT_W1TC_REG),
+    HULP_DISASM_REG(RTC_GPIO_ENABLE_REG),
+    HULP_DISASM_REG(RTC_GPIO_ENABLE_W1TS_REG),
+    HULP_DISASM_REG(RTC_GPIO_ENABLE_W1TC_REG),
+    HULP_DISASM_REG(RTC_GPIO_STATUS_REG),
+    HULP_DISASM_REG(RTC_GPIO_STATUS_W1TS_REG),
+    HULP_DISASM_REG(RTC_GPIO_STATUS_W1TC_REG),
+    HULP_DISASM_REG(RTC_GPIO_IN_REG),
+    HULP_DISASM_REG(RTC_GPIO_PIN0_REG),
+    HULP_DISASM_REG(RTC_IO_HALL_SENS_REG),
+    HULP_DISASM_REG(RTC_IO_SENSOR_PADS_REG),
+    HULP_DISASM_REG(RTC_IO_ADC_PAD_REG),
+    HULP_DISASM_REG(RTC_IO_PAD_DAC1_REG),
+    HULP_DISASM_REG(RTC_IO_PAD_DAC2_REG),
+    HULP_DISASM_REG(RTC_IO_XTAL_32K_PAD_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD0_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD1_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD2_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD3_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD4_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD5_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD6_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD7_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD8_REG),
+    HULP_DISASM_REG(RTC_IO_TOUCH_PAD9_REG),
+    HULP_DISASM_REG(RTC_IO_EXT_WAKEUP0_REG),
+    HULP_DISASM_REG(RTC_IO_SAR_I2C_IO_REG),
+    HULP_DISASM_REG(SENS_SAR_MEAS_WAIT2_REG),
+    HULP_DISASM_REG(SENS_ULP_CP_SLEEP_CYC0_REG),
+    HULP_DISASM_REG(SENS_ULP_CP_SLEEP_CYC1_REG),
+    HULP_DISASM_REG(SENS_ULP_CP_SLEEP_CYC2_REG),
+    HULP_DISASM_REG(SENS_ULP_CP_SLEEP_CYC3_REG),
+    HULP_DISASM_REG(SENS_ULP_CP_SLEEP_CYC4_REG),
+    HULP_DISASM_REG(SENS_SAR_START_FORCE_REG),
+    HULP_DISASM_REG(SENS_SAR_SLAVE_ADDR1_REG),
+    HULP_DISASM_REG(SENS_SAR_SLAVE_ADDR2_REG),
+    HULP_DISASM_REG(SENS_SAR_SLAVE_ADDR3_REG),
+    HULP_DISASM_REG(SENS_SAR_SLAVE_ADDR4_REG),
+    HULP_DISASM_REG(SENS_SAR_TSENS_CTRL_REG),
+    HULP_DISASM_REG(SENS_SAR_TOUCH_CTRL1_REG),
+    HULP_DISASM_REG(SENS_SAR_TOUCH_THRES1_REG),
+    HULP_DISASM_REG(SENS_SAR_TOUCH_OUT1_REG),
+    HULP_DISASM_REG(SENS_SAR_TOUCH_CTRL2_REG),
+    HULP_DISASM_REG(SENS_SAR_TOUCH_ENABLE_REG),
+    HULP_DISASM_REG(RTC_I2C_SCL_LOW_PERIOD_REG),
+    HULP_DISASM_REG(RTC_I2C_CTRL_REG),
+    HULP_DISASM_REG(RTC_I2C_TIMEOUT_REG),
+    HULP_DISASM_REG(RTC_I2C_SDA_DUTY_REG),
+    HULP_DISASM_REG(RTC_I2C_SCL_HIGH_PERIOD_REG),
+    HULP_DISASM_REG(RTC_I2C_SCL_START_PERIOD_REG),
+    HULP_DISASM_REG(RTC_I2C_SCL_STOP_PERIOD_REG),
+};
+
+// Sorted by register address
+static const hulp_disasm_field_t s_fields[] = {
+    HULP_DISASM_FIELD(RTC_CNTL_OPTIONS0_REG, RTC_CNTL_BIAS_CORE_FOLW_8M),
+    HULP_DISASM_FIELD(RTC_CNTL_OPTIONS0_REG, RTC_CNTL_BIAS_I2C_FOLW_8M),
+    HULP_DISASM_FIELD(RTC_CNTL_OPTIONS0_REG, RTC_CNTL_BIAS_SLEEP_FOLW_8M),
+    HULP_DISASM_FIELD(RTC_CNTL_TIME_UPDATE_REG, RTC_CNTL_TIME_UPDATE),
+    HULP_DISASM_FIELD(RTC_CNTL_TIME_UPDATE_REG, RTC_CNTL_TIME_VALID),
+    HULP_DISASM_FIELD(RTC_CNTL_TIME1_REG, RTC_CNTL_TIME_HI),
+    HULP_DISASM_FIELD(RTC_CNTL_STATE0_REG, RTC_CNTL_SLP_WAKEUP),
+    HULP_DISASM_FIELD(RTC_CNTL_STATE0_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN),
+    HULP_DISASM_FIELD(RTC_CNTL_TIMER2_REG, RTC_CNTL_ULPCP_TOUCH_START_WAIT),
+    HULP_DISASM_FIELD(RTC_CNTL_WAKEUP_STATE_REG, RTC_CNTL_WAKEUP_ENA),
+    HULP_DISASM_FIELD(RTC_CNTL_INT_ENA_REG, RTC_CNTL_ULP_CP_INT_ENA),
+    HULP_DISASM_FIELD(RTC_CNTL_INT_RAW_REG, RTC_CNTL_SAR_INT_RAW),
+    HULP_DISASM_FIELD(RTC_CNTL_INT_ST_REG, RTC_CNTL_SAR_INT_ST),
+    HULP_DISASM_FIELD(RTC_CNTL_INT_CLR_REG, RTC_CNTL_SAR_INT_CLR),
+    HULP_DISASM_FIELD(RTC_CNTL_EXT_WAKEUP_CONF_REG, RTC_CNTL_EXT_WAKEUP1_LV),
+    HULP_DISASM_FIELD(RTC_CNTL_EXT_WAKEUP_CONF_REG, RTC_CNTL_EXT_WAKEUP0_LV),
+    HULP_DISASM_FIELD(RTC_CNTL_PWC_REG, RTC_CNTL_PD_EN),
+    HULP_DISASM_FIELD(RTC_CNTL_PWC_REG, RTC_CNTL_PWC_FORCE_PU),
+    HULP_DISASM_FIELD(RTC_CNTL_PWC_REG, RTC_CNTL_PWC_FORCE_PD),
+    HULP_DISASM_FIELD(RTC_CNTL_LOW_POWER_ST_REG, RTC_CNTL_RDY_FOR_WAKEUP),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_X32N_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_X32P_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_TOUCH_PAD7_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_TOUCH_PAD6_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_TOUCH_PAD5_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_TOUCH_PAD4_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_TOUCH_PAD3_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_TOUCH_PAD2_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_TOUCH_PAD1_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_TOUCH_PAD0_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_SENSE4_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_SENSE3_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_SENSE2_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_SENSE1_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_PDAC2_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_PDAC1_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_ADC2_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_HOLD_FORCE_REG, RTC_CNTL_ADC1_HOLD_FORCE),
+    HULP_DISASM_FIELD(RTC_CNTL_EXT_WAKEUP1_REG, RTC_CNTL_EXT_WAKEUP1_STATUS_CLR),
+    HULP_DISASM_FIELD(RTC_CNTL_EXT_WAKEUP1_REG, RTC_CNTL_EXT_WAKEUP1_SEL),
+    HULP_DISASM_FIELD(RTC_CNTL_EXT_WAKEUP1_STATUS_REG, RTC_CNTL_EXT_WAKEUP1_STATUS),
+    HULP_DISASM_FIELD(RTC_GPIO_OUT_REG, RTC_GPIO_OUT_DATA),
+    HULP_DISASM_FIELD(RTC_GPIO_OUT_W1TS_REG, RTC_GPIO_OUT_DATA_W1TS),
+    HULP_DISASM_FIELD(RTC_GPIO_OUT_W1TC_REG, RTC_GPIO_OUT_DATA_W1TC),
+    HULP_DISASM_FIELD(RTC_GPIO_ENABLE_REG, RTC_GPIO_ENABLE),
+    HULP_DISASM_FIELD(RTC_GPIO_ENABLE_W1TS_REG, RTC_GPIO_ENABLE_W1TS),
+    HULP_DISASM_FIELD(RTC_GPIO_ENABLE_W1TC_REG, RTC_GPIO_ENABLE_W1TC),
+    HULP_DISASM_FIELD(RTC_GPIO_STATUS_REG, RTC_GPIO_STATUS_INT),
+    HULP_DISASM_FIELD(RTC_GPIO_STATUS_W1TS_REG, RTC_GPIO_STATUS_INT_W1TS),
+    HULP_DISASM_FIELD(RTC_GPIO_STATUS_W1TC_REG, RTC_GPIO_STATUS_INT_W1TC),
+    HULP_DISASM_FIELD(RTC_GPIO_IN_REG, RTC_GPIO_IN_NEXT),
+    HULP_DISASM_FIELD(RTC_GPIO_PIN0_REG, RTC_GPIO_PIN0_WAKEUP_ENABLE),
+    HULP_DISASM_FIELD(RTC_GPIO_PIN0_REG, RTC_GPIO_PIN0_INT_TYPE),
+    HULP_DISASM_FIELD(RTC_GPIO_PIN0_REG, RTC_GPIO_PIN0_PAD_DRIVER),
+    HULP_DISASM_FIELD(RTC_IO_HALL_SENS_REG, RTC_IO_XPD_HALL),
+    HULP_DISASM_FIELD(RTC_IO_HALL_SENS_REG, RTC_IO_HALL_PHASE),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE1_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE2_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE3_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE4_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE1_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE2_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE3_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE4_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE1_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE1_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE1_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE1_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE2_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE2_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE2_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE2_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE3_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE3_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE3_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE3_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE4_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE4_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE4_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE4_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC1_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC2_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC1_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC2_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC1_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC1_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC1_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC1_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC2_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC2_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC2_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_ADC_PAD_REG, RTC_IO_ADC2_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_DRV),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_RDE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_RUE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_DRV),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_RDE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_RUE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_DRV),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_RDE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_RUE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_DRV),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_RDE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_RUE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32N_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_XTAL_32K_PAD_REG, RTC_IO_X32P_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD0_REG, RTC_IO_TOUCH_PAD0_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD1_REG, RTC_IO_TOUCH_PAD1_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD2_REG, RTC_IO_TOUCH_PAD2_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD3_REG, RTC_IO_TOUCH_PAD3_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD4_REG, RTC_IO_TOUCH_PAD4_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD5_REG, RTC_IO_TOUCH_PAD5_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD6_REG, RTC_IO_TOUCH_PAD6_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD7_REG, RTC_IO_TOUCH_PAD7_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD8_REG, RTC_IO_TOUCH_PAD8_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_HOLD),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_DRV),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_RDE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_RUE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_MUX_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_FUN_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_SLP_SEL),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_SLP_IE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_SLP_OE),
+    HULP_DISASM_FIELD(RTC_IO_TOUCH_PAD9_REG, RTC_IO_TOUCH_PAD9_FUN_IE),
+    HULP_DISASM_FIELD(RTC_IO_EXT_WAKEUP0_REG, RTC_IO_EXT_WAKEUP0_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SAR_I2C_IO_REG, RTC_IO_SAR_I2C_SDA_SEL),
+    HULP_DISASM_FIELD(RTC_IO_SAR_I2C_IO_REG, RTC_IO_SAR_I2C_SCL_SEL),
+    HULP_DISASM_FIELD(SENS_SAR_MEAS_WAIT2_REG, SENS_FORCE_XPD_SAR),
+    HULP_DISASM_FIELD(SENS_SAR_START_FORCE_REG, SENS_PC_INIT),
+    HULP_DISASM_FIELD(SENS_SAR_START_FORCE_REG, SENS_ULP_CP_START_TOP),
+    HULP_DISASM_FIELD(SENS_SAR_START_FORCE_REG, SENS_ULP_CP_FORCE_START_TOP),
+    HULP_DISASM_FIELD(SENS_SAR_SLAVE_ADDR1_REG, SENS_I2C_SLAVE_ADDR0),
+    HULP_DISASM_FIELD(SENS_SAR_SLAVE_ADDR1_REG, SENS_I2C_SLAVE_ADDR1),
+    HULP_DISASM_FIELD(SENS_SAR_SLAVE_ADDR2_REG, SENS_I2C_SLAVE_ADDR2),
+    HULP_DISASM_FIELD(SENS_SAR_SLAVE_ADDR2_REG, SENS_I2C_SLAVE_ADDR3),
+    HULP_DISASM_FIELD(SENS_SAR_SLAVE_ADDR3_REG, SENS_I2C_SLAVE_ADDR4),
+    HULP_DISASM_FIELD(SENS_SAR_SLAVE_ADDR3_REG, SENS_I2C_SLAVE_ADDR5),
+    HULP_DISASM_FIELD(SENS_SAR_SLAVE_ADDR4_REG, SENS_I2C_SLAVE_ADDR6),
+    HULP_DISASM_FIELD(SENS_SAR_SLAVE_ADDR4_REG, SENS_I2C_SLAVE_ADDR7),
+    HULP_DISASM_FIELD(SENS_SAR_TSENS_CTRL_REG, SENS_TSENS_DUMP_OUT),
+    HULP_DISASM_FIELD(SENS_SAR_TSENS_CTRL_REG, SENS_TSENS_POWER_UP_FORCE),
+    HULP_DISASM_FIELD(SENS_SAR_TSENS_CTRL_REG, SENS_TSENS_POWER_UP),
+    HULP_DISASM_FIELD(SENS_SAR_TSENS_CTRL_REG, SENS_TSENS_CLK_DIV),
+    HULP_DISASM_FIELD(SENS_SAR_TOUCH_CTRL1_REG, SENS_TOUCH_OUT_1EN),
+    HULP_DISASM_FIELD(SENS_SAR_TOUCH_CTRL2_REG, SENS_TOUCH_START_EN),
+    HULP_DISASM_FIELD(SENS_SAR_TOUCH_CTRL2_REG, SENS_TOUCH_MEAS_DONE),
+    HULP_DISASM_FIELD(SENS_SAR_TOUCH_ENABLE_REG, SENS_TOUCH_PAD_OUTEN1),
+    HULP_DISASM_FIELD(SENS_SAR_TOUCH_ENABLE_REG, SENS_TOUCH_PAD_OUTEN2),
+    HULP_DISASM_FIELD(SENS_SAR_TOUCH_ENABLE_REG, SENS_TOUCH_PAD_WORKEN),
+    HULP_DISASM_FIELD(RTC_I2C_SCL_LOW_PERIOD_REG, RTC_I2C_SCL_LOW_PERIOD),
+    HULP_DISASM_FIELD(RTC_I2C_CTRL_REG, RTC_I2C_RX_LSB_FIRST),
+    HULP_DISASM_FIELD(RTC_I2C_CTRL_REG, RTC_I2C_TX_LSB_FIRST),
+    HULP_DISASM_FIELD(RTC_I2C_CTRL_REG, RTC_I2C_TRANS_START),
+    HULP_DISASM_FIELD(RTC_I2C_CTRL_REG, RTC_I2C_MS_MODE),
+    HULP_DISASM_FIELD(RTC_I2C_CTRL_REG, RTC_I2C_SCL_FORCE_OUT),
+    HULP_DISASM_FIELD(RTC_I2C_CTRL_REG, RTC_I2C_SDA_FORCE_OUT),
+    HULP_DISASM_FIELD(RTC_I2C_TIMEOUT_REG, RTC_I2C_TIMEOUT),
+    HULP_DISASM_FIELD(RTC_I2C_SDA_DUTY_REG, RTC_I2C_SDA_DUTY),
+    HULP_DISASM_FIELD(RTC_I2C_SCL_HIGH_PERIOD_REG, RTC_I2C_SCL_HIGH_PERIOD),
+    HULP_DISASM_FIELD(RTC_I2C_SCL_START_PERIOD_REG, RTC_I2C_SCL_START_PERIOD),
+    HULP_DISASM_FIELD(RTC_I2C_SCL_STOP_PERIOD_REG, RTC_I2C_SCL_STOP_PERIOD),
+};
+
+static hulp_disasm_op_t hulp_disasm_lookup(const ulp_insn_t* insn)
+{
+    switch(insn->b.opcode)
+    {
+        case OPCODE_ALU:
+            return (insn->alu_reg.sub_opcode < 3 && insn->alu_reg.sel < 8) ?
+                (hulp_disasm_op_t)s_alu_ops[insn->alu_reg.sub_opcode][insn->alu_reg.sel] : HULP_DISASM_INVALID;
+        case OPCODE_BRANCH:
+            switch(insn->b.sub_opcode)
+            {
+                case SUB_OPCODE_BX:
+                    return (insn->bx.type < 3) ? (hulp_disasm_op_t)s_bx_ops[insn->bx.type][insn->bx.reg] : HULP_DISASM_INVALID;
+                case SUB_OPCODE_BR:
+                    return (insn->b.cmp == B_CMP_L) ? HULP_DISASM_BL : HULP_DISASM_BGE;
+                case SUB_OPCODE_BS:
+                    return HULP_DISASM_JUMPS;
+                default:
+                    return HULP_DISASM_INVALID;
+            }
+        case OPCODE_END:
+            switch(insn->end.sub_opcode)
+            {
+                case SUB_OPCODE_END:
+                    return HULP_DISASM_WAKE;
+                case SUB_OPCODE_SLEEP:
+                    return HULP_DISASM_SLEEP_CYCLE_SEL;
+                default:
+                    return HULP_DISASM_INVALID;
+            }
+        default:
+            return (hulp_disasm_op_t)s_opcode_ops[insn->b.opcode];
+    }
+}
+
+static void hulp_disasm_operands(hulp_decoded_insn_t* d, uint8_t reg_mask, int32_t a, int32_t b, int32_t c)
+{
+    d->reg_mask = reg_mask;
+    d->operands[0] = a;
+    d->operands[1] = b;
+    d->operands[2] = c;
+}
+
+esp_err_t hulp_disasm_decode(const ulp_insn_t* insn, uint16_t pc, hulp_decoded_insn_t* d)
+{
+    memset(d, 0, sizeof(*d));
+    d->op = hulp_disasm_lookup(insn);
+    switch(s_ops[d->op].fmt)
+    {
+        case HULP_DISASM_FMT_WR_REG:
+            d->num_operands = 4;
+            hulp_disasm_operands(d, 0, (int32_t)(s_periph_bases[insn->wr_reg.periph_sel] + insn->wr_reg.addr * sizeof(uint32_t)),
+                insn->wr_reg.low, insn->wr_reg.high);
+            d->operands[3] = insn->wr_reg.data;
+            break;
+        case HULP_DISASM_FMT_RD_REG:
+            d->num_operands = 3;
+            hulp_disasm_operands(d, 0, (int32_t)(s_periph_bases[insn->rd_reg.periph_sel] + insn->rd_reg.addr * sizeof(uint32_t)),
+                insn->rd_reg.low, insn->rd_reg.high);
+            break;
+        case HULP_DISASM_FMT_I2C:
+            d->num_operands = 6;
+            hulp_disasm_operands(d, 0, insn->i2c.i2c_addr, insn->i2c.data, insn->i2c.low_bits);
+            d->operands[3] = insn->i2c.high_bits;
+            d->operands[4] = insn->i2c.i2c_sel;
+            d->operands[5] = insn->i2c.rw;
+            break;
+        case HULP_DISASM_FMT_DELAY:
+            d->num_operands = 1;
+            hulp_disasm_operands(d, 0, insn->delay.cycles, 0, 0);
+            break;
+        case HULP_DISASM_FMT_ADC:
+            d->num_operands = 3;
+            hulp_disasm_operands(d, BIT(0), insn->adc.dreg, insn->adc.sar_sel, (int32_t)insn->adc.mux - 1);
+            break;
+        case HULP_DISASM_FMT_ST:
+            d->num_operands = 3;
+            hulp_disasm_operands(d, BIT(0) | BIT(1), insn->st.dreg, insn->st.sreg, insn->st.offset);
+            break;
+        case HULP_DISASM_FMT_LD:
+            d->num_operands = 3;
+            hulp_disasm_operands(d, BIT(0) | BIT(1), insn->ld.dreg, insn->ld.sreg, insn->ld.offset);
+            break;
+        case HULP_DISASM_FMT_ALU_REG:
+            d->num_operands = 3;
+            hulp_disasm_operands(d, BIT(0) | BIT(1) | BIT(2), insn->alu_reg.dreg, insn->alu_reg.sreg, insn->alu_reg.treg);
+            break;
+        case HULP_DISASM_FMT_MOVR:
+            d->num_operands = 2;
+            hulp_disasm_operands(d, BIT(0) | BIT(1), insn->alu_reg.dreg, insn->alu_reg.sreg, 0);
+            break;
+        case HULP_DISASM_FMT_ALU_IMM:
+            d->num_operands = 3;
+            hulp_disasm_operands(d, BIT(0) | BIT(1), insn->alu_imm.dreg, insn->alu_imm.sreg, insn->alu_imm.imm);
+            break;
+        case HULP_DISASM_FMT_MOVI:
+            d->num_operands = 2;
+            hulp_disasm_operands(d, BIT(0), insn->alu_imm.dreg, insn->alu_imm.imm, 0);
+            break;
+        case HULP_DISASM_FMT_STAGE:
+            d->num_operands = 1;
+            hulp_disasm_operands(d, 0, insn->alu_reg_s.imm, 0, 0);
+            break;
+        case HULP_DISASM_FMT_BX_REG:
+            d->num_operands = 1;
+            hulp_disasm_operands(d, BIT(0), insn->bx.dreg, 0, 0);
+            break;
+        case HULP_DISASM_FMT_BX_IMM:
+            d->num_operands = 1;
+            hulp_disasm_operands(d, 0, insn->bx.addr, 0, 0);
+            d->has_target = true;
+            d->target = insn->bx.addr;
+            break;
+        case HULP_DISASM_FMT_BR:
+            d->num_operands = 2;
+            hulp_disasm_operands(d, 0, insn->b.sign ? -(int32_t)insn->b.offset : (int32_t)insn->b.offset, insn->b.imm, 0);
+            d->has_target = true;
+            d->target = (uint16_t)(pc + d->operands[0]);
+            break;
+        case HULP_DISASM_FMT_BS:
+            d->num_operands = 3;
+            hulp_disasm_operands(d, 0, insn->bs.sign ? -(int32_t)insn->bs.offset : (int32_t)insn->bs.offset, insn->bs.imm, insn->bs.cmp);
+            d->has_target = true;
+            d->target = (uint16_t)(pc + d->operands[0]);
+            break;
+        case HULP_DISASM_FMT_SLEEP:
+            d->num_operands = 1;
+            hulp_disasm_operands(d, 0, insn->sleep.cycle_sel, 0, 0);
+            break;
+        case HULP_DISASM_FMT_TSENS:
+            d->num_operands = 2;
+            hulp_disasm_operands(d, BIT(0), insn->tsens.dreg, insn->tsens.wait_delay, 0);
+            break;
+        default:
+            break;
+    }
+    return (d->op == HULP_DISASM_INVALID) ? ESP_ERR_NOT_SUPPORTED : ESP_OK;
+}
+
+const char* hulp_disasm_op_name(hulp_disasm_op_t op)
+{
+    return (op < HULP_DISASM_MAX) ? s_ops[op].name : s_ops[HULP_DISASM_INVALID].name;
+}
+
+/**
+ * Bounded string writer: counts the full length, but only stores what fits (leaving room for the terminator).
+ */
+typedef struct {
+    char* buf;
+    size_t size;
+    size_t len;
+} hulp_disasm_writer_t;
+
+static void hulp_disasm_put(hulp_disasm_writer_t* w, const char* str, size_t len)
+{
+    if(w->len + 1 < w->size)
+    {
+        size_t n = w->size - 1 - w->len;
+        memcpy(w->buf + w->len, str, (len < n) ? len : n);
+    }
+    w->len += len;
+}
+
+static void hulp_disasm_put_str(hulp_disasm_writer_t* w, const char* str)
+{
+    hulp_disasm_put(w, str, strlen(str));
+}
+
+static void hulp_disasm_put_dec(hulp_disasm_writer_t* w, int32_t value)
+{
+    char digits[12];
+    size_t i = sizeof(digits);
+    uint32_t u = (value < 0) ? (uint32_t)-value : (uint32_t)value;
+    do
+    {
+        digits[--i] = (char)('0' + u % 10);
+        u /= 10;
+    } while(u);
+    if(value < 0)
+    {
+        digits[--i] = '-';
+    }
+    hulp_disasm_put(w, &digits[i], sizeof(digits) - i);
+}
+
+static void hulp_disasm_put_hex(hulp_disasm_writer_t* w, uint32_t value)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    char digits[10] = {'0', 'x'};
+    for(int i = 0; i < 8; ++i)
+    {
+        digits[2 + i] = hex[(value >> (28 - 4 * i)) & 0xF];
+    }
+    hulp_disasm_put(w, digits, sizeof(digits));
+}
+
+const char* hulp_disasm_reg_name(uint32_t addr)
+{
+    size_t lo = 0, hi = sizeof(s_regs) / sizeof(s_regs[0]);
+    while(lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if(s_regs[mid].addr < addr)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return (lo < sizeof(s_regs) / sizeof(s_regs[0]) && s_regs[lo].addr == addr) ? s_regs[lo].name : NULL;
+}
+
+/**
+ * Find the narrowest field of a register that contains bits [low, high].
+ */
+static const hulp_disasm_field_t* hulp_disasm_find_field(uint32_t addr, int32_t low, int32_t high)
+{
+    const size_t num_fields = sizeof(s_fields) / sizeof(s_fields[0]);
+    size_t lo = 0, hi = num_fields;
+    while(lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if(s_fields[mid].addr < addr)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    const hulp_disasm_field_t* best = NULL;
+    for(; lo < num_fields && s_fields[lo].addr == addr; ++lo)
+    {
+        const hulp_disasm_field_t* field = &s_fields[lo];
+        if(field->shift <= low && high < field->shift + field->width && (!best || field->width < best->width))
+        {
+            best = field;
+        }
+    }
+    return best;
+}
+
+static bool hulp_disasm_find_label(const hulp_disasm_symbols_t* symbols, uint16_t pc, uint16_t* label)
+{
+    size_t lo = 0, hi = symbols->num_labels;
+    while(lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if(symbols->labels[mid].pc < pc)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if(lo < symbols->num_labels && symbols->labels[lo].pc == pc)
+    {
+        *label = symbols->labels[lo].label;
+        return true;
+    }
+    return false;
+}
+
+static const hulp_disasm_var_t* hulp_disasm_find_var(const hulp_disasm_symbols_t* symbols, int32_t offset)
+{
+    for(size_t i = 0; i < symbols->num_vars; ++i)
+    {
+        const hulp_disasm_var_t* var = &symbols->vars[i];
+        if(offset >= var->offset && offset < var->offset + var->num_words)
+        {
+            return var;
+        }
+    }
+    return NULL;
+}
+
+// eg. "NAME + 3" or "NAME"
+static void hulp_disasm_put_sym(hulp_disasm_writer_t* w, const char* name, int32_t offset)
+{
+    hulp_disasm_put_str(w, name);
+    if(offset)
+    {
+        hulp_disasm_put(w, " + ", 3);
+        hulp_disasm_put_dec(w, offset);
+    }
+}
+
+static void hulp_disasm_put_operand(hulp_disasm_writer_t* w, const hulp_decoded_insn_t* d, uint8_t i, const hulp_disasm_symbols_t* symbols)
+{
+    int32_t value = d->operands[i];
+    if(d->reg_mask & BIT(i))
+    {
+        hulp_disasm_put(w, "R", 1);
+        hulp_disasm_put_dec(w, value);
+        return;
+    }
+    switch(d->op)
+    {
+        case HULP_DISASM_WR_REG:
+        case HULP_DISASM_RD_REG:
+            if(i == 0)
+            {
+                const char* name = (symbols && symbols->reg_names) ? hulp_disasm_reg_name((uint32_t)value) : NULL;
+                if(name)
+                {
+                    hulp_disasm_put_str(w, name);
+                }
+                else
+                {
+                    hulp_disasm_put_hex(w, (uint32_t)value);
+                }
+                return;
+            }
+            if((i == 1 || i == 2) && symbols && symbols->reg_names)
+            {
+                const hulp_disasm_field_t* field = hulp_disasm_find_field((uint32_t)d->operands[0], d->operands[1], d->operands[2]);
+                if(field)
+                {
+                    hulp_disasm_put_sym(w, field->name, value - field->shift);
+                    return;
+                }
+            }
+            break;
+        case HULP_DISASM_LD:
+        case HULP_DISASM_ST:
+            if(i == 2 && symbols)
+            {
+                const hulp_disasm_var_t* var = hulp_disasm_find_var(symbols, value);
+                if(var)
+                {
+                    hulp_disasm_put_str(w, "RTC_WORD_OFFSET(");
+                    hulp_disasm_put_str(w, var->name);
+                    hulp_disasm_put(w, ")", 1);
+                    if(value != var->offset)
+                    {
+                        hulp_disasm_put(w, " + ", 3);
+                        hulp_disasm_put_dec(w, value - var->offset);
+                    }
+                    return;
+                }
+            }
+            break;
+        case HULP_DISASM_JUMPS:
+            if(i == 2)
+            {
+                hulp_disasm_put_str(w, s_jumps_cmps[value & 3]);
+                return;
+            }
+            break;
+        default:
+            break;
+    }
+    hulp_disasm_put_dec(w, value);
+}
+
+size_t hulp_disasm_format(const hulp_decoded_insn_t* d, uint32_t raw, const hulp_disasm_symbols_t* symbols, char* buf, size_t size)
+{
+    hulp_disasm_writer_t w = {.buf = buf, .size = size, .len = 0};
+    uint16_t label;
+    uint8_t first = 0;
+    uint8_t num_operands = d->num_operands;
+    if(symbols && d->has_target && (s_label_macros[d->op] || d->op == HULP_DISASM_JUMPS) &&
+        hulp_disasm_find_label(symbols, d->target, &label))
+    {
+        // eg. M_BGE(4, 100); the comparison of I_JUMPS is in the macro name
+        hulp_disasm_put_str(&w, (d->op == HULP_DISASM_JUMPS) ? s_label_jumps[d->operands[2] & 3] : s_label_macros[d->op]);
+        hulp_disasm_put(&w, "(", 1);
+        hulp_disasm_put_dec(&w, label);
+        first = 1;
+        num_operands = (d->op == HULP_DISASM_JUMPS) ? 2 : num_operands;
+    }
+    else
+    {
+        hulp_disasm_put_str(&w, hulp_disasm_op_name(d->op));
+        hulp_disasm_put(&w, "(", 1);
+        if(d->op == HULP_DISASM_INVALID)
+        {
+            hulp_disasm_put_hex(&w, raw);
+        }
+    }
+    for(uint8_t i = first; i < num_operands; ++i)
+    {
+        if(i)
+        {
+            hulp_disasm_put(&w, ", ", 2);
+        }
+        hulp_disasm_put_operand(&w, d, i, symbols);
+    }
+    hulp_disasm_put(&w, ")", 1);
+    if(size)
+    {
+        buf[(w.len < size) ? w.len : size - 1] = '\0';
+    }
+    return w.len;
+}
+
+size_t hulp_disasm_insn(const ulp_insn_t* insn, uint16_t pc, const hulp_disasm_symbols_t* symbols, char* buf, size_t size)
+{
+    hulp_decoded_insn_t decoded;
+    hulp_disasm_decode(insn, pc, &decoded);
+    return hulp_disasm_format(&decoded, insn->instruction, symbols, buf, size);
+}
+
+/**
+ * Accumulates lines for the sink.
+ */
+typedef struct {
+    char buf[HULP_DISASM_BATCH_SIZE];
+    size_t len;
+    hulp_disasm_sink_t sink;
+    void* ctx;
+} hulp_disasm_batch_t;
+
+// Room for a line of up to HULP_DISASM_LINE_MAX
+static char* hulp_disasm_batch_line(hulp_disasm_batch_t* batch)
+{
+    if(batch->len + HULP_DISASM_LINE_MAX > sizeof(batch->buf))
+    {
+        batch->sink(batch->ctx, batch->buf, batch->len);
+        batch->len = 0;
+    }
+    return &batch->buf[batch->len];
+}
+
+// Complete a line of line_len (as returned by formatting into HULP_DISASM_LINE_MAX - 2), never stepping past a truncated one
+static void hulp_disasm_batch_end_line(hulp_disasm_batch_t* batch, size_t line_len)
+{
+    batch->len += (line_len < HULP_DISASM_LINE_MAX - 3) ? line_len : HULP_DISASM_LINE_MAX - 3;
+    batch->buf[batch->len++] = ',';
+    batch->buf[batch->len++] = '\n';
+}
+
+esp_err_t hulp_disasm_range(const ulp_insn_t* program, size_t num_words, uint16_t start, size_t count,
+    const hulp_disasm_symbols_t* symbols, hulp_disasm_sink_t sink, void* ctx)
+{
+    if(!program || !sink || start > num_words || count > num_words - start)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    hulp_disasm_batch_t batch = {.len = 0, .sink = sink, .ctx = ctx};
+    const hulp_label_pc_t* label = symbols ? symbols->labels : NULL;
+    const hulp_label_pc_t* labels_end = symbols ? symbols->labels + symbols->num_labels : NULL;
+    while(label != labels_end && label->pc < start)
+    {
+        ++label;
+    }
+    for(size_t pc = start; pc < start + count; ++pc)
+    {
+        for(; label != labels_end && label->pc == pc; ++label)
+        {
+            hulp_disasm_writer_t w = {.buf = hulp_disasm_batch_line(&batch), .size = HULP_DISASM_LINE_MAX - 2, .len = 0};
+            hulp_disasm_put_str(&w, "M_LABEL(");
+            hulp_disasm_put_dec(&w, label->label);
+            hulp_disasm_put(&w, ")", 1);
+            hulp_disasm_batch_end_line(&batch, w.len);
+        }
+        // Lines are well under HULP_DISASM_LINE_MAX
+        size_t line_len = hulp_disasm_insn(&program[pc], (uint16_t)pc, symbols, hulp_disasm_batch_line(&batch), HULP_DISASM_LINE_MAX - 2);
+        hulp_disasm_batch_end_line(&batch, line_len);
+    }
+    if(batch.len)
+    {
+        sink(ctx, batch.buf, batch.len);
+    }
+    return ESP_OK;
+}
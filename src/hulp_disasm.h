@@ -0,0 +1,160 @@
+#ifndef HULP_DISASM_H
+#define HULP_DISASM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "hulp_compat.h"
+#include "hulp_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Disassembly of processed ULP programs (no macros) into HULP's instruction macros (eg. "I_ADDI(R0, R1, 5)").
+ *
+ * Decoding is table-driven and formatting uses no printf, so neither allocates or blocks; output goes to a
+ * caller-supplied buffer or sink, which may be called from an ISR, write to a file, or batch a UART transfer.
+ */
+
+typedef enum {
+    HULP_DISASM_INVALID,
+    HULP_DISASM_WR_REG,
+    HULP_DISASM_RD_REG,
+    HULP_DISASM_I2C_RW,
+    HULP_DISASM_DELAY,
+    HULP_DISASM_ADC,
+    HULP_DISASM_ST,
+    HULP_DISASM_ADDR,
+    HULP_DISASM_SUBR,
+    HULP_DISASM_ANDR,
+    HULP_DISASM_ORR,
+    HULP_DISASM_MOVR,
+    HULP_DISASM_LSHR,
+    HULP_DISASM_RSHR,
+    HULP_DISASM_ADDI,
+    HULP_DISASM_SUBI,
+    HULP_DISASM_ANDI,
+    HULP_DISASM_ORI,
+    HULP_DISASM_MOVI,
+    HULP_DISASM_LSHI,
+    HULP_DISASM_RSHI,
+    HULP_DISASM_STAGE_INC,
+    HULP_DISASM_STAGE_DEC,
+    HULP_DISASM_STAGE_RST,
+    HULP_DISASM_BXR,
+    HULP_DISASM_BXI,
+    HULP_DISASM_BXZR,
+    HULP_DISASM_BXZI,
+    HULP_DISASM_BXFR,
+    HULP_DISASM_BXFI,
+    HULP_DISASM_BL,
+    HULP_DISASM_BGE,
+    HULP_DISASM_JUMPS,
+    HULP_DISASM_WAKE,
+    HULP_DISASM_SLEEP_CYCLE_SEL,
+    HULP_DISASM_TSENS,
+    HULP_DISASM_HALT,
+    HULP_DISASM_LD,
+    HULP_DISASM_MAX,
+} hulp_disasm_op_t;
+
+#define HULP_DISASM_MAX_OPERANDS 6
+
+/**
+ * A decoded instruction. Operands are in the order of the instruction's macro; registers are their number
+ * (eg. 1 for R1), branch offsets are signed, and I_WR_REG/I_RD_REG addresses are SoC addresses (eg. RTC_GPIO_OUT_REG).
+ */
+typedef struct {
+    hulp_disasm_op_t op;
+    uint8_t num_operands;
+    uint8_t reg_mask;                               /*!< Bit n is set if operands[n] is a register */
+    int32_t operands[HULP_DISASM_MAX_OPERANDS];
+    bool has_target;                                /*!< A branch with a static target (eg. I_BGE, I_JUMPS, I_BXI) */
+    uint16_t target;                                /*!< If has_target, the PC it may branch to */
+} hulp_decoded_insn_t;
+
+/**
+ * A named object in RTC slow memory, for symbolic I_LD/I_ST offsets. See HULP_DISASM_VAR.
+ */
+typedef struct {
+    const char* name;
+    uint16_t offset;        /*!< Word offset in RTC_SLOW_MEM */
+    uint16_t num_words;
+} hulp_disasm_var_t;
+
+/**
+ * Symbol for an existing object in RTC slow memory (eg. RTC_DATA_ATTR ulp_var_t counter[4]).
+ */
+#define HULP_DISASM_VAR(var_) { \
+        .name = #var_, \
+        .offset = RTC_WORD_OFFSET(var_), \
+        .num_words = (uint16_t)((sizeof(var_) + sizeof(uint32_t) - 1) / sizeof(uint32_t)) \
+    }
+
+/**
+ * Symbols for disassembly. Any of them may be omitted (NULL/0).
+ */
+typedef struct {
+    const hulp_disasm_var_t* vars;      /*!< I_LD/I_ST offsets within these are printed as RTC_WORD_OFFSET(name) */
+    size_t num_vars;
+    const hulp_label_pc_t* labels;      /*!< Sorted by PC (eg. hulp_program_index_t by_pc); branches to these are printed as M_ macros */
+    size_t num_labels;
+    bool reg_names;                     /*!< Print I_WR_REG/I_RD_REG addresses and bits as register and field names */
+} hulp_disasm_symbols_t;
+
+#define HULP_DISASM_SYMBOLS_DEFAULT() { \
+        .vars = NULL, \
+        .num_vars = 0, \
+        .labels = NULL, \
+        .num_labels = 0, \
+        .reg_names = true \
+    }
+
+/**
+ * Receives formatted text (not null terminated) from hulp_disasm_range.
+ */
+typedef void (*hulp_disasm_sink_t)(void* ctx, const char* text, size_t len);
+
+/**
+ * Decode an instruction at pc (relative to the start of the program, for branch targets).
+ * Returns ESP_ERR_NOT_SUPPORTED if it is not a valid instruction (decoded->op is HULP_DISASM_INVALID).
+ */
+esp_err_t hulp_disasm_decode(const ulp_insn_t* insn, uint16_t pc, hulp_decoded_insn_t* decoded);
+
+/**
+ * Get the macro name of an op, eg. "I_ADDI".
+ */
+const char* hulp_disasm_op_name(hulp_disasm_op_t op);
+
+/**
+ * Get the name of a known RTC peripheral register (eg. "RTC_GPIO_OUT_W1TS_REG"), or NULL.
+ */
+const char* hulp_disasm_reg_name(uint32_t addr);
+
+/**
+ * Format a decoded instruction as its macro, eg. "I_ADDI(R0, R1, 5)", or "I_INVALID(0x...)" with the raw word if invalid.
+ * With symbols (may be NULL), eg. "I_WR_REG(RTC_GPIO_OUT_W1TS_REG, RTC_GPIO_OUT_DATA_W1TS_S + 3, RTC_GPIO_OUT_DATA_W1TS_S + 3, 1)",
+ * "I_LD(R0, R2, RTC_WORD_OFFSET(counter) + 1)" or "M_BGE(4, 100)".
+ * As per snprintf, the output is truncated to fit size (including the terminator), and the untruncated length is returned.
+ */
+size_t hulp_disasm_format(const hulp_decoded_insn_t* decoded, uint32_t raw, const hulp_disasm_symbols_t* symbols, char* buf, size_t size);
+
+/**
+ * Decode and format one instruction into buf. As per hulp_disasm_format.
+ */
+size_t hulp_disasm_insn(const ulp_insn_t* insn, uint16_t pc, const hulp_disasm_symbols_t* symbols, char* buf, size_t size);
+
+/**
+ * Disassemble program[start, start + count) as one macro per line ("I_...,\n"), passing the text to sink in
+ * batches of up to a few hundred bytes. With symbols' labels, each labelled PC is preceded by its "M_LABEL(n),\n".
+ */
+esp_err_t hulp_disasm_range(const ulp_insn_t* program, size_t num_words, uint16_t start, size_t count,
+    const hulp_disasm_symbols_t* symbols, hulp_disasm_sink_t sink, void* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_DISASM_H */
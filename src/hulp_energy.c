@@ -0,0 +1,125 @@
+#include "hulp_energy.h"
+
+#include <stdio.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "HULP-ENERGY";
+
+static uint32_t hulp_energy_cycles_to_us(uint32_t cycles, const hulp_energy_config_t* config)
+{
+    return hulp_timing_cycles_to_us(cycles, config->fast_clk_hz);
+}
+
+/**
+ * Fill one case (best or worst) of the estimate.
+ */
+static float hulp_energy_fill(const hulp_energy_config_t* config, const hulp_energy_estimate_t* estimate, uint32_t awake_us, uint32_t adc_us, uint32_t hall_us, float* ua)
+{
+    const hulp_energy_model_t* model = &config->model;
+    // The wakeup period starts when the ULP halts
+    float cycle_us = (float)config->period_us + awake_us;
+
+    ua[HULP_ENERGY_SLEEP] = model->sleep_ua;
+    ua[HULP_ENERGY_ULP] = model->ulp_ua * awake_us / cycle_us;
+    ua[HULP_ENERGY_RTC_PERIPH] = config->rtc_periph_on ? model->rtc_periph_ua : 0;
+    ua[HULP_ENERGY_ADC] = (config->adc_on || estimate->adc_left_on) ? model->adc_ua : model->adc_ua * adc_us / cycle_us;
+    ua[HULP_ENERGY_HALL] = estimate->hall_left_on ? model->hall_ua : model->hall_ua * hall_us / cycle_us;
+    ua[HULP_ENERGY_TOUCH] = config->touch_on ? model->touch_ua : 0;
+
+    float total = 0;
+    for(int i = 0; i < HULP_ENERGY_MAX; ++i)
+    {
+        total += ua[i];
+    }
+    return total;
+}
+
+esp_err_t hulp_energy_estimate(const ulp_insn_t* program, size_t num_words, uint16_t entry_pc, const hulp_energy_config_t* config, hulp_energy_estimate_t* estimate)
+{
+    const hulp_energy_config_t default_config = HULP_ENERGY_CONFIG_DEFAULT();
+    if(!config)
+    {
+        config = &default_config;
+    }
+    if(!estimate || config->fast_clk_hz == 0)
+    {
+        ESP_LOGE(TAG, "[%s] invalid arg", __func__);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    hulp_timing_t timing;
+    esp_err_t err = hulp_timing_analyse(program, num_words, entry_pc, &config->timing, &timing);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+
+    estimate->bounded = timing.bounded;
+    estimate->adc_left_on = timing.adc_left_on;
+    estimate->hall_left_on = timing.hall_left_on;
+    estimate->best_awake_us = hulp_energy_cycles_to_us(timing.best_cycles, config) + config->model.wake_overhead_us;
+    estimate->worst_awake_us = hulp_energy_cycles_to_us(timing.worst_cycles, config) + config->model.wake_overhead_us;
+    estimate->best_total_ua = hulp_energy_fill(config, estimate, estimate->best_awake_us,
+        hulp_energy_cycles_to_us(timing.best_adc_cycles, config), hulp_energy_cycles_to_us(timing.best_hall_cycles, config), estimate->best_ua);
+    estimate->worst_total_ua = hulp_energy_fill(config, estimate, estimate->worst_awake_us,
+        hulp_energy_cycles_to_us(timing.worst_adc_cycles, config), hulp_energy_cycles_to_us(timing.worst_hall_cycles, config), estimate->worst_ua);
+
+    if(!timing.bounded)
+    {
+        ESP_LOGW(TAG, "[%s] execution time unbounded (pc %u), worst case is an underestimate", __func__, timing.unbounded_pc);
+    }
+    if(timing.adc_left_on)
+    {
+        ESP_LOGW(TAG, "[%s] SAR ADC may be left powered in sleep", __func__);
+    }
+    if(timing.hall_left_on)
+    {
+        ESP_LOGW(TAG, "[%s] hall sensor may be left connected in sleep", __func__);
+    }
+    return ESP_OK;
+}
+
+float hulp_energy_battery_hours(float average_ua, float capacity_mah)
+{
+    return (average_ua > 0) ? (capacity_mah * 1000.0f / average_ua) : 0;
+}
+
+const char* hulp_energy_section_name(hulp_energy_section_t section)
+{
+    switch(section)
+    {
+        case HULP_ENERGY_SLEEP:
+            return "sleep";
+        case HULP_ENERGY_ULP:
+            return "ulp";
+        case HULP_ENERGY_RTC_PERIPH:
+            return "rtc_periph";
+        case HULP_ENERGY_ADC:
+            return "adc";
+        case HULP_ENERGY_HALL:
+            return "hall";
+        case HULP_ENERGY_TOUCH:
+            return "touch";
+        default:
+            return "?";
+    }
+}
+
+void hulp_energy_print(const hulp_energy_estimate_t* estimate, float capacity_mah)
+{
+    printf("awake per wakeup: %u - %u%s us\n", (unsigned)estimate->best_awake_us, (unsigned)estimate->worst_awake_us, estimate->bounded ? "" : "+");
+    for(int i = 0; i < HULP_ENERGY_MAX; ++i)
+    {
+        if(estimate->worst_ua[i] > 0)
+        {
+            printf("  %-10s %10.2f - %.2f uA\n", hulp_energy_section_name((hulp_energy_section_t)i), estimate->best_ua[i], estimate->worst_ua[i]);
+        }
+    }
+    printf("  %-10s %10.2f - %.2f%s uA\n", "total", estimate->best_total_ua, estimate->worst_total_ua, estimate->bounded ? "" : "+");
+    if(capacity_mah > 0)
+    {
+        printf("battery life (%.0f mAh): %.0f - %.0f h\n", capacity_mah,
+            hulp_energy_battery_hours(estimate->worst_total_ua, capacity_mah), hulp_energy_battery_hours(estimate->best_total_ua, capacity_mah));
+    }
+}
@@ -0,0 +1,111 @@
+#ifndef HULP_ENERGY_H
+#define HULP_ENERGY_H
+
+#include "hulp_timing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Estimate the average current of a ULP program running periodically in deep sleep, from its execution time
+ * (see hulp_timing.h), wakeup period and power domains.
+ * Intended for comparing programs, wakeup periods and configurations before measuring on hardware.
+ */
+
+/**
+ * Supply current of each contributor (in uA).
+ * Defaults are approximations (from the ESP32 datasheet where available); measure your board for better estimates.
+ */
+typedef struct {
+    float sleep_ua;             /*!< Deep sleep with the RTC timer and RTC slow memory powered */
+    float ulp_ua;               /*!< Additional while the ULP is running (including RTC_FAST_CLK) */
+    float rtc_periph_ua;        /*!< Additional while RTC_PERIPH is powered in sleep (eg. hulp_peripherals_on) */
+    float adc_ua;               /*!< Additional while the SAR ADC is powered */
+    float hall_ua;              /*!< Additional while the hall sensor is connected */
+    float touch_ua;             /*!< Additional (average) while the touch sensor FSM measures in sleep */
+    uint32_t wake_overhead_us;  /*!< Time the ULP is powered each wakeup besides executing instructions (eg. RTC_FAST_CLK startup) */
+} hulp_energy_model_t;
+
+#define HULP_ENERGY_MODEL_DEFAULT() {   \
+        .sleep_ua = 10.0f,              \
+        .ulp_ua = 140.0f,               \
+        .rtc_periph_ua = 50.0f,         \
+        .adc_ua = 1000.0f,              \
+        .hall_ua = 500.0f,              \
+        .touch_ua = 40.0f,              \
+        .wake_overhead_us = 10          \
+    }
+
+typedef struct {
+    uint32_t period_us;         /*!< Wakeup period, as passed to hulp_ulp_load */
+    uint32_t fast_clk_hz;       /*!< RTC_FAST_CLK frequency, eg. hulp_get_fast_clk_freq() */
+    bool rtc_periph_on;         /*!< RTC_PERIPH is forced on in sleep (eg. hulp_peripherals_on) */
+    bool adc_on;                /*!< SAR ADC is forced on outside of the program (eg. hulp_tsens_configure) */
+    bool touch_on;              /*!< Touch sensor FSM is measuring in sleep */
+    hulp_energy_model_t model;
+    hulp_timing_config_t timing;
+} hulp_energy_config_t;
+
+#define HULP_ENERGY_CONFIG_DEFAULT() {              \
+        .period_us = 100000,                        \
+        .fast_clk_hz = 8500000,                     \
+        .rtc_periph_on = false,                     \
+        .adc_on = false,                            \
+        .touch_on = false,                          \
+        .model = HULP_ENERGY_MODEL_DEFAULT(),       \
+        .timing = HULP_TIMING_CONFIG_DEFAULT()      \
+    }
+
+typedef enum {
+    HULP_ENERGY_SLEEP,          /*!< Baseline deep sleep */
+    HULP_ENERGY_ULP,            /*!< ULP running */
+    HULP_ENERGY_RTC_PERIPH,     /*!< RTC_PERIPH forced on */
+    HULP_ENERGY_ADC,            /*!< SAR ADC powered */
+    HULP_ENERGY_HALL,           /*!< Hall sensor connected */
+    HULP_ENERGY_TOUCH,          /*!< Touch sensor FSM */
+    HULP_ENERGY_MAX,
+} hulp_energy_section_t;
+
+typedef struct {
+    float best_ua[HULP_ENERGY_MAX];     /*!< Contribution of each section to the average current, if the shortest paths are taken */
+    float worst_ua[HULP_ENERGY_MAX];    /*!< Contribution of each section to the average current, if the longest paths are taken */
+    float best_total_ua;                /*!< Average current, best case */
+    float worst_total_ua;               /*!< Average current, worst case */
+    uint32_t best_awake_us;             /*!< Time the ULP is running each wakeup, best case */
+    uint32_t worst_awake_us;            /*!< Time the ULP is running each wakeup, worst case */
+    bool bounded;                       /*!< As per hulp_timing_t. If false, the worst case is an underestimate. */
+    bool adc_left_on;                   /*!< As per hulp_timing_t. The ADC is then assumed to be powered for the whole period. */
+    bool hall_left_on;                  /*!< As per hulp_timing_t. The hall sensor is then assumed to be connected for the whole period. */
+} hulp_energy_estimate_t;
+
+/**
+ * Estimate the average current of a program, run from entry_pc every config->period_us.
+ *
+ * program: processed program (no macros), eg. from hulp_process_macros
+ * num_words: number of instructions in program
+ * config: NULL for HULP_ENERGY_CONFIG_DEFAULT()
+ */
+esp_err_t hulp_energy_estimate(const ulp_insn_t* program, size_t num_words, uint16_t entry_pc, const hulp_energy_config_t* config, hulp_energy_estimate_t* estimate);
+
+/**
+ * Battery life (in hours) at an average current, eg. hulp_energy_estimate_t.worst_total_ua
+ */
+float hulp_energy_battery_hours(float average_ua, float capacity_mah);
+
+/**
+ * Get the name of a section, eg. for printing.
+ */
+const char* hulp_energy_section_name(hulp_energy_section_t section);
+
+/**
+ * Print an estimate (via printf) with a breakdown of each section.
+ * capacity_mah: battery capacity for battery life, or 0 to omit
+ */
+void hulp_energy_print(const hulp_energy_estimate_t* estimate, float capacity_mah);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_ENERGY_H */
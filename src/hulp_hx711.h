@@ -10,6 +10,18 @@
     I_GPIO_READ(gpio_data), \
     I_BGE(-1, 1)
 
+/**
+ * As M_HX711_WAIT_READY, but sleep between polls rather than busy waiting. R0-R3 as per M_SLEEP_CONT.
+ *
+ * poll_period: Index of the wakeup period between polls
+ * wake_period: Index of the normal wakeup period
+ */
+#define M_HX711_SLEEP_UNTIL_READY(label_resume, label_entry, ctx, gpio_data, poll_period, wake_period) \
+    I_GPIO_READ(gpio_data), \
+    I_BL(17, 1), \
+    M_SLEEP_CONT(label_resume, label_entry, ctx, poll_period, wake_period), \
+    I_BGE(-17, 0)
+
 /**
  * Read 24-bit value from a HX711
  *
@@ -18,7 +18,14 @@
 
 #define SOC_REG_TO_ULP_PERIPH_SEL(reg) (uint32_t)(((reg) - DR_REG_RTCCNTL_BASE) / 0x400)
 
-static const int s_hulp_rtc_io_num_map[SOC_GPIO_PIN_COUNT] = {
+// constexpr in C++ so that GPIO macros can be used in compile-time programs (hulp_asm.hpp)
+#ifdef __cplusplus
+    #define HULP_OPT_TABLE constexpr
+#else
+    #define HULP_OPT_TABLE const
+#endif
+
+static HULP_OPT_TABLE int s_hulp_rtc_io_num_map[SOC_GPIO_PIN_COUNT] = {
     RTCIO_GPIO0_CHANNEL,    //GPIO0
     -1,//GPIO1
     RTCIO_GPIO2_CHANNEL,    //GPIO2
@@ -66,7 +73,7 @@ static const int s_hulp_rtc_io_num_map[SOC_GPIO_PIN_COUNT] = {
 #define RTC_WORD_OFFSET(x) ((uint16_t)((uint32_t*)(&(x)) - RTC_SLOW_MEM))
 
 // See rtc_io_desc
-static const rtc_io_desc_t s_hulp_rtc_io_desc[SOC_RTCIO_PIN_COUNT] = {
+static HULP_OPT_TABLE rtc_io_desc_t s_hulp_rtc_io_desc[SOC_RTCIO_PIN_COUNT] = {
     /*REG                    MUX select                  function select              Input enable                Pullup                   Pulldown                 Sleep select                 Sleep input enable             PAD hold                  Pad force hold                    Mask of drive capability Offset                   gpio number */
     {RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE1_MUX_SEL_M,    RTC_IO_SENSE1_FUN_SEL_S,     RTC_IO_SENSE1_FUN_IE_M,     0,                       0,                       RTC_IO_SENSE1_SLP_SEL_M,     RTC_IO_SENSE1_SLP_IE_M,     0, RTC_IO_SENSE1_HOLD_M,     RTC_CNTL_SENSE1_HOLD_FORCE_M,     0,                       0,                       RTCIO_CHANNEL_0_GPIO_NUM}, //36
     {RTC_IO_SENSOR_PADS_REG, RTC_IO_SENSE2_MUX_SEL_M,    RTC_IO_SENSE2_FUN_SEL_S,     RTC_IO_SENSE2_FUN_IE_M,     0,                       0,                       RTC_IO_SENSE2_SLP_SEL_M,     RTC_IO_SENSE2_SLP_IE_M,     0, RTC_IO_SENSE2_HOLD_M,     RTC_CNTL_SENSE2_HOLD_FORCE_M,     0,                       0,                       RTCIO_CHANNEL_1_GPIO_NUM}, //37
@@ -605,17 +605,64 @@
 
 /**
  * Set the entry point to the given label. Next time the ULP runs, it will begin from that point.
+ * program_ptr is the program array containing the label, which is searched when the array is initialised.
+ * See M_SET_ENTRY_LABEL, which is resolved when loaded instead.
  */
 #define M_SET_ENTRY_LBL(label_entry, program_ptr) \
     M_SET_ENTRY((uint16_t)hulp_get_label_pc(label_entry, program_ptr))
 
 /**
  * Set the entry point to some offset from this PC
+ * See M_SET_ENTRY_OFFSET, which is resolved when loaded instead.
  */
 #define M_SET_ENTRY_O(label_temp, program_ptr, offset) \
     M_LABEL(label_temp), \
     M_SET_ENTRY((uint16_t)hulp_get_label_pc(label_temp, program_ptr) + 2 + (offset))
 
+/**
+ * Macro sub-opcode used by HULP to resolve an entry point from a label at load time.
+ * Not understood by ulp_process_macros_and_load; programs using it must be loaded with hulp_ulp_load.
+ */
+#define HULP_SUB_OPCODE_MACRO_ENTRYPC 8
+
+/**
+ * Largest pc_offset of M_ENTRYPC, which is stored in 8 bits.
+ */
+#define HULP_ENTRYPC_MAX_OFFSET 255
+
+/**
+ * pc_offset, or a compile error if it is a constant outside of 0 to HULP_ENTRYPC_MAX_OFFSET.
+ */
+#define HULP_ENTRYPC_OFFSET(pc_offset) \
+    ((pc_offset) + 0 * sizeof(char[((pc_offset) >= 0 && (pc_offset) <= HULP_ENTRYPC_MAX_OFFSET) ? 1 : -1]))
+
+/**
+ * Pseudo-instruction: the M_SET_ENTRY that follows is patched with the PC of label_num, plus pc_offset (0-255), when loaded.
+ */
+#define M_ENTRYPC(label_num, pc_offset) { .macro = { \
+    .label = (label_num), \
+    .unused = HULP_ENTRYPC_OFFSET(pc_offset), \
+    .sub_opcode = HULP_SUB_OPCODE_MACRO_ENTRYPC, \
+    .opcode = OPCODE_MACRO } }
+
+/**
+ * Set the entry point to the given label. Next time the ULP runs, it will begin from that point.
+ * Unlike M_SET_ENTRY_LBL, the label is resolved when the program is loaded, so the program is not searched while
+ * it is being initialised. The program must be loaded with hulp_ulp_load (not ulp_process_macros_and_load).
+ */
+#define M_SET_ENTRY_LABEL(label_entry) \
+    M_ENTRYPC(label_entry, 0), \
+    M_SET_ENTRY(0)
+
+/**
+ * Set the entry point to some offset (0-253) from this PC
+ * As with M_SET_ENTRY_LABEL, the program must be loaded with hulp_ulp_load.
+ */
+#define M_SET_ENTRY_OFFSET(label_temp, offset) \
+    M_LABEL(label_temp), \
+    M_ENTRYPC(label_temp, 2 + (offset)), \
+    M_SET_ENTRY(0)
+
 /**
  * Get interrupt triggered bits for RTCIO
  */
@@ -707,21 +754,25 @@
 
 /**
  * Delay for 1-10 microseconds
+ *  Note: Outside this range, I_DELAY overflows. See hulp_delay_generate (hulp_delay.h) for any delay.
  */
 #define M_DELAY_US_1_10(delay_us) I_DELAY(((hulp_get_fast_clk_freq() * (delay_us)) / 1000000) + 1 - 6)
 
 /**
  * Delay for 10-100 microseconds
+ *  Note: Outside this range, I_DELAY overflows. See hulp_delay_generate (hulp_delay.h) for any delay.
  */
 #define M_DELAY_US_10_100(delay_us) I_DELAY(((hulp_get_fast_clk_freq() * (delay_us)) / 1000000) - 6)
 
 /**
  * Delay for 100-5000 microseconds
+ *  Note: Outside this range, I_DELAY overflows. See hulp_delay_generate (hulp_delay.h) for any delay.
  */
 #define M_DELAY_US_100_5000(delay_us) I_DELAY((((hulp_get_fast_clk_freq() / 1000) * (delay_us)) / 1000) - 6)
 
 /**
  * Delay for 5000-20000 microseconds
+ *  Note: Outside this range, I_DELAY overflows. See hulp_delay_generate (hulp_delay.h) for any delay.
  */
 #define M_DELAY_US_5000_20000(delay_us) \
     I_DELAY(((hulp_get_fast_clk_freq() / 1000) * (delay_us) / 1000) / 3 - 6), \
@@ -731,6 +782,7 @@
 /**
  * Delay for 20-1000 milliseconds
  *  Note: Uses stage counter
+ *  Note: Outside this range, I_DELAY overflows. See hulp_delay_generate (hulp_delay.h) for any delay.
  */
 #define M_DELAY_MS_20_1000(delay_ms) \
     I_STAGE_RST(), \
@@ -741,6 +793,7 @@
 /**
  * Delay for 20-60000 milliseconds
  *  Note: Uses R0
+ *  Note: Outside this range, I_DELAY overflows. See hulp_delay_generate (hulp_delay.h) for any delay.
  */
 #define M_DELAY_MS_20_60000(delay_ms) \
     I_MOVI(R0, 0), \
@@ -751,6 +804,7 @@
 /**
  * Delay for 1-400 seconds
  *  Note: Uses R0
+ *  Note: Outside this range, I_DELAY overflows. See hulp_delay_generate (hulp_delay.h) for any delay.
  */
 #define M_DELAY_S_1_400(delay_s) \
     I_MOVI(R0, 0), \
@@ -759,16 +813,16 @@
     I_BL(-2, 60000)
 
 
-#define MIN_ULP_SLEEP_US (rtc_time_slowclk_to_us(ULP_FSM_PREPARE_SLEEP_CYCLES + ULP_FSM_WAKEUP_SLEEP_CYCLES + REG_GET_FIELD(RTC_CNTL_TIMER2_REG, RTC_CNTL_ULPCP_TOUCH_START_WAIT), esp_clk_slowclk_cal_get()))
+#define MIN_ULP_SLEEP_US (rtc_time_slowclk_to_us(ULP_FSM_PREPARE_SLEEP_CYCLES + ULP_FSM_WAKEUP_SLEEP_CYCLES + REG_GET_FIELD(RTC_CNTL_TIMER2_REG, RTC_CNTL_ULPCP_TOUCH_START_WAIT), hulp_get_slow_clk_cal()))
 
 /**
  * Do not use this directly, use M_SET_WAKEUP_PERIOD for more accurate timing.
  */
 #define M_SET_WAKEUP_PERIOD_REG(index, period_us)   \
-    I_WR_REG((uint32_t)(SENS_ULP_CP_SLEEP_CYC0_REG + (index) * sizeof(uint32_t)), 0, 7, (uint8_t)((rtc_time_us_to_slowclk((period_us), esp_clk_slowclk_cal_get()) >> 0) & 0xFF)), \
-    I_WR_REG((uint32_t)(SENS_ULP_CP_SLEEP_CYC0_REG + (index) * sizeof(uint32_t)), 8, 15, (uint8_t)((rtc_time_us_to_slowclk((period_us), esp_clk_slowclk_cal_get()) >> 8) & 0xFF)), \
-    I_WR_REG((uint32_t)(SENS_ULP_CP_SLEEP_CYC0_REG + (index) * sizeof(uint32_t)), 16, 23, (uint8_t)((rtc_time_us_to_slowclk((period_us), esp_clk_slowclk_cal_get()) >> 16) & 0xFF)), \
-    I_WR_REG((uint32_t)(SENS_ULP_CP_SLEEP_CYC0_REG + (index) * sizeof(uint32_t)), 24, 31, (uint8_t)((rtc_time_us_to_slowclk((period_us), esp_clk_slowclk_cal_get()) >> 24) & 0xFF))
+    I_WR_REG((uint32_t)(SENS_ULP_CP_SLEEP_CYC0_REG + (index) * sizeof(uint32_t)), 0, 7, (uint8_t)((rtc_time_us_to_slowclk((period_us), hulp_get_slow_clk_cal()) >> 0) & 0xFF)), \
+    I_WR_REG((uint32_t)(SENS_ULP_CP_SLEEP_CYC0_REG + (index) * sizeof(uint32_t)), 8, 15, (uint8_t)((rtc_time_us_to_slowclk((period_us), hulp_get_slow_clk_cal()) >> 8) & 0xFF)), \
+    I_WR_REG((uint32_t)(SENS_ULP_CP_SLEEP_CYC0_REG + (index) * sizeof(uint32_t)), 16, 23, (uint8_t)((rtc_time_us_to_slowclk((period_us), hulp_get_slow_clk_cal()) >> 16) & 0xFF)), \
+    I_WR_REG((uint32_t)(SENS_ULP_CP_SLEEP_CYC0_REG + (index) * sizeof(uint32_t)), 24, 31, (uint8_t)((rtc_time_us_to_slowclk((period_us), hulp_get_slow_clk_cal()) >> 24) & 0xFF))
 
 /**
  * Set the ULP wakeup period in microseconds (equivalent to ulp_set_wakeup_period).
@@ -776,6 +830,100 @@
 #define M_SET_WAKEUP_PERIOD(index, period_us)   \
     M_SET_WAKEUP_PERIOD_REG((index), (period_us) > (MIN_ULP_SLEEP_US) ? ((period_us) - MIN_ULP_SLEEP_US) : 0)
 
+/**
+ * Adaptive wakeup period, using a ladder of periods set with hulp_set_wake_periods (fastest first).
+ *   Example program flow:
+ *      //Check button into R0
+ *      I_BL(5, 1),
+ *          M_WAKE_PERIOD_ACTIVE(ulp_idle_wakes),    //Pressed: wake at period 0
+ *          M_BX(LBL_HANDLE_PRESS),
+ *      M_WAKE_PERIOD_IDLE(ulp_idle_wakes, 10, 3),   //Not pressed: after 10 idle wakes, period 1, then after 10 more, period 2
+ *      I_HALT(),
+ *
+ * idle_var: ulp_var_t counting idle wakes (initially 0)
+ */
+#define M_WAKE_PERIOD_ACTIVE(idle_var) \
+    M_WAKE_PERIOD_ACTIVE_(idle_var, R0)
+
+#define M_WAKE_PERIOD_ACTIVE_(idle_var, reg_scr) \
+    I_MOVI(reg_scr, 0), \
+    I_ST(reg_scr, reg_scr, RTC_WORD_OFFSET(idle_var)), \
+    I_SLEEP_CYCLE_SEL(0)
+
+/**
+ * Idle wakes at which M_WAKE_PERIOD_IDLE steps to period. Beyond num_periods, this is never reached.
+ */
+#define HULP_WAKE_PERIOD_IDLE_WAKES(period, idle_wakes, num_periods) \
+    (((period) < (num_periods)) ? (period) * (idle_wakes) : 0xFFFF)
+
+/**
+ * Count an idle wake, stepping to the next (slower) wakeup period every idle_wakes, up to period num_periods - 1.
+ * Once at the slowest period, this is only three instructions.
+ *  Note: Uses R0. (num_periods - 1) * idle_wakes must be less than 65535.
+ *
+ * idle_var: ulp_var_t counting idle wakes, reset by M_WAKE_PERIOD_ACTIVE
+ * idle_wakes: Number of idle wakes at each period before stepping to the next
+ * num_periods: Number of periods set by hulp_set_wake_periods (1-5)
+ */
+#define M_WAKE_PERIOD_IDLE(idle_var, idle_wakes, num_periods) \
+    M_WAKE_PERIOD_IDLE_(idle_var, idle_wakes, num_periods, R2)
+
+#define M_WAKE_PERIOD_IDLE_(idle_var, idle_wakes, num_periods, reg_scr) \
+    I_MOVI(reg_scr, 0), \
+    I_LD(R0, reg_scr, RTC_WORD_OFFSET(idle_var)), \
+    I_BGE(14, ((num_periods) - 1) * (idle_wakes)),    /*Already at the slowest period*/ \
+    I_ADDI(R0, R0, 1), \
+    I_ST(R0, reg_scr, RTC_WORD_OFFSET(idle_var)), \
+    I_BL(3, HULP_WAKE_PERIOD_IDLE_WAKES(4, idle_wakes, num_periods)),  /*Select the period for the number of idle wakes*/ \
+    I_SLEEP_CYCLE_SEL(4), \
+    I_BGE(9, 0), \
+    I_BL(3, HULP_WAKE_PERIOD_IDLE_WAKES(3, idle_wakes, num_periods)), \
+    I_SLEEP_CYCLE_SEL(3), \
+    I_BGE(6, 0), \
+    I_BL(3, HULP_WAKE_PERIOD_IDLE_WAKES(2, idle_wakes, num_periods)), \
+    I_SLEEP_CYCLE_SEL(2), \
+    I_BGE(3, 0), \
+    I_BL(2, (idle_wakes)), \
+    I_SLEEP_CYCLE_SEL(1)
+
+/**
+ * Number of ulp_var_t needed for M_SLEEP_CONT's ctx.
+ */
+#define HULP_SLEEP_CONT_WORDS 3
+
+/**
+ * Sleep instead of busy waiting: halt until the next wake, which continues from here rather than from the entry point.
+ * The continuation wake then restores the normal entry point and wakeup period. For long waits, this costs sleep
+ * current rather than active current.
+ *  Note: R1-R3 are saved in ctx and restored; R0 is not. The program must be loaded with hulp_ulp_load, and the
+ *  periods set with hulp_set_wake_periods (rather than written by the program). 15 instructions.
+ *  Example (replacing M_DELAY_US_5000_20000(13000)):
+ *      hulp_set_wake_periods((uint32_t[]){10000000, 13000}, 2);
+ *      ...
+ *      M_SLEEP_CONT(LBL_MEASURE_RESUME, LBL_ENTRY, ulp_sleep_ctx, 1, 0),
+ *
+ * label_resume: Label at which the program continues (unique to each use)
+ * label_entry: Label at the normal entry point of the program
+ * ctx: ulp_var_t[HULP_SLEEP_CONT_WORDS]
+ * sleep_period: Index (0-4) of the (short) wakeup period to sleep for
+ * wake_period: Index (0-4) of the normal wakeup period
+ */
+#define M_SLEEP_CONT(label_resume, label_entry, ctx, sleep_period, wake_period) \
+    I_MOVI(R0, 0), \
+    I_ST(R1, R0, RTC_WORD_OFFSET((ctx)[0])), \
+    I_ST(R2, R0, RTC_WORD_OFFSET((ctx)[1])), \
+    I_ST(R3, R0, RTC_WORD_OFFSET((ctx)[2])), \
+    M_SET_ENTRY_LABEL(label_resume), \
+    I_SLEEP_CYCLE_SEL(sleep_period), \
+    I_HALT(), \
+    M_LABEL(label_resume), \
+    M_SET_ENTRY_LABEL(label_entry), \
+    I_SLEEP_CYCLE_SEL(wake_period), \
+    I_MOVI(R0, 0), \
+    I_LD(R1, R0, RTC_WORD_OFFSET((ctx)[0])), \
+    I_LD(R2, R0, RTC_WORD_OFFSET((ctx)[1])), \
+    I_LD(R3, R0, RTC_WORD_OFFSET((ctx)[2]))
+
 /**
  * Increment the value in a register
  */
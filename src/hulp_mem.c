@@ -0,0 +1,229 @@
+#include "hulp_mem.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "soc/soc_memory_layout.h"
+
+#include "hulp.h"
+#include "hulp_regwr.h"
+
+#include "hulp_config.h"
+
+static const char* TAG = "HULP-MEM";
+
+#define HULP_MEM_TOTAL_WORDS ((SOC_RTC_DATA_HIGH - SOC_RTC_DATA_LOW) / sizeof(uint32_t))
+#define HULP_MEM_RESERVED_WORDS (HULP_ULP_RESERVE_MEM / sizeof(uint32_t))
+
+// Owner of each word in the map
+#define HULP_MEM_FREE 0
+#define HULP_MEM_PROGRAM 1
+#define HULP_MEM_REGWR 2
+#define HULP_MEM_REGION(i) (3 + (i))
+#define HULP_MEM_MAX_REGIONS (UINT8_MAX - HULP_MEM_REGION(0))
+
+static const char* hulp_mem_owner_name(const hulp_mem_plan_t* plan, uint8_t owner)
+{
+    switch(owner)
+    {
+        case HULP_MEM_FREE:
+            return "free";
+        case HULP_MEM_PROGRAM:
+            return "program";
+        case HULP_MEM_REGWR:
+            return "hulp_regwr";
+        default:
+            return plan->regions[owner - HULP_MEM_REGION(0)].name ? plan->regions[owner - HULP_MEM_REGION(0)].name : "(region)";
+    }
+}
+
+static esp_err_t hulp_mem_claim(const hulp_mem_plan_t* plan, uint8_t* map, size_t offset, size_t size, size_t limit, uint8_t owner)
+{
+    if(offset + size > limit)
+    {
+        ESP_LOGE(TAG, "[%s] %s [%u, %u) exceeds %s (%u words)", __func__, hulp_mem_owner_name(plan, owner),
+            (unsigned)offset, (unsigned)(offset + size), (limit == HULP_MEM_RESERVED_WORDS) ? "ULP reserved memory" : "RTC slow memory", (unsigned)limit);
+        return ESP_ERR_NO_MEM;
+    }
+    for(size_t i = offset; i < offset + size; ++i)
+    {
+        if(map[i] != HULP_MEM_FREE && map[i] != owner)
+        {
+            ESP_LOGE(TAG, "[%s] %s collides with %s at word %u", __func__, hulp_mem_owner_name(plan, owner), hulp_mem_owner_name(plan, map[i]), (unsigned)i);
+            return ESP_ERR_INVALID_STATE;
+        }
+        map[i] = owner;
+    }
+    return ESP_OK;
+}
+
+static int32_t hulp_mem_find_free(const uint8_t* map, size_t size)
+{
+    size_t run = 0;
+    for(size_t i = 0; i < HULP_MEM_RESERVED_WORDS; ++i)
+    {
+        run = (map[i] == HULP_MEM_FREE) ? run + 1 : 0;
+        if(run == size)
+        {
+            return i + 1 - size;
+        }
+    }
+    return HULP_MEM_ANYWHERE;
+}
+
+/**
+ * Fill the map with fixed areas, then (if place) place the rest.
+ */
+static esp_err_t hulp_mem_fill_map(hulp_mem_plan_t* plan, uint8_t* map, bool place)
+{
+    esp_err_t err = ESP_OK;
+
+    for(size_t i = 0; i < plan->num_regwr_ranges && err == ESP_OK; ++i)
+    {
+        const hulp_mem_regwr_range_t* range = &plan->regwr_ranges[i];
+        if(range->low % 8 != 0 || range->high < range->low || range->high > 31)
+        {
+            ESP_LOGE(TAG, "[%s] invalid regwr range [%u:%u]", __func__, range->high, range->low);
+            return ESP_ERR_INVALID_ARG;
+        }
+        // All work areas have the same owner, so check them against each other here
+        const uint32_t offset = HULP_REGWR_WORK_OFFSET(range->low, range->high);
+        for(size_t j = 0; j < i; ++j)
+        {
+            const hulp_mem_regwr_range_t* other = &plan->regwr_ranges[j];
+            const uint32_t other_offset = HULP_REGWR_WORK_OFFSET(other->low, other->high);
+            if((other->low != range->low || other->high != range->high) &&
+                offset < other_offset + HULP_REGWR_WORK_COUNT && other_offset < offset + HULP_REGWR_WORK_COUNT)
+            {
+                ESP_LOGE(TAG, "[%s] regwr range [%u:%u] work area collides with [%u:%u]", __func__, range->high, range->low, other->high, other->low);
+                return ESP_ERR_INVALID_STATE;
+            }
+        }
+        err = hulp_mem_claim(plan, map, offset, HULP_REGWR_WORK_COUNT, HULP_MEM_RESERVED_WORDS, HULP_MEM_REGWR);
+    }
+    if(plan->num_regwr_ranges > 0 && err == ESP_OK)
+    {
+        err = hulp_mem_claim(plan, map, HULP_WR_REG_GEN_ENTRY_HAS_RET, HULP_WR_REG_GEN_ENTRY_HAS_RET_COUNT, HULP_MEM_RESERVED_WORDS, HULP_MEM_REGWR);
+    }
+    if(plan->num_regwr_ranges > 0 && plan->regwr_gen == HULP_MEM_REGWR_GEN_ENTRY && err == ESP_OK)
+    {
+        err = hulp_mem_claim(plan, map, HULP_WR_REG_GEN_ENTRY, HULP_WR_REG_GEN_ENTRY_COUNT, HULP_MEM_RESERVED_WORDS, HULP_MEM_REGWR);
+    }
+
+    for(size_t i = 0; i < plan->num_regions && err == ESP_OK; ++i)
+    {
+        if(plan->regions[i].offset != HULP_MEM_ANYWHERE)
+        {
+            err = hulp_mem_claim(plan, map, plan->regions[i].offset, plan->regions[i].size, HULP_MEM_TOTAL_WORDS, HULP_MEM_REGION(i));
+        }
+    }
+
+    if(plan->program_offset != HULP_MEM_ANYWHERE && err == ESP_OK)
+    {
+        err = hulp_mem_claim(plan, map, plan->program_offset, plan->program_words, HULP_MEM_RESERVED_WORDS, HULP_MEM_PROGRAM);
+    }
+
+    if(!place || err != ESP_OK)
+    {
+        return err;
+    }
+
+    if(plan->program_offset == HULP_MEM_ANYWHERE)
+    {
+        plan->program_offset = hulp_mem_find_free(map, plan->program_words);
+        if(plan->program_offset == HULP_MEM_ANYWHERE)
+        {
+            ESP_LOGE(TAG, "[%s] no space for program (%u words)", __func__, (unsigned)plan->program_words);
+            return ESP_ERR_NO_MEM;
+        }
+        hulp_mem_claim(plan, map, plan->program_offset, plan->program_words, HULP_MEM_RESERVED_WORDS, HULP_MEM_PROGRAM);
+    }
+
+    for(size_t i = 0; i < plan->num_regions; ++i)
+    {
+        if(plan->regions[i].offset == HULP_MEM_ANYWHERE)
+        {
+            plan->regions[i].offset = hulp_mem_find_free(map, plan->regions[i].size);
+            if(plan->regions[i].offset == HULP_MEM_ANYWHERE)
+            {
+                ESP_LOGE(TAG, "[%s] no space for %s (%u words)", __func__, hulp_mem_owner_name(plan, HULP_MEM_REGION(i)), plan->regions[i].size);
+                return ESP_ERR_NO_MEM;
+            }
+            hulp_mem_claim(plan, map, plan->regions[i].offset, plan->regions[i].size, HULP_MEM_RESERVED_WORDS, HULP_MEM_REGION(i));
+        }
+    }
+
+    return ESP_OK;
+}
+
+static uint8_t* hulp_mem_build_map(hulp_mem_plan_t* plan, bool place, esp_err_t* err)
+{
+    if(plan->num_regions > HULP_MEM_MAX_REGIONS)
+    {
+        *err = ESP_ERR_INVALID_ARG;
+        return NULL;
+    }
+    uint8_t* map = (uint8_t*)calloc(HULP_MEM_TOTAL_WORDS, sizeof(uint8_t));
+    if(!map)
+    {
+        *err = ESP_ERR_NO_MEM;
+        return NULL;
+    }
+    *err = hulp_mem_fill_map(plan, map, place);
+    return map;
+}
+
+esp_err_t hulp_mem_plan(hulp_mem_plan_t* plan)
+{
+    esp_err_t err;
+    uint8_t* map = hulp_mem_build_map(plan, true, &err);
+    if(map && err == ESP_OK)
+    {
+        plan->free_words = 0;
+        for(size_t i = 0; i < HULP_MEM_RESERVED_WORDS; ++i)
+        {
+            plan->free_words += (map[i] == HULP_MEM_FREE);
+        }
+    }
+    free(map);
+    return err;
+}
+
+void hulp_mem_print_map(const hulp_mem_plan_t* plan)
+{
+    // Everything has been placed, so this only checks (a copy, to leave the plan const)
+    hulp_mem_plan_t placed = *plan;
+    esp_err_t err;
+    uint8_t* map = hulp_mem_build_map(&placed, false, &err);
+    if(!map)
+    {
+        ESP_LOGE(TAG, "[%s] error 0x%x", __func__, err);
+        return;
+    }
+
+    printf("RTC slow memory (%u words, %u reserved for ULP):\n", (unsigned)HULP_MEM_TOTAL_WORDS, (unsigned)HULP_MEM_RESERVED_WORDS);
+    size_t start = 0;
+    for(size_t i = 1; i <= HULP_MEM_TOTAL_WORDS; ++i)
+    {
+        if(i == HULP_MEM_TOTAL_WORDS || i == HULP_MEM_RESERVED_WORDS || map[i] != map[start])
+        {
+            if(start == HULP_MEM_RESERVED_WORDS)
+            {
+                printf("  ---- end of ULP reserved memory ----\n");
+            }
+            if(start < HULP_MEM_RESERVED_WORDS || map[start] != HULP_MEM_FREE)
+            {
+                printf("  [%4u - %4u] %5u words  %s\n", (unsigned)start, (unsigned)(i - 1), (unsigned)(i - start), hulp_mem_owner_name(plan, map[start]));
+            }
+            start = i;
+        }
+    }
+    printf("  %u words free\n", (unsigned)plan->free_words);
+    if(err != ESP_OK)
+    {
+        printf("  (plan is invalid: 0x%x)\n", err);
+    }
+    free(map);
+}
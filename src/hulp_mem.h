@@ -0,0 +1,73 @@
+#ifndef HULP_MEM_H
+#define HULP_MEM_H
+
+#include "hulp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Offset for regions (and the program) to be placed by the planner.
+ */
+#define HULP_MEM_ANYWHERE (-1)
+
+typedef struct {
+    const char* name;   /*!< Name for the usage map */
+    int32_t offset;     /*!< In: fixed word offset in RTC_SLOW_MEM, or HULP_MEM_ANYWHERE; out: placed word offset */
+    uint16_t size;      /*!< Size in words */
+} hulp_mem_region_t;
+
+/**
+ * Region for an existing object in RTC slow memory (eg. RTC_DATA_ATTR ulp_debug_bp_data_t), to include it in checks and the usage map.
+ */
+#define HULP_MEM_REGION_VAR(name_, var_) { \
+        .name = (name_), \
+        .offset = RTC_WORD_OFFSET(var_), \
+        .size = (uint16_t)((sizeof(var_) + sizeof(uint32_t) - 1) / sizeof(uint32_t)) \
+    }
+
+typedef struct {
+    uint8_t low;        /*!< Low bit of register write range (0, 8, 16 or 24) */
+    uint8_t high;       /*!< High bit of register write range */
+} hulp_mem_regwr_range_t;
+
+typedef enum {
+    HULP_MEM_REGWR_GEN_HAS_RET,     /*!< Branching to HULP_WR_REG_GEN_ENTRY_HAS_RET (hulp_regwr_load_generate_wr) */
+    HULP_MEM_REGWR_GEN_ENTRY,       /*!< Branching to HULP_WR_REG_GEN_ENTRY (hulp_regwr_load_generate_ret, which also uses HULP_WR_REG_GEN_ENTRY_HAS_RET) */
+} hulp_mem_regwr_gen_t;
+
+typedef struct {
+    size_t program_words;                           /*!< Number of instructions in the program (after processing) */
+    int32_t program_offset;                         /*!< In: load address, or HULP_MEM_ANYWHERE; out: placed load address */
+    const hulp_mem_regwr_range_t* regwr_ranges;     /*!< hulp_regwr bit ranges in use (their work areas and generators are reserved) */
+    size_t num_regwr_ranges;
+    hulp_mem_regwr_gen_t regwr_gen;                 /*!< hulp_regwr generator entry used by the program (only reserved if there are regwr_ranges) */
+    hulp_mem_region_t* regions;                     /*!< Data regions */
+    size_t num_regions;
+    size_t free_words;                              /*!< Out: unused words in the ULP reserved area */
+} hulp_mem_plan_t;
+
+/**
+ * Lay out a program, hulp_regwr areas and data regions in RTC slow memory.
+ *
+ * hulp_regwr areas are fixed, and the work areas of different bit ranges must not overlap. Regions and the program with fixed offsets are checked against them and each other,
+ * then the rest are placed in the first free space that fits. Only the ULP reserved area (CONFIG_ESP32_ULP_COPROC_RESERVE_MEM)
+ * is used for placement; fixed regions beyond it (eg. RTC_DATA_ATTR variables) are checked only against each other.
+ *
+ * Note that a program loaded at an offset other than 0 must not contain absolute branches (eg. M_BX); see hulp_optimize_program.
+ *
+ * Returns ESP_ERR_INVALID_STATE on any collision, or ESP_ERR_NO_MEM if there is insufficient space.
+ */
+esp_err_t hulp_mem_plan(hulp_mem_plan_t* plan);
+
+/**
+ * Print (via printf) a map of RTC slow memory usage of a plan from hulp_mem_plan.
+ */
+void hulp_mem_print_map(const hulp_mem_plan_t* plan);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_MEM_H */
@@ -0,0 +1,788 @@
+#include "hulp_optimize.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "soc/rtc_io_reg.h"
+
+#include "hulp.h"
+#include "hulp_cfg.h"
+
+static const char* TAG = "HULP-OPT";
+
+#define HULP_OPT_MAX_BRANCH_OFFSET 127
+#define HULP_OPT_MAX_THREAD_HOPS 8
+
+enum {
+    HULP_OPT_BOUNDARY = 1 << 0,     // Start of a basic block (label, branch target or after a branch)
+    HULP_OPT_PINNED = 1 << 1,       // May not be removed (its position may be relied upon)
+    HULP_OPT_PATCHED = 1 << 2,      // Patched by a preceding macro when loaded
+    HULP_OPT_DELETE = 1 << 3,       // To be removed
+    HULP_OPT_ENTRY = 1 << 4,        // May be jumped to by address (eg. label offset in a register)
+};
+
+typedef struct {
+    ulp_insn_t* program;
+    size_t num_entries;
+    size_t num_words;
+    hulp_program_index_t index;
+    uint16_t* word_entry;   // Index in program of each instruction
+    uint8_t* flags;         // HULP_OPT_ flags of each instruction
+} hulp_opt_ctx_t;
+
+static inline bool hulp_opt_is_movi_zero(const ulp_insn_t* insn)
+{
+    return insn->alu_imm.opcode == OPCODE_ALU && insn->alu_imm.sub_opcode == SUB_OPCODE_ALU_IMM &&
+        insn->alu_imm.sel == ALU_SEL_MOV && insn->alu_imm.imm == 0;
+}
+
+static inline bool hulp_opt_sets_flags(const ulp_insn_t* insn)
+{
+    return insn->alu_reg.opcode == OPCODE_ALU && insn->alu_reg.sub_opcode != SUB_OPCODE_ALU_CNT;
+}
+
+static inline int32_t hulp_opt_relative_target(const ulp_insn_t* insn, uint16_t pc)
+{
+    if(insn->b.sub_opcode == SUB_OPCODE_BR)
+    {
+        return (int32_t)pc + (insn->b.sign ? -(int32_t)insn->b.offset : (int32_t)insn->b.offset);
+    }
+    return (int32_t)pc + (insn->bs.sign ? -(int32_t)insn->bs.offset : (int32_t)insn->bs.offset);
+}
+
+static inline bool hulp_opt_is_relative_branch(const ulp_insn_t* insn)
+{
+    return insn->b.opcode == OPCODE_BRANCH && (insn->b.sub_opcode == SUB_OPCODE_BR || insn->bs.sub_opcode == SUB_OPCODE_BS);
+}
+
+static inline bool hulp_opt_is_unconditional_branch(const ulp_insn_t* insn)
+{
+    if(insn->b.opcode != OPCODE_BRANCH)
+    {
+        return false;
+    }
+    switch(insn->b.sub_opcode)
+    {
+        case SUB_OPCODE_BX:
+            return !insn->bx.reg && insn->bx.type == BX_JUMP_TYPE_DIRECT;
+        case SUB_OPCODE_BR:
+            return insn->b.cmp == B_CMP_GE && insn->b.imm == 0;
+        case SUB_OPCODE_BS:
+            return (insn->bs.cmp == JUMPS_GE && insn->bs.imm == 0) || (insn->bs.cmp == JUMPS_LE && insn->bs.imm == 0xFF);
+        default:
+            return false;
+    }
+}
+
+/**
+ * Register written by an instruction, or -1 if none.
+ */
+static int hulp_opt_written_reg(const ulp_insn_t* insn)
+{
+    switch(insn->b.opcode)
+    {
+        case OPCODE_ALU:
+            return (insn->alu_reg.sub_opcode == SUB_OPCODE_ALU_CNT) ? -1 : insn->alu_reg.dreg;
+        case OPCODE_LD:
+            return insn->ld.dreg;
+        case OPCODE_TSENS:
+            return insn->tsens.dreg;
+        case OPCODE_ADC:
+            return insn->adc.dreg;
+        case OPCODE_RD_REG:
+        case OPCODE_I2C:
+            return R0;
+        default:
+            return -1;
+    }
+}
+
+static void hulp_opt_pin(hulp_opt_ctx_t* ctx, size_t from, size_t to)
+{
+    for(size_t pc = from; pc <= to && pc < ctx->num_words; ++pc)
+    {
+        ctx->flags[pc] |= HULP_OPT_PINNED;
+    }
+}
+
+static void hulp_opt_boundary(hulp_opt_ctx_t* ctx, int32_t pc)
+{
+    if(pc >= 0 && pc < (int32_t)ctx->num_words)
+    {
+        ctx->flags[pc] |= HULP_OPT_BOUNDARY;
+    }
+}
+
+/**
+ * An address that may be reached by a register branch, so nothing known on the way into it by falling through holds.
+ */
+static void hulp_opt_entry(hulp_opt_ctx_t* ctx, int32_t pc)
+{
+    if(pc >= 0 && pc < (int32_t)ctx->num_words)
+    {
+        ctx->flags[pc] |= HULP_OPT_BOUNDARY | HULP_OPT_ENTRY;
+    }
+}
+
+/**
+ * A label loaded into a register (M_MOVL) may be used as a base address for data within the program, or offset to
+ * form another code address. Follow the register through the block to find the range of offsets used, and pin it.
+ * Each address the register takes may be jumped to (eg. I_BXR), so is an entry point.
+ */
+static void hulp_opt_pin_label_uses(hulp_opt_ctx_t* ctx, uint16_t label_pc, uint16_t movl_pc)
+{
+    const uint8_t reg = ctx->program[ctx->word_entry[movl_pc]].alu_imm.dreg;
+    int32_t offset = 0;
+    int32_t lo = label_pc;
+    int32_t hi = label_pc;
+
+    // End of the block, before any entry points found here are added
+    size_t end = movl_pc + 1;
+    while(end < ctx->num_words && !(ctx->flags[end] & HULP_OPT_BOUNDARY))
+    {
+        ++end;
+    }
+
+    hulp_opt_entry(ctx, label_pc);
+    for(size_t pc = movl_pc + 1; pc < end; ++pc)
+    {
+        const ulp_insn_t* insn = &ctx->program[ctx->word_entry[pc]];
+        int32_t addr = label_pc + offset;
+        bool unknown = false;
+        switch(insn->b.opcode)
+        {
+            case OPCODE_LD:
+                if(insn->ld.sreg == reg)
+                {
+                    addr += insn->ld.offset;
+                }
+                break;
+            case OPCODE_ST:
+                // Storing the address itself (eg. a return address) does not use it as a base
+                if(insn->st.sreg == reg)
+                {
+                    addr += insn->st.offset;
+                }
+                break;
+            case OPCODE_ALU:
+                if(insn->alu_imm.sub_opcode == SUB_OPCODE_ALU_IMM && insn->alu_imm.sreg == reg)
+                {
+                    // eg. I_ADDI(reg, reg, n) forming a return address within a subroutine
+                    if(insn->alu_imm.dreg == reg && insn->alu_imm.sel == ALU_SEL_ADD)
+                    {
+                        offset = (int16_t)(offset + insn->alu_imm.imm);
+                    }
+                    else if(insn->alu_imm.dreg == reg && insn->alu_imm.sel == ALU_SEL_SUB)
+                    {
+                        offset = (int16_t)(offset - insn->alu_imm.imm);
+                    }
+                    else
+                    {
+                        unknown = true;
+                    }
+                    addr = label_pc + offset;
+                    hulp_opt_entry(ctx, addr);
+                }
+                else if(insn->alu_reg.sub_opcode == SUB_OPCODE_ALU_REG && (insn->alu_reg.sreg == reg || insn->alu_reg.treg == reg))
+                {
+                    unknown = true;
+                }
+                break;
+            default:
+                break;
+        }
+        if(unknown)
+        {
+            // Arbitrary arithmetic (eg. computed jumps): the rest of the program may be addressed
+            for(int32_t entry = label_pc; entry < (int32_t)ctx->num_words; ++entry)
+            {
+                hulp_opt_entry(ctx, entry);
+            }
+            hi = ctx->num_words;
+            break;
+        }
+        lo = (addr < lo) ? addr : lo;
+        hi = (addr > hi) ? addr : hi;
+        const bool offset_tracked = insn->b.opcode == OPCODE_ALU && insn->alu_imm.sub_opcode == SUB_OPCODE_ALU_IMM && insn->alu_imm.sreg == reg;
+        if((hulp_opt_written_reg(insn) == reg && !offset_tracked) || insn->b.opcode == OPCODE_BRANCH)
+        {
+            break;
+        }
+    }
+    hulp_opt_pin(ctx, (lo < 0) ? 0 : lo, hi);
+}
+
+static esp_err_t hulp_opt_analyse(hulp_opt_ctx_t* ctx)
+{
+    ctx->flags[0] |= HULP_OPT_BOUNDARY;
+    for(size_t i = 0; i < ctx->index.num_labels; ++i)
+    {
+        hulp_opt_boundary(ctx, ctx->index.by_pc[i].pc);
+    }
+
+    uint16_t pc = 0;
+    for(size_t i = 0; i < ctx->num_entries; ++i)
+    {
+        const ulp_insn_t* insn = &ctx->program[i];
+        if(insn->macro.opcode != OPCODE_MACRO)
+        {
+            if(insn->b.opcode == OPCODE_BRANCH || insn->b.opcode == OPCODE_HALT)
+            {
+                hulp_opt_boundary(ctx, pc + 1);
+            }
+            if(insn->b.opcode == OPCODE_BRANCH && !(ctx->flags[pc] & HULP_OPT_PATCHED))
+            {
+                if(hulp_opt_is_relative_branch(insn))
+                {
+                    hulp_opt_boundary(ctx, hulp_opt_relative_target(insn, pc));
+                }
+                else if(!insn->bx.reg)
+                {
+                    // Absolute address: nothing before it may move
+                    hulp_opt_boundary(ctx, insn->bx.addr);
+                    hulp_opt_pin(ctx, 0, insn->bx.addr);
+                }
+            }
+            ++pc;
+            continue;
+        }
+
+        if(insn->macro.sub_opcode == SUB_OPCODE_MACRO_LABEL || pc >= ctx->num_words)
+        {
+            continue;
+        }
+
+        uint16_t label_pc;
+        if(hulp_program_index_find_pc(&ctx->index, insn->macro.label, &label_pc) != ESP_OK)
+        {
+            ESP_LOGE(TAG, "[%s] undefined label %u", __func__, insn->macro.label);
+            return ESP_ERR_ULP_UNDEFINED_LABEL;
+        }
+
+        ctx->flags[pc] |= HULP_OPT_PATCHED;
+        if(insn->macro.sub_opcode == HULP_SUB_OPCODE_MACRO_ENTRYPC)
+        {
+            if((size_t)pc + 1 < ctx->num_words)
+            {
+                ctx->flags[pc + 1] |= HULP_OPT_PATCHED;
+            }
+            hulp_opt_entry(ctx, label_pc + insn->macro.unused);
+            hulp_opt_pin(ctx, label_pc, label_pc + insn->macro.unused);
+        }
+    }
+
+    // Once all boundaries are known
+    pc = 0;
+    for(size_t i = 0; i < ctx->num_entries; ++i)
+    {
+        const ulp_insn_t* insn = &ctx->program[i];
+        if(insn->macro.opcode != OPCODE_MACRO)
+        {
+            ++pc;
+        }
+        else if(insn->macro.sub_opcode == SUB_OPCODE_MACRO_LABELPC && pc < ctx->num_words)
+        {
+            uint16_t label_pc;
+            hulp_program_index_find_pc(&ctx->index, insn->macro.label, &label_pc);
+            hulp_opt_pin_label_uses(ctx, label_pc, pc);
+        }
+    }
+    return ESP_OK;
+}
+
+static void hulp_opt_thread_branches(hulp_opt_ctx_t* ctx, hulp_optimize_stats_t* stats)
+{
+    uint16_t pc = 0;
+    for(size_t i = 0; i < ctx->num_entries; ++i)
+    {
+        ulp_insn_t* insn = &ctx->program[i];
+        if(insn->macro.opcode != OPCODE_MACRO)
+        {
+            ++pc;
+            continue;
+        }
+        if(insn->macro.sub_opcode != SUB_OPCODE_MACRO_BRANCH || pc >= ctx->num_words || (ctx->flags[pc] & HULP_OPT_DELETE))
+        {
+            continue;
+        }
+
+        const ulp_insn_t* branch = &ctx->program[ctx->word_entry[pc]];
+        uint16_t label = insn->macro.label;
+        uint16_t target_pc;
+        for(int hops = 0; hops < HULP_OPT_MAX_THREAD_HOPS; ++hops)
+        {
+            hulp_program_index_find_pc(&ctx->index, label, &target_pc);
+            if(target_pc >= ctx->num_words || target_pc == pc || !(ctx->flags[target_pc] & HULP_OPT_PATCHED))
+            {
+                break;
+            }
+            const uint16_t target_entry = ctx->word_entry[target_pc];
+            const ulp_insn_t* target = &ctx->program[target_entry];
+            const ulp_insn_t* target_macro = &ctx->program[target_entry - 1];
+            if(!hulp_opt_is_unconditional_branch(target) ||
+                target_macro->macro.opcode != OPCODE_MACRO || target_macro->macro.sub_opcode != SUB_OPCODE_MACRO_BRANCH)
+            {
+                break;
+            }
+            const uint16_t next_label = target_macro->macro.label;
+            uint16_t next_pc;
+            hulp_program_index_find_pc(&ctx->index, next_label, &next_pc);
+            // Removing instructions can only bring the target closer, so this range check holds after.
+            if(next_label == label || (hulp_opt_is_relative_branch(branch) && abs((int)next_pc - (int)pc) > HULP_OPT_MAX_BRANCH_OFFSET))
+            {
+                break;
+            }
+            label = next_label;
+            stats->cycles_saved += hulp_cfg_get_cycles(target);
+        }
+
+        if(label != insn->macro.label)
+        {
+            ESP_LOGD(TAG, "[%s] pc %u: label %u -> %u", __func__, pc, insn->macro.label, label);
+            insn->macro.label = label;
+            ++stats->rewrites;
+        }
+    }
+}
+
+/**
+ * The flags set by an instruction at pc are unused if they are overwritten before the end of the block.
+ */
+static bool hulp_opt_flags_unused(const hulp_opt_ctx_t* ctx, uint16_t pc)
+{
+    for(size_t next = pc + 1; next < ctx->num_words; ++next)
+    {
+        const ulp_insn_t* insn = &ctx->program[ctx->word_entry[next]];
+        if(ctx->flags[next] & HULP_OPT_BOUNDARY)
+        {
+            return false;
+        }
+        if(hulp_opt_sets_flags(insn) || insn->b.opcode == OPCODE_HALT)
+        {
+            return true;
+        }
+        if(insn->b.opcode == OPCODE_BRANCH)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void hulp_opt_remove_redundant_zero(hulp_opt_ctx_t* ctx, hulp_optimize_stats_t* stats)
+{
+    bool zero[4] = {false};
+    for(uint16_t pc = 0; pc < ctx->num_words; ++pc)
+    {
+        const ulp_insn_t* insn = &ctx->program[ctx->word_entry[pc]];
+        if(ctx->flags[pc] & HULP_OPT_BOUNDARY)
+        {
+            zero[R0] = zero[R1] = zero[R2] = zero[R3] = false;
+        }
+        if(ctx->flags[pc] & HULP_OPT_DELETE)
+        {
+            continue;
+        }
+
+        const int reg = hulp_opt_written_reg(insn);
+        if(reg < 0)
+        {
+            continue;
+        }
+        if(!(ctx->flags[pc] & HULP_OPT_PATCHED) && hulp_opt_is_movi_zero(insn))
+        {
+            if(zero[reg] && !(ctx->flags[pc] & HULP_OPT_PINNED) && hulp_opt_flags_unused(ctx, pc))
+            {
+                ctx->flags[pc] |= HULP_OPT_DELETE;
+                ++stats->rewrites;
+                ++stats->words_saved;
+                stats->cycles_saved += hulp_cfg_get_cycles(insn);
+            }
+            zero[reg] = true;
+        }
+        else
+        {
+            zero[reg] = false;
+        }
+    }
+}
+
+/**
+ * Registers that only hold configuration, so writing adjacent fields at once is equivalent to writing them in turn.
+ * Anything the peripheral acts on as it is written (eg. RTC_GPIO_OUT_W1TS/W1TC, SAR start bits) is excluded, as is
+ * any register not known to be safe.
+ */
+static bool hulp_opt_wr_reg_mergeable(const ulp_insn_t* insn)
+{
+    const uint32_t reg = DR_REG_RTCCNTL_BASE + insn->wr_reg.periph_sel * 0x400 + insn->wr_reg.addr * sizeof(uint32_t);
+    // RTC IO pad mux, function, pulls, drive and input enable only. The DAC, 32k crystal and touch config registers
+    // between them also power analog blocks and set their values, so the order of their writes may matter.
+    return reg == RTC_IO_SENSOR_PADS_REG || reg == RTC_IO_ADC_PAD_REG ||
+        (reg >= RTC_IO_TOUCH_PAD0_REG && reg <= RTC_IO_TOUCH_PAD9_REG);
+}
+
+static void hulp_opt_merge_wr_reg(hulp_opt_ctx_t* ctx, hulp_optimize_stats_t* stats)
+{
+    for(uint16_t pc = 0; pc < ctx->num_words; ++pc)
+    {
+        ulp_insn_t* first = &ctx->program[ctx->word_entry[pc]];
+        if(first->wr_reg.opcode != OPCODE_WR_REG || (ctx->flags[pc] & (HULP_OPT_PINNED | HULP_OPT_PATCHED | HULP_OPT_DELETE)) ||
+            !hulp_opt_wr_reg_mergeable(first))
+        {
+            continue;
+        }
+        uint16_t next = pc + 1;
+        for(; next < ctx->num_words; ++next)
+        {
+            const ulp_insn_t* second = &ctx->program[ctx->word_entry[next]];
+            if(second->wr_reg.opcode != OPCODE_WR_REG ||
+                (ctx->flags[next] & (HULP_OPT_BOUNDARY | HULP_OPT_PINNED | HULP_OPT_PATCHED | HULP_OPT_DELETE)) ||
+                second->wr_reg.addr != first->wr_reg.addr || second->wr_reg.periph_sel != first->wr_reg.periph_sel ||
+                (second->wr_reg.high - second->wr_reg.low) + (first->wr_reg.high - first->wr_reg.low) + 2 > 8)
+            {
+                break;
+            }
+
+            const uint32_t first_width = first->wr_reg.high - first->wr_reg.low + 1;
+            const uint32_t second_width = second->wr_reg.high - second->wr_reg.low + 1;
+            const uint32_t first_data = first->wr_reg.data & ((1 << first_width) - 1);
+            const uint32_t second_data = second->wr_reg.data & ((1 << second_width) - 1);
+            if(second->wr_reg.low == first->wr_reg.high + 1)
+            {
+                first->wr_reg.data = first_data | (second_data << first_width);
+                first->wr_reg.high = second->wr_reg.high;
+            }
+            else if(first->wr_reg.low == second->wr_reg.high + 1)
+            {
+                first->wr_reg.data = second_data | (first_data << second_width);
+                first->wr_reg.low = second->wr_reg.low;
+            }
+            else
+            {
+                break;
+            }
+            ctx->flags[next] |= HULP_OPT_DELETE;
+            ++stats->rewrites;
+            ++stats->words_saved;
+            stats->cycles_saved += hulp_cfg_get_cycles(second);
+        }
+        pc = next - 1;
+    }
+}
+
+/**
+ * Remove blocks (from a label to the next) that are never executed, such as unused subroutines of M_INCLUDE_ drivers.
+ * Execution is assumed to start at the first instruction. Labels loaded with M_MOVL (eg. return addresses),
+ * entry points set with M_SET_ENTRY_LABEL/M_SET_ENTRY_OFFSET and the configured keep_labels may also be executed.
+ */
+static esp_err_t hulp_opt_remove_unreachable(hulp_opt_ctx_t* ctx, const hulp_optimize_config_t* config, hulp_optimize_stats_t* stats)
+{
+    if(config->num_keep_labels && !config->keep_labels)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const size_t num_words = ctx->num_words;
+    ulp_insn_t* resolved = (ulp_insn_t*)malloc(num_words * (sizeof(ulp_insn_t) + sizeof(uint16_t) + sizeof(bool)));
+    if(!resolved)
+    {
+        ESP_LOGE(TAG, "[%s] no memory for %u words", __func__, (unsigned)num_words);
+        return ESP_ERR_NO_MEM;
+    }
+    uint16_t* block_start = (uint16_t*)(resolved + num_words);
+    bool* keep = (bool*)(block_start + num_words);
+    memset(keep, 0, num_words * sizeof(bool));
+
+    size_t size = ctx->num_entries;
+    esp_err_t err = hulp_process_macros(resolved, num_words, ctx->program, &size);
+    if(err != ESP_OK)
+    {
+        free(resolved);
+        return err;
+    }
+
+    // Roots
+    keep[0] = true;
+    for(size_t i = 0; i < config->num_keep_labels; ++i)
+    {
+        uint16_t label_pc;
+        if(hulp_program_index_find_pc(&ctx->index, config->keep_labels[i], &label_pc) != ESP_OK)
+        {
+            ESP_LOGE(TAG, "[%s] undefined keep label %u", __func__, config->keep_labels[i]);
+            free(resolved);
+            return ESP_ERR_ULP_UNDEFINED_LABEL;
+        }
+        if(label_pc < num_words)
+        {
+            keep[label_pc] = true;
+        }
+    }
+    for(size_t entry = 0; entry < num_words; ++entry)
+    {
+        keep[entry] |= (ctx->flags[entry] & HULP_OPT_ENTRY) != 0;
+    }
+    uint16_t pc = 0;
+    for(size_t i = 0; i < ctx->num_entries; ++i)
+    {
+        const ulp_insn_t* insn = &ctx->program[i];
+        uint16_t label_pc;
+        if(insn->macro.opcode != OPCODE_MACRO)
+        {
+            if(insn->bx.opcode == OPCODE_BRANCH && insn->bx.sub_opcode == SUB_OPCODE_BX && !insn->bx.reg &&
+                !(ctx->flags[pc] & HULP_OPT_PATCHED) && insn->bx.addr < num_words)
+            {
+                keep[insn->bx.addr] = true;
+            }
+            ++pc;
+        }
+        else if((insn->macro.sub_opcode == SUB_OPCODE_MACRO_LABELPC || insn->macro.sub_opcode == HULP_SUB_OPCODE_MACRO_ENTRYPC) &&
+            hulp_program_index_find_pc(&ctx->index, insn->macro.label, &label_pc) == ESP_OK)
+        {
+            label_pc += (insn->macro.sub_opcode == HULP_SUB_OPCODE_MACRO_ENTRYPC) ? insn->macro.unused : 0;
+            if(label_pc < num_words)
+            {
+                keep[label_pc] = true;
+            }
+        }
+    }
+
+    err = hulp_cfg_mark_reachable(resolved, num_words, keep);
+    if(err != ESP_OK)
+    {
+        free(resolved);
+        return err;
+    }
+
+    // A block is kept if any of it is executed or its layout is relied upon
+    uint16_t start = 0;
+    for(pc = 0; pc < num_words; ++pc)
+    {
+        uint16_t label;
+        if(hulp_program_index_find_label(&ctx->index, pc, &label) == ESP_OK)
+        {
+            start = pc;
+        }
+        block_start[pc] = start;
+        if(keep[pc] || (ctx->flags[pc] & HULP_OPT_PINNED))
+        {
+            keep[start] = true;
+        }
+    }
+
+    // Labels referenced from kept blocks (even if not executed) must remain defined
+    bool changed = true;
+    while(changed)
+    {
+        changed = false;
+        pc = 0;
+        for(size_t i = 0; i < ctx->num_entries; ++i)
+        {
+            const ulp_insn_t* insn = &ctx->program[i];
+            uint16_t label_pc;
+            if(insn->macro.opcode != OPCODE_MACRO)
+            {
+                ++pc;
+            }
+            else if(insn->macro.sub_opcode != SUB_OPCODE_MACRO_LABEL && pc < num_words && keep[block_start[pc]] &&
+                hulp_program_index_find_pc(&ctx->index, insn->macro.label, &label_pc) == ESP_OK &&
+                label_pc < num_words && !keep[block_start[label_pc]])
+            {
+                keep[block_start[label_pc]] = true;
+                changed = true;
+            }
+        }
+    }
+
+    for(pc = 0; pc < num_words; ++pc)
+    {
+        if(!keep[block_start[pc]])
+        {
+            if(block_start[pc] == pc)
+            {
+                ESP_LOGD(TAG, "[%s] removing unreachable block at pc %u", __func__, pc);
+                ++stats->rewrites;
+            }
+            ctx->flags[pc] |= HULP_OPT_DELETE;
+            ++stats->words_saved;
+        }
+    }
+
+    free(resolved);
+    return ESP_OK;
+}
+
+/**
+ * Remove deleted instructions, adjusting the relative branches around them.
+ */
+static void hulp_opt_compact(hulp_opt_ctx_t* ctx)
+{
+    // Reuse word_entry (no longer needed once the relative branches are found) for the new PC of each instruction
+    uint16_t* new_pc = ctx->word_entry;
+    uint16_t removed = 0;
+    for(uint16_t pc = 0; pc < ctx->num_words; ++pc)
+    {
+        new_pc[pc] = pc - removed;
+        if(ctx->flags[pc] & HULP_OPT_DELETE)
+        {
+            ++removed;
+        }
+    }
+
+    size_t out = 0;
+    uint16_t pc = 0;
+    for(size_t i = 0; i < ctx->num_entries; ++i)
+    {
+        ulp_insn_t insn = ctx->program[i];
+        if(insn.macro.opcode == OPCODE_MACRO)
+        {
+            // Labels and references of removed blocks are removed with them
+            if(pc >= ctx->num_words || !(ctx->flags[pc] & HULP_OPT_DELETE))
+            {
+                ctx->program[out++] = insn;
+            }
+            continue;
+        }
+        if(!(ctx->flags[pc] & (HULP_OPT_DELETE | HULP_OPT_PATCHED)) && hulp_opt_is_relative_branch(&insn))
+        {
+            const int32_t target = hulp_opt_relative_target(&insn, pc);
+            const int32_t new_target = (target >= (int32_t)ctx->num_words) ? target - removed :
+                (target < 0 ? target : new_pc[target]);
+            const int32_t offset = new_target - (int32_t)new_pc[pc];
+            if(insn.b.sub_opcode == SUB_OPCODE_BR)
+            {
+                insn.b.sign = offset < 0;
+                insn.b.offset = abs(offset);
+            }
+            else
+            {
+                insn.bs.sign = offset < 0;
+                insn.bs.offset = abs(offset);
+            }
+        }
+        if(!(ctx->flags[pc] & HULP_OPT_DELETE))
+        {
+            ctx->program[out++] = insn;
+        }
+        ++pc;
+    }
+    ctx->num_entries = out;
+}
+
+static void hulp_opt_relative_branches(hulp_opt_ctx_t* ctx, hulp_optimize_stats_t* stats)
+{
+    uint16_t pc = 0;
+    for(size_t i = 0; i + 1 < ctx->num_entries; ++i)
+    {
+        const ulp_insn_t* insn = &ctx->program[i];
+        if(insn->macro.opcode != OPCODE_MACRO)
+        {
+            ++pc;
+            continue;
+        }
+        ulp_insn_t* branch = &ctx->program[i + 1];
+        uint16_t label_pc;
+        if(insn->macro.sub_opcode != SUB_OPCODE_MACRO_BRANCH || branch->bx.opcode != OPCODE_BRANCH ||
+            branch->bx.sub_opcode != SUB_OPCODE_BX || branch->bx.reg || branch->bx.type != BX_JUMP_TYPE_DIRECT ||
+            hulp_program_index_find_pc(&ctx->index, insn->macro.label, &label_pc) != ESP_OK ||
+            abs((int)label_pc - (int)pc) > HULP_OPT_MAX_BRANCH_OFFSET)
+        {
+            continue;
+        }
+        *branch = (ulp_insn_t)I_BGE(0, 0);
+        ++stats->rewrites;
+    }
+}
+
+esp_err_t hulp_optimize_program(ulp_insn_t* program, size_t* num_entries, const hulp_optimize_config_t* config, hulp_optimize_stats_t* stats)
+{
+    const hulp_optimize_config_t default_config = HULP_OPTIMIZE_CONFIG_DEFAULT();
+    if(!config)
+    {
+        config = &default_config;
+    }
+
+    hulp_optimize_stats_t local_stats = {0};
+    hulp_opt_ctx_t ctx = {
+        .program = program,
+        .num_entries = *num_entries,
+    };
+
+    esp_err_t err = hulp_program_index_init(&ctx.index, program, *num_entries);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+    ctx.num_words = ctx.index.num_words;
+
+    ctx.word_entry = (uint16_t*)malloc(ctx.num_words * (sizeof(uint16_t) + sizeof(uint8_t)));
+    if(!ctx.word_entry)
+    {
+        ESP_LOGE(TAG, "[%s] no memory for %u words", __func__, (unsigned)ctx.num_words);
+        hulp_program_index_deinit(&ctx.index);
+        return ESP_ERR_NO_MEM;
+    }
+    ctx.flags = (uint8_t*)(ctx.word_entry + ctx.num_words);
+    memset(ctx.flags, 0, ctx.num_words);
+
+    uint16_t pc = 0;
+    for(size_t i = 0; i < ctx.num_entries; ++i)
+    {
+        if(program[i].macro.opcode != OPCODE_MACRO)
+        {
+            ctx.word_entry[pc++] = i;
+        }
+    }
+
+    err = hulp_opt_analyse(&ctx);
+    if(err == ESP_OK)
+    {
+        if(config->remove_unreachable)
+        {
+            err = hulp_opt_remove_unreachable(&ctx, config, &local_stats);
+        }
+        if(err == ESP_OK && config->thread_branches)
+        {
+            hulp_opt_thread_branches(&ctx, &local_stats);
+        }
+        if(err == ESP_OK && config->remove_redundant_zero)
+        {
+            hulp_opt_remove_redundant_zero(&ctx, &local_stats);
+        }
+        if(err == ESP_OK && config->merge_wr_reg)
+        {
+            hulp_opt_merge_wr_reg(&ctx, &local_stats);
+        }
+        if(err == ESP_OK && local_stats.words_saved > 0)
+        {
+            hulp_opt_compact(&ctx);
+        }
+        if(err == ESP_OK && config->relative_branches)
+        {
+            // Label PCs have moved
+            hulp_program_index_deinit(&ctx.index);
+            err = hulp_program_index_init(&ctx.index, program, ctx.num_entries);
+            if(err == ESP_OK)
+            {
+                hulp_opt_relative_branches(&ctx, &local_stats);
+            }
+        }
+    }
+
+    free(ctx.word_entry);
+    hulp_program_index_deinit(&ctx.index);
+
+    *num_entries = ctx.num_entries;
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+
+    ESP_LOGD(TAG, "[%s] %u rewrites, %u words, %u cycles saved", __func__,
+        (unsigned)local_stats.rewrites, (unsigned)local_stats.words_saved, (unsigned)local_stats.cycles_saved);
+    if(stats)
+    {
+        *stats = local_stats;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,66 @@
+#ifndef HULP_OPTIMIZE_H
+#define HULP_OPTIMIZE_H
+
+#include "hulp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    bool remove_unreachable;        /*!< Remove blocks that are never executed (eg. unused M_INCLUDE_ subroutines). Assumes the program starts at its first instruction; see keep_labels. */
+    bool remove_redundant_zero;     /*!< Remove I_MOVI(Rx, 0) where Rx is already 0 and the flags it sets are not used (eg. repeated I_GET/I_PUT setup) */
+    bool thread_branches;           /*!< Retarget branches whose target is an unconditional branch, to its destination */
+    bool merge_wr_reg;              /*!< Merge consecutive I_WR_REG to adjacent bit ranges of a register. Only the RTC IO pad mux/pull/input enable registers (RTC_IO_SENSOR_PADS_REG, RTC_IO_ADC_PAD_REG and RTC_IO_TOUCH_PADn_REG), which the peripheral does not act on as they are written. */
+    bool relative_branches;         /*!< Replace M_BX with a relative branch where in range. Saves nothing, but makes the program independent of its load address. */
+    const uint16_t* keep_labels;    /*!< Labels that are also entry points, for remove_unreachable (see below) */
+    size_t num_keep_labels;         /*!< Number of elements in keep_labels */
+} hulp_optimize_config_t;
+
+#define HULP_OPTIMIZE_CONFIG_DEFAULT() {    \
+        .remove_unreachable = false,        \
+        .remove_redundant_zero = true,      \
+        .thread_branches = true,            \
+        .merge_wr_reg = false,              \
+        .relative_branches = false,         \
+        .keep_labels = NULL,                \
+        .num_keep_labels = 0                \
+    }
+
+typedef struct {
+    size_t rewrites;        /*!< Number of changes made */
+    size_t words_saved;     /*!< Number of instructions removed */
+    size_t cycles_saved;    /*!< Sum of cycles saved by each change, each time its path is executed */
+} hulp_optimize_stats_t;
+
+/**
+ * Peephole optimisation of a ULP program, prior to hulp_ulp_load.
+ *
+ * Works on the program before macro processing (ie. as passed to hulp_ulp_load), so that labels are preserved.
+ * A rewrite is only made where the result is equivalent:
+ *  - Removals are limited to straight-line code, and relative branches across them are adjusted.
+ *  - No instructions are removed before an absolute branch target (eg. I_BXI(n)), nor between a label and any offset
+ *    from it that the program may use (eg. M_MOVL followed by I_LD with an offset, or M_SET_ENTRY_OFFSET).
+ *  - Every address formed from a label in this way may be branched to (eg. M_MOVL, I_ADDI then I_BXR), so nothing
+ *    known from the code falling into it is assumed there.
+ * Programs that address their own instructions in other ways (eg. hulp_debug breakpoints) should be optimised before
+ * passing them to any such API. M_SET_ENTRY_LBL and M_SET_ENTRY_O fix their address when the program array is
+ * initialised, so use M_SET_ENTRY_LABEL and M_SET_ENTRY_OFFSET in programs to be optimised.
+ *
+ * remove_unreachable only follows branches from the first instruction, M_MOVL labels and M_SET_ENTRY_LABEL/OFFSET entry points.
+ * Labels whose address is only looked up at runtime are not seen, so every such label must be listed in keep_labels,
+ * or its code is removed. These include hulp_sched_init tasks, hulp_cmd_init handlers, and any label passed to
+ * hulp_get_label_pc (eg. hulp_ulp_run(hulp_get_label_pc(...))).
+ *
+ * program: program to optimise in place
+ * num_entries: in: number of elements in program (including macros); out: number remaining
+ * config: NULL for HULP_OPTIMIZE_CONFIG_DEFAULT()
+ * stats: (optional) savings made
+ */
+esp_err_t hulp_optimize_program(ulp_insn_t* program, size_t* num_entries, const hulp_optimize_config_t* config, hulp_optimize_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_OPTIMIZE_H */
@@ -0,0 +1,246 @@
+#include "hulp_overlay.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp32/rom/ets_sys.h"
+
+#include "hulp.h"
+
+#include "hulp_config.h"
+
+static const char* TAG = "HULP-OVL";
+
+#define HULP_OVERLAY_MAGIC 0x484C4F56
+#define HULP_OVERLAY_STOP_TIMEOUT_US 100000
+#define HULP_OVERLAY_STOP_POLL_US 100
+
+/**
+ * Retained through deep sleep, so that the root segment is not reloaded.
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t window_start;
+    int16_t current;
+    uint32_t root_hash;
+} hulp_overlay_state_t;
+
+RTC_DATA_ATTR ulp_var_t hulp_overlay_request;
+
+static RTC_DATA_ATTR hulp_overlay_state_t s_state;
+static hulp_overlay_config_t s_config;
+
+/**
+ * Find the words of the root segment that are patched with the address of a label in the window (eg. M_BX, M_MOVL or
+ * M_SET_ENTRY_LABEL of a label in the overlay). These differ between overlays, and are rewritten with each swap.
+ */
+static void hulp_overlay_find_window_refs(const hulp_overlay_t* overlay, size_t program_entries, const hulp_program_index_t* index, uint16_t window_start, bool* window_ref)
+{
+    uint16_t pc = 0;
+    for(size_t i = 0; i < program_entries && pc < window_start; ++i)
+    {
+        const ulp_insn_t* insn = &overlay->program[i];
+        uint16_t label_pc;
+        if(insn->macro.opcode != OPCODE_MACRO)
+        {
+            ++pc;
+        }
+        else if(insn->macro.sub_opcode != SUB_OPCODE_MACRO_LABEL &&
+            hulp_program_index_find_pc(index, insn->macro.label, &label_pc) == ESP_OK && label_pc >= window_start)
+        {
+            window_ref[pc] = true;
+            if(insn->macro.sub_opcode == HULP_SUB_OPCODE_MACRO_ENTRYPC && pc + 1 < window_start)
+            {
+                window_ref[pc + 1] = true;
+            }
+        }
+    }
+}
+
+/**
+ * Hash of the root segment, less the addresses of labels in the window.
+ */
+static uint32_t hulp_overlay_root_hash(const ulp_insn_t* words, const bool* window_ref, size_t num_words)
+{
+    uint32_t hash = 2166136261UL;
+    for(size_t i = 0; i < num_words; ++i)
+    {
+        ulp_insn_t insn = words[i];
+        if(window_ref[i])
+        {
+            switch(insn.b.opcode)
+            {
+                case OPCODE_BRANCH:
+                    insn.bx.addr = 0;
+                    break;
+                case OPCODE_ALU:
+                    insn.alu_imm.imm = 0;
+                    break;
+                case OPCODE_WR_REG:
+                    insn.wr_reg.data = 0;
+                    break;
+                default:
+                    break;
+            }
+        }
+        hash = (hash ^ insn.instruction) * 16777619UL;
+    }
+    return hash;
+}
+
+/**
+ * Stop the ULP timer and wait for any current run to halt, so the program is not modified while executing.
+ */
+static esp_err_t hulp_overlay_stop_ulp(void)
+{
+    hulp_ulp_end();
+    for(uint32_t waited = 0; hulp_get_state() == ULP_STATE_RUNNING; waited += HULP_OVERLAY_STOP_POLL_US)
+    {
+        if(waited >= HULP_OVERLAY_STOP_TIMEOUT_US)
+        {
+            ESP_LOGE(TAG, "[%s] timed out waiting for ULP to halt", __func__);
+            return ESP_ERR_TIMEOUT;
+        }
+        ets_delay_us(HULP_OVERLAY_STOP_POLL_US);
+    }
+    return ESP_OK;
+}
+
+esp_err_t hulp_overlay_init(const hulp_overlay_config_t* config)
+{
+    if(!config || !config->overlays || config->num_overlays == 0 || config->num_overlays > INT16_MAX)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if(config->window_start >= HULP_ULP_RESERVE_MEM / sizeof(ulp_insn_t))
+    {
+        ESP_LOGE(TAG, "[%s] window start (%u) beyond reserved memory", __func__, config->window_start);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    s_config = *config;
+
+    if(s_state.magic == HULP_OVERLAY_MAGIC && (s_state.window_start != config->window_start || s_state.current >= (int)config->num_overlays))
+    {
+        // Resident program is from a different configuration
+        s_state.magic = 0;
+    }
+    return ESP_OK;
+}
+
+esp_err_t hulp_overlay_load(size_t overlay_id, bool force_root)
+{
+    if(!s_config.overlays)
+    {
+        ESP_LOGE(TAG, "[%s] not initialised", __func__);
+        return ESP_ERR_INVALID_STATE;
+    }
+    if(overlay_id >= s_config.num_overlays)
+    {
+        ESP_LOGE(TAG, "[%s] invalid overlay %u", __func__, (unsigned)overlay_id);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const hulp_overlay_t* overlay = &s_config.overlays[overlay_id];
+    const uint16_t window_start = s_config.window_start;
+    const size_t program_entries = overlay->program_size / sizeof(ulp_insn_t);
+    size_t num_words = program_entries;
+
+    ulp_insn_t* image = (ulp_insn_t*)malloc(num_words * sizeof(ulp_insn_t) + window_start * sizeof(bool));
+    if(!image)
+    {
+        ESP_LOGE(TAG, "[%s] no memory for overlay %u", __func__, (unsigned)overlay_id);
+        return ESP_ERR_NO_MEM;
+    }
+    bool* window_ref = (bool*)(image + num_words);
+    memset(window_ref, 0, window_start * sizeof(bool));
+
+    hulp_program_index_t index;
+    uint16_t entry_pc;
+    esp_err_t err = hulp_program_index_init(&index, overlay->program, program_entries);
+    if(err != ESP_OK)
+    {
+        free(image);
+        return err;
+    }
+    err = hulp_program_index_find_pc(&index, overlay->entry_label, &entry_pc);
+    if(err == ESP_OK)
+    {
+        hulp_overlay_find_window_refs(overlay, program_entries, &index, window_start, window_ref);
+    }
+    hulp_program_index_deinit(&index);
+    if(err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "[%s] overlay %u: entry label %u not found", __func__, (unsigned)overlay_id, overlay->entry_label);
+        free(image);
+        return err;
+    }
+
+    err = hulp_process_macros(image, HULP_ULP_RESERVE_MEM / sizeof(ulp_insn_t), overlay->program, &num_words);
+    if(err == ESP_OK && num_words < window_start)
+    {
+        ESP_LOGE(TAG, "[%s] overlay %u (%u words) ends before the window", __func__, (unsigned)overlay_id, (unsigned)num_words);
+        err = ESP_ERR_INVALID_SIZE;
+    }
+    if(err != ESP_OK)
+    {
+        free(image);
+        return err;
+    }
+
+    const uint32_t root_hash = hulp_overlay_root_hash(image, window_ref, window_start);
+    const bool load_root = force_root || s_state.magic != HULP_OVERLAY_MAGIC;
+    if(!load_root && root_hash != s_state.root_hash)
+    {
+        ESP_LOGE(TAG, "[%s] overlay %u has a different root segment", __func__, (unsigned)overlay_id);
+        free(image);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    err = hulp_overlay_stop_ulp();
+    if(err == ESP_OK)
+    {
+        const uint16_t from = load_root ? 0 : window_start;
+        err = hulp_ulp_load_image((const uint32_t*)(image + from), num_words - from, NULL, 0, s_config.period_us, from);
+    }
+    if(err == ESP_OK && !load_root)
+    {
+        // The root's references to labels in the window
+        for(uint16_t pc = 0; pc < window_start; ++pc)
+        {
+            if(window_ref[pc])
+            {
+                RTC_SLOW_MEM[pc] = image[pc].instruction;
+            }
+        }
+    }
+    free(image);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+
+    ESP_LOGD(TAG, "[%s] overlay %u loaded (%u words), entry %u", __func__, (unsigned)overlay_id, (unsigned)(num_words - window_start), entry_pc);
+    s_state.window_start = window_start;
+    s_state.current = (int16_t)overlay_id;
+    s_state.root_hash = root_hash;
+    s_state.magic = HULP_OVERLAY_MAGIC;
+    hulp_overlay_request.val = 0;
+    return hulp_ulp_run(entry_pc);
+}
+
+esp_err_t hulp_overlay_service(void)
+{
+    const uint16_t request = hulp_overlay_request.val;
+    if(request == 0)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+    return hulp_overlay_load(request - 1, false);
+}
+
+int hulp_overlay_get_current(void)
+{
+    return (s_state.magic == HULP_OVERLAY_MAGIC) ? s_state.current : -1;
+}
@@ -0,0 +1,82 @@
+#ifndef HULP_OVERLAY_H
+#define HULP_OVERLAY_H
+
+#include "hulp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Overlays allow programs larger than RTC slow memory to be split into phases (eg. calibration, then normal operation),
+ * which are swapped into a fixed window of RTC slow memory on request.
+ *
+ * Each overlay is a complete program: a resident root segment (identical in every overlay) followed by the
+ * phase-specific code, which must begin at window_start. The root segment may contain shared subroutines, and branch to
+ * labels in the window (M_BX, M_MOVL or M_SET_ENTRY_LABEL); these are left out of the check that the root segment is
+ * identical, and rewritten with each swap. State shared between overlays should be kept in ulp_var_t (RTC_DATA_ATTR)
+ * as usual.
+ *
+ * Only the window is copied when swapping, so reserved words in the root segment (eg. M_IF_MS_ELAPSED) are preserved.
+ * Overlays are kept unprocessed and processed when loaded, so, where their contents allow, they may be const (flash).
+ */
+typedef struct {
+    const ulp_insn_t* program;  /*!< Complete program: root segment followed by this overlay */
+    size_t program_size;        /*!< Size of program in bytes, eg. sizeof(program) */
+    uint16_t entry_label;       /*!< Label at which the ULP starts when this overlay is loaded */
+} hulp_overlay_t;
+
+typedef struct {
+    const hulp_overlay_t* overlays; /*!< Overlays, by id. Must remain valid. */
+    size_t num_overlays;            /*!< Number of overlays */
+    uint16_t window_start;          /*!< Word at which overlays begin (ie. number of instructions in the root segment) */
+    uint32_t period_us;             /*!< ULP wakeup period */
+} hulp_overlay_config_t;
+
+/**
+ * Overlay requested by the ULP (M_OVERLAY_REQUEST), plus 1. 0 if none.
+ */
+extern ulp_var_t hulp_overlay_request;
+
+/**
+ * Request an overlay from the ULP. The ULP wakes the SoC and stops until hulp_overlay_service swaps in the overlay and
+ * restarts it at the overlay's entry label.
+ *
+ * reg_zero: a register to be cleared for addressing hulp_overlay_request (R1-R3)
+ */
+#define M_OVERLAY_REQUEST(overlay_id, reg_zero) \
+    I_MOVI(reg_zero, 0), \
+    I_MOVI(R0, (overlay_id) + 1), \
+    I_PUT(R0, reg_zero, hulp_overlay_request), \
+    I_WAKE(), \
+    I_END(), \
+    I_HALT()
+
+/**
+ * Set the overlay configuration. This does not load anything; typically follow with hulp_overlay_load, or, if waking
+ * from deep sleep, hulp_overlay_service.
+ */
+esp_err_t hulp_overlay_init(const hulp_overlay_config_t* config);
+
+/**
+ * Stop the ULP, swap in an overlay and restart the ULP at its entry label.
+ * The root segment is also loaded the first time, or if force_root.
+ */
+esp_err_t hulp_overlay_load(size_t overlay_id, bool force_root);
+
+/**
+ * Swap in the overlay requested by the ULP (M_OVERLAY_REQUEST), if any.
+ * Returns ESP_ERR_NOT_FOUND if there is no pending request.
+ */
+esp_err_t hulp_overlay_service(void);
+
+/**
+ * Get the id of the loaded overlay, or -1 if none.
+ */
+int hulp_overlay_get_current(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_OVERLAY_H */
@@ -0,0 +1,54 @@
+#include "hulp_ring.h"
+
+/**
+ * Header word, as last written by either side.
+ */
+static uint16_t hulp_ring_get(const ulp_var_t* ring, size_t index)
+{
+    return ((const volatile ulp_var_t*)ring)[index].val;
+}
+
+void hulp_ring_init(ulp_var_t* ring)
+{
+    ring[HULP_RING_HEAD].val = 0;
+    ring[HULP_RING_TAIL].val = 0;
+    ring[HULP_RING_DROPPED].val = 0;
+}
+
+size_t hulp_ring_count(const ulp_var_t* ring, size_t capacity, size_t entry_words)
+{
+    size_t data_words = HULP_RING_DATA_WORDS(capacity, entry_words);
+    size_t head = hulp_ring_get(ring, HULP_RING_HEAD);
+    size_t tail = hulp_ring_get(ring, HULP_RING_TAIL);
+    return ((head + data_words - tail) % data_words) / entry_words;
+}
+
+size_t hulp_ring_drain(ulp_var_t* ring, size_t capacity, size_t entry_words, uint16_t* dest, size_t max_entries)
+{
+    size_t data_words = HULP_RING_DATA_WORDS(capacity, entry_words);
+    const volatile ulp_var_t* data = (const volatile ulp_var_t*)&ring[HULP_RING_HDR_WORDS];
+    // The ULP only writes entries at the head, and only publishes them after, so everything up to this head is complete
+    size_t head = hulp_ring_get(ring, HULP_RING_HEAD);
+    size_t tail = hulp_ring_get(ring, HULP_RING_TAIL);
+    size_t count = 0;
+    while(tail != head && count < max_entries)
+    {
+        for(size_t i = 0; i < entry_words; ++i)
+        {
+            *dest++ = data[tail + i].val;
+        }
+        tail += entry_words;
+        if(tail >= data_words)
+        {
+            tail = 0;
+        }
+        ++count;
+    }
+    ((volatile ulp_var_t*)ring)[HULP_RING_TAIL].val = (uint16_t)tail;
+    return count;
+}
+
+uint16_t hulp_ring_get_dropped(const ulp_var_t* ring)
+{
+    return hulp_ring_get(ring, HULP_RING_DROPPED);
+}
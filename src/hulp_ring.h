@@ -0,0 +1,143 @@
+#ifndef HULP_RING_H
+#define HULP_RING_H
+
+#include "hulp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Single producer (ULP), single consumer (SoC) ring buffer in RTC memory.
+ *
+ * The ULP only writes the head and the SoC only writes the tail, so neither waits for the other. The ULP writes each
+ * entry into the free slot at the head and then publishes it by advancing the head; if the ring is full, the entry is
+ * dropped (and counted) instead. The SoC copies out everything between the tail and the head with hulp_ring_drain.
+ *
+ * Example:
+ *      RTC_DATA_ATTR ulp_var_t ulp_samples[HULP_RING_WORDS(256, 1)];
+ *
+ *      //ULP: sample into R1, then
+ *      M_RING_PUSH(ulp_samples, 256, R1),
+ *      M_RING_WAKE_AT(ulp_samples, 256, 1, 200),     //Wake the SoC once 200 samples are waiting
+ *      I_HALT(),
+ *
+ *      //SoC:
+ *      uint16_t samples[256];
+ *      size_t n = hulp_ring_drain(ulp_samples, 256, 1, samples, 256);
+ *
+ * Entries of more than one word are written between M_RING_SLOT and M_RING_COMMIT:
+ *      M_RING_SLOT(ulp_readings, R3),
+ *      I_ST(R1, R3, 0),
+ *      I_ST(R2, R3, 1),
+ *      M_RING_COMMIT(ulp_readings, 64, 2),
+ */
+
+// Ring header
+#define HULP_RING_HEAD 0        /*!< Word offset of the next entry to write (ULP) */
+#define HULP_RING_TAIL 1        /*!< Word offset of the next entry to read (SoC) */
+#define HULP_RING_DROPPED 2     /*!< Number of entries dropped while full (ULP) */
+#define HULP_RING_HDR_WORDS 3
+
+/**
+ * Number of words of entries. One slot is always free, for the ULP to write the next entry.
+ */
+#define HULP_RING_DATA_WORDS(capacity, entry_words) (((capacity) + 1) * (entry_words))
+
+/**
+ * Size of the ring (ulp_var_t array) for capacity entries of entry_words each. Must be less than 32768 words.
+ */
+#define HULP_RING_WORDS(capacity, entry_words) (HULP_RING_HDR_WORDS + HULP_RING_DATA_WORDS((capacity), (entry_words)))
+
+/**
+ * Empty the ring. Only while the ULP is not running.
+ */
+void hulp_ring_init(ulp_var_t* ring);
+
+/**
+ * Get the number of entries waiting.
+ */
+size_t hulp_ring_count(const ulp_var_t* ring, size_t capacity, size_t entry_words);
+
+/**
+ * Copy up to max_entries waiting entries (oldest first) and free them for the ULP. Never blocks the ULP.
+ *
+ * dest: array of max_entries * entry_words
+ *
+ * Returns the number of entries copied.
+ */
+size_t hulp_ring_drain(ulp_var_t* ring, size_t capacity, size_t entry_words, uint16_t* dest, size_t max_entries);
+
+/**
+ * Get the number of entries the ULP has dropped while the ring was full.
+ */
+uint16_t hulp_ring_get_dropped(const ulp_var_t* ring);
+
+/**
+ * Point reg_slot at the free slot for the next entry, to be written with I_ST(reg, reg_slot, 0 to entry_words - 1).
+ */
+#define M_RING_SLOT(ring, reg_slot) \
+    I_MOVI(reg_slot, 0), \
+    I_LD(reg_slot, reg_slot, RTC_WORD_OFFSET((ring)[HULP_RING_HEAD])), \
+    I_ADDI(reg_slot, reg_slot, RTC_WORD_OFFSET((ring)[HULP_RING_HDR_WORDS]))
+
+/**
+ * Publish the entry written at M_RING_SLOT, or drop it if the ring is full.
+ *  Note: Uses R0, R1 and R2 (see _ variant)
+ */
+#define M_RING_COMMIT(ring, capacity, entry_words) \
+    M_RING_COMMIT_(ring, capacity, entry_words, R1, R2)
+
+#define M_RING_COMMIT_(ring, capacity, entry_words, reg_scr1, reg_scr2) \
+    I_MOVI(reg_scr1, 0), \
+    I_LD(reg_scr2, reg_scr1, RTC_WORD_OFFSET((ring)[HULP_RING_HEAD])), \
+    I_ADDI(reg_scr2, reg_scr2, (entry_words)), \
+    I_MOVR(R0, reg_scr2), \
+    I_BL(2, HULP_RING_DATA_WORDS((capacity), (entry_words))), \
+    I_MOVI(reg_scr2, 0),                                /*Wrap*/ \
+    I_LD(R0, reg_scr1, RTC_WORD_OFFSET((ring)[HULP_RING_TAIL])), \
+    I_SUBR(R0, R0, reg_scr2),                           /*Full if the next head is the tail*/ \
+    I_BL(3, 1), \
+    I_ST(reg_scr2, reg_scr1, RTC_WORD_OFFSET((ring)[HULP_RING_HEAD])), \
+    I_BGE(4, 0), \
+    I_LD(R0, reg_scr1, RTC_WORD_OFFSET((ring)[HULP_RING_DROPPED])), \
+    I_ADDI(R0, R0, 1), \
+    I_ST(R0, reg_scr1, RTC_WORD_OFFSET((ring)[HULP_RING_DROPPED]))
+
+/**
+ * Push a one word entry (ring of entry_words 1).
+ *  Note: Uses R0, R1 and R2 (see _ variant)
+ *
+ * reg_val: Register with the value; not reg_scr1
+ */
+#define M_RING_PUSH(ring, capacity, reg_val) \
+    M_RING_PUSH_(ring, capacity, reg_val, R1, R2)
+
+#define M_RING_PUSH_(ring, capacity, reg_val, reg_scr1, reg_scr2) \
+    I_MOVI(reg_scr1, 0), \
+    I_LD(reg_scr1, reg_scr1, RTC_WORD_OFFSET((ring)[HULP_RING_HEAD])), \
+    I_ST(reg_val, reg_scr1, RTC_WORD_OFFSET((ring)[HULP_RING_HDR_WORDS])), \
+    M_RING_COMMIT_(ring, capacity, 1, reg_scr1, reg_scr2)
+
+/**
+ * Wake the SoC (I_WAKE) if at least watermark entries are waiting.
+ *  Note: Uses R0 and R1 (see _ variant)
+ */
+#define M_RING_WAKE_AT(ring, capacity, entry_words, watermark) \
+    M_RING_WAKE_AT_(ring, capacity, entry_words, watermark, R1)
+
+#define M_RING_WAKE_AT_(ring, capacity, entry_words, watermark, reg_scr) \
+    I_MOVI(reg_scr, 0), \
+    I_LD(R0, reg_scr, RTC_WORD_OFFSET((ring)[HULP_RING_HEAD])), \
+    I_LD(reg_scr, reg_scr, RTC_WORD_OFFSET((ring)[HULP_RING_TAIL])), \
+    I_SUBR(R0, R0, reg_scr),                            /*Words waiting, if the head has not wrapped behind the tail*/ \
+    I_BL(2, 0x8000), \
+    I_ADDI(R0, R0, HULP_RING_DATA_WORDS((capacity), (entry_words))), \
+    I_BL(2, (watermark) * (entry_words)), \
+    I_WAKE()
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_RING_H */
@@ -0,0 +1,71 @@
+#include "hulp_sched.h"
+
+#include <inttypes.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "HULP-SCHED";
+
+uint8_t hulp_sched_tick_shift(const hulp_sched_task_t* tasks, size_t num_tasks)
+{
+    uint32_t max_period_ms = 0;
+    for(size_t i = 0; i < num_tasks; ++i)
+    {
+        if(tasks[i].period_ms > max_period_ms)
+        {
+            max_period_ms = tasks[i].period_ms;
+        }
+    }
+    // Deadlines are compared by the sign of their difference, so periods must fit in 15 bits
+    return hulp_ms_to_ulp_tick_shift((max_period_ms > UINT32_MAX / 2) ? UINT32_MAX : 2 * max_period_ms);
+}
+
+esp_err_t hulp_sched_init(ulp_var_t* table, const hulp_sched_task_t* tasks, size_t num_tasks, uint8_t tick_shift, const ulp_insn_t* program, size_t program_entries)
+{
+    if(!table || !tasks || !num_tasks || !program)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    hulp_program_index_t index;
+    esp_err_t err = hulp_program_index_init(&index, program, program_entries);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+
+    uint16_t now = hulp_get_current_ulp_ticks(tick_shift);
+    for(size_t i = 0; i < num_tasks && err == ESP_OK; ++i)
+    {
+        ulp_var_t* task = &table[HULP_SCHED_HDR_WORDS + HULP_SCHED_TASK_WORDS * i];
+        uint16_t entry;
+        uint16_t period = hulp_ms_to_ulp_ticks_with_shift(tasks[i].period_ms, tick_shift);
+        if(hulp_program_index_find_pc(&index, tasks[i].entry_label, &entry) != ESP_OK)
+        {
+            ESP_LOGE(TAG, "[%s] task %u: label %u not found", __func__, (unsigned)i, tasks[i].entry_label);
+            err = ESP_ERR_NOT_FOUND;
+        }
+        else if(hulp_sched_tick_shift(&tasks[i], 1) > tick_shift)
+        {
+            ESP_LOGE(TAG, "[%s] task %u: period %" PRIu32 " ms too long for tick shift %u", __func__, (unsigned)i, tasks[i].period_ms, tick_shift);
+            err = ESP_ERR_INVALID_ARG;
+        }
+        else
+        {
+            task[HULP_SCHED_TASK_PERIOD].val = (period > 0) ? period : 1;
+            task[HULP_SCHED_TASK_NEXT].val = now;
+            task[HULP_SCHED_TASK_ENTRY].val = entry;
+        }
+    }
+    hulp_program_index_deinit(&index);
+    if(err != ESP_OK)
+    {
+        return err;
+    }
+
+    table[HULP_SCHED_HDR_NEXT].val = now;
+    table[HULP_SCHED_HDR_NOW].val = now;
+    table[HULP_SCHED_HDR_TASK].val = 0;
+    table[HULP_SCHED_HDR_SOONEST].val = 0;
+    return ESP_OK;
+}
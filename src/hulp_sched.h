@@ -0,0 +1,143 @@
+#ifndef HULP_SCHED_H
+#define HULP_SCHED_H
+
+#include "hulp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Table-driven periodic task scheduler.
+ *
+ * M_SCHED_RUN reads the RTC ticks once per wake and compares them with the earliest deadline of any task, so a wake
+ * with nothing due costs the same few instructions however many tasks there are. Otherwise it walks the task table,
+ * dispatches each task that is due, and stores the next earliest deadline.
+ *
+ * Tasks are in RTC memory (see hulp_sched_init) rather than in the instruction stream, and each is a block of code
+ * beginning with a label and ending with M_SCHED_TASK_END.
+ *
+ * Example:
+ *      RTC_DATA_ATTR ulp_var_t ulp_sched[HULP_SCHED_TABLE_WORDS(2)];
+ *
+ *      const ulp_insn_t program[] = {
+ *          M_SCHED_RUN(LBL_SCHED_RESUME, ulp_sched, 2, tick_shift),
+ *          I_HALT(),
+ *
+ *          M_LABEL(LBL_LED_TASK),
+ *              M_RTCIO_TOGGLE(LED_RTCIO),
+ *              M_SCHED_TASK_END(LBL_SCHED_RESUME),
+ *
+ *          M_LABEL(LBL_I2C_TASK),
+ *              //...
+ *              M_SCHED_TASK_END(LBL_SCHED_RESUME),
+ *      };
+ *
+ *      const hulp_sched_task_t tasks[] = {
+ *          {.entry_label = LBL_LED_TASK, .period_ms = 500},
+ *          {.entry_label = LBL_I2C_TASK, .period_ms = 10000},
+ *      };
+ *      uint8_t tick_shift = hulp_sched_tick_shift(tasks, 2);
+ *      hulp_sched_init(ulp_sched, tasks, 2, tick_shift, program, sizeof(program) / sizeof(ulp_insn_t));
+ *
+ * Times are 16 bits of the RTC ticks from tick_shift, so periods (and the time between wakes) must be less than half
+ * of that range, which hulp_sched_tick_shift ensures for the periods.
+ * As with M_BX, task entries are relative to the start of the program, so it should be loaded at 0.
+ */
+
+// Table header
+#define HULP_SCHED_HDR_NEXT 0       /*!< Earliest deadline of any task */
+#define HULP_SCHED_HDR_NOW 1        /*!< Ticks at this wake */
+#define HULP_SCHED_HDR_TASK 2       /*!< Offset of the task being run */
+#define HULP_SCHED_HDR_SOONEST 3    /*!< Least time to a deadline of the tasks walked so far */
+#define HULP_SCHED_HDR_WORDS 4
+
+// Each task, following the header
+#define HULP_SCHED_TASK_PERIOD 0
+#define HULP_SCHED_TASK_NEXT 1      /*!< Deadline */
+#define HULP_SCHED_TASK_ENTRY 2     /*!< PC of the task */
+#define HULP_SCHED_TASK_WORDS 3
+
+/**
+ * Size of the table (ulp_var_t array) for a number of tasks.
+ */
+#define HULP_SCHED_TABLE_WORDS(num_tasks) (HULP_SCHED_HDR_WORDS + HULP_SCHED_TASK_WORDS * (num_tasks))
+
+typedef struct {
+    uint16_t entry_label;   /*!< Label at the start of the task */
+    uint32_t period_ms;     /*!< Time between runs of the task */
+} hulp_sched_task_t;
+
+/**
+ * Get the lowest bit of the RTC ticks at which all of the tasks' periods can be scheduled.
+ */
+uint8_t hulp_sched_tick_shift(const hulp_sched_task_t* tasks, size_t num_tasks);
+
+/**
+ * Initialise the task table in RTC memory. All tasks are due on the next wake.
+ *
+ * table: array of HULP_SCHED_TABLE_WORDS(num_tasks)
+ * tick_shift: as passed to M_SCHED_RUN, eg. from hulp_sched_tick_shift
+ * program, program_entries: the program (including macros) that contains the tasks' labels
+ */
+esp_err_t hulp_sched_init(ulp_var_t* table, const hulp_sched_task_t* tasks, size_t num_tasks, uint8_t tick_shift, const ulp_insn_t* program, size_t program_entries);
+
+/**
+ * Run all due tasks, then continue. R0-R3 are clobbered.
+ *
+ * label_resume: Label for tasks to return to (M_SCHED_TASK_END)
+ * table: The ulp_var_t array given to hulp_sched_init
+ * num_tasks: Number of tasks in the table
+ * tick_shift: As given to hulp_sched_init
+ */
+#define M_SCHED_RUN(label_resume, table, num_tasks, tick_shift) \
+    M_UPDATE_TICKS(), \
+    I_RD_TICKS_REG(tick_shift), \
+    I_MOVI(R3, 0), \
+    I_ST(R0, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_NOW])), \
+    I_LD(R1, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_NEXT])), \
+    I_SUBR(R0, R0, R1),                                 /*Nothing due yet (now - next is negative), so done*/ \
+    I_BGE(31, 0x8000), \
+    I_MOVI(R0, 0x7FFF), \
+    I_ST(R0, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_SOONEST])), \
+    I_MOVI(R1, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_WORDS])), \
+    I_LD(R2, R1, HULP_SCHED_TASK_NEXT),                 /*For each task (R1), check if it is due*/ \
+    I_LD(R0, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_NOW])), \
+    I_SUBR(R0, R0, R2), \
+    I_BGE(11, 0x8000), \
+    I_LD(R0, R1, HULP_SCHED_TASK_PERIOD),               /*Due: the next deadline is a period from now*/ \
+    I_LD(R2, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_NOW])), \
+    I_ADDR(R2, R2, R0), \
+    I_ST(R2, R1, HULP_SCHED_TASK_NEXT), \
+    I_ST(R1, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_TASK])), \
+    I_LD(R0, R1, HULP_SCHED_TASK_ENTRY),                /*Run it, and it returns here with everything clobbered*/ \
+    I_BXR(R0), \
+    M_LABEL(label_resume), \
+    I_MOVI(R3, 0), \
+    I_LD(R1, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_TASK])), \
+    I_LD(R2, R1, HULP_SCHED_TASK_NEXT), \
+    I_LD(R0, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_NOW])), /*Keep the least time to a deadline*/ \
+    I_SUBR(R2, R2, R0), \
+    I_LD(R0, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_SOONEST])), \
+    I_SUBR(R0, R0, R2), \
+    I_BGE(2, 0x8000), \
+    I_ST(R2, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_SOONEST])), \
+    I_ADDI(R1, R1, HULP_SCHED_TASK_WORDS), \
+    I_MOVR(R0, R1), \
+    I_BL(-22, RTC_WORD_OFFSET((table)[HULP_SCHED_TABLE_WORDS(num_tasks)])), \
+    I_LD(R0, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_NOW])), /*Walked all tasks, so store the earliest deadline*/ \
+    I_LD(R2, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_SOONEST])), \
+    I_ADDR(R0, R0, R2), \
+    I_ST(R0, R3, RTC_WORD_OFFSET((table)[HULP_SCHED_HDR_NEXT]))
+
+/**
+ * End a task, returning to the scheduler. Registers need not be preserved.
+ */
+#define M_SCHED_TASK_END(label_resume) \
+    M_BX(label_resume)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_SCHED_H */
@@ -0,0 +1,88 @@
+#ifndef HULP_SEQLOCK_H
+#define HULP_SEQLOCK_H
+
+/**
+ * Sequence lock, for the SoC to read a consistent copy of a multi-word record that the ULP writes.
+ *
+ * The ULP increments the sequence before and after writing the record, so it is odd while a write is in progress.
+ * The SoC copies the record and retries if the sequence was odd or changed meanwhile. Unlike ulp_mutex_t, the ULP
+ * never waits for the SoC, and the SoC only waits while the ULP is part way through a write.
+ *
+ * Example:
+ *      RTC_DATA_ATTR ulp_var_t ulp_reading_seq;
+ *      RTC_DATA_ATTR ulp_var_t ulp_reading[2];
+ *
+ *      //ULP: reading in R1 and R2
+ *      I_MOVI(R3, 0),
+ *      M_SEQLOCK_WRITE_BEGIN(ulp_reading_seq, R3, R0),
+ *      I_PUT(R1, R3, ulp_reading[0]),
+ *      I_PUT(R2, R3, ulp_reading[1]),
+ *      M_SEQLOCK_WRITE_END(ulp_reading_seq, R3, R0),
+ *
+ *      //SoC:
+ *      ulp_var_t reading[2];
+ *      hulp_seqlock_read(&ulp_reading_seq, ulp_reading, reading, sizeof(reading));
+ */
+
+#include "hulp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * ULP: Begin writing the record (sequence becomes odd)
+ *
+ * seq: ulp_var_t sequence for the record (initially 0)
+ * reg_zero: R0-R3 which has known value of 0
+ * reg_scr: R0-R3 to be clobbered
+ */
+#define M_SEQLOCK_WRITE_BEGIN(_seq, _reg_zero, _reg_scr) \
+    I_GET(_reg_scr, _reg_zero, _seq), \
+    I_ADDI(_reg_scr, _reg_scr, 1), \
+    I_PUT(_reg_scr, _reg_zero, _seq)
+
+/**
+ * ULP: End writing the record (sequence becomes even)
+ *
+ * seq: ulp_var_t sequence for the record
+ * reg_zero: R0-R3 which has known value of 0
+ * reg_scr: R0-R3 to be clobbered
+ */
+#define M_SEQLOCK_WRITE_END(_seq, _reg_zero, _reg_scr) \
+    M_SEQLOCK_WRITE_BEGIN(_seq, _reg_zero, _reg_scr)
+
+/**
+ * SoC: Copy a record written between M_SEQLOCK_WRITE_BEGIN and M_SEQLOCK_WRITE_END, retrying until it is consistent.
+ *
+ * seq: pointer to the record's ulp_var_t sequence
+ * record: the record in RTC memory (eg. ulp_var_t array or struct of ulp_var_t)
+ * dest: where to copy the record
+ * size: size of the record in bytes (multiple of 4)
+ *
+ * Returns the number of retries.
+ */
+static inline uint32_t hulp_seqlock_read(const ulp_var_t *seq, const void *record, void *dest, size_t size)
+{
+    const volatile ulp_var_t *vseq = (const volatile ulp_var_t*)seq;
+    const volatile uint32_t *src = (const volatile uint32_t*)record;
+    uint32_t *dst = (uint32_t*)dest;
+    for(uint32_t retries = 0; ; ++retries)
+    {
+        uint16_t before = vseq->val;
+        for(size_t i = 0; i < size / sizeof(uint32_t); ++i)
+        {
+            dst[i] = src[i];
+        }
+        if(!(before & 1) && vseq->val == before)
+        {
+            return retries;
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_SEQLOCK_H */
@@ -0,0 +1,48 @@
+#include "hulp_timestamp.h"
+
+#include "esp_timer.h"
+#include "soc/rtc.h"
+
+uint64_t hulp_timestamp_get_ticks(const ulp_var_t* ts)
+{
+    return ((uint64_t)ts[2].val << 32) | ((uint32_t)ts[1].val << 16) | ts[0].val;
+}
+
+uint32_t hulp_timestamp_ms_to_ticks(uint32_t time_ms)
+{
+    uint64_t ticks = rtc_time_us_to_slowclk(1000ULL * time_ms, hulp_get_slow_clk_cal());
+    return (ticks > HULP_TIMESTAMP_MAX_INTERVAL_TICKS) ? HULP_TIMESTAMP_MAX_INTERVAL_TICKS : (uint32_t)ticks;
+}
+
+/**
+ * Time (us) since the timestamp, by the RTC ticks now.
+ */
+static int64_t hulp_timestamp_age_us(const ulp_var_t* ts)
+{
+    uint64_t now = rtc_time_get();
+    uint64_t then = hulp_timestamp_get_ticks(ts);
+    if(then > now)
+    {
+        return -(int64_t)rtc_time_slowclk_to_us(then - now, hulp_get_slow_clk_cal());
+    }
+    return (int64_t)rtc_time_slowclk_to_us(now - then, hulp_get_slow_clk_cal());
+}
+
+int64_t hulp_timestamp_to_esp_timer_us(const ulp_var_t* ts)
+{
+    return esp_timer_get_time() - hulp_timestamp_age_us(ts);
+}
+
+void hulp_timestamp_to_timeval(const ulp_var_t* ts, struct timeval* tv)
+{
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    int64_t us = (int64_t)now.tv_sec * 1000000 + now.tv_usec - hulp_timestamp_age_us(ts);
+    tv->tv_sec = (time_t)(us / 1000000);
+    tv->tv_usec = (suseconds_t)(us % 1000000);
+    if(tv->tv_usec < 0)
+    {
+        tv->tv_sec -= 1;
+        tv->tv_usec += 1000000;
+    }
+}
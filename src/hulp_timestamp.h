@@ -0,0 +1,129 @@
+#ifndef HULP_TIMESTAMP_H
+#define HULP_TIMESTAMP_H
+
+#include <sys/time.h>
+
+#include "hulp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Wide RTC timestamps.
+ *
+ * Rather than a 16-bit window of the RTC ticks (I_RD_TICKS_REG), M_TIMESTAMP_UPDATE stores all 48 bits as latched by
+ * M_UPDATE_TICKS, so the timestamp never wraps and there is no carry to track between wakes. Intervals of any length
+ * up to 2^31 ticks (hours) are then checked against it at full resolution with M_IF_TIMESTAMP_ELAPSED, so long and
+ * short timers share one timebase. The SoC can convert a timestamp to esp_timer or wall time without waking the ULP.
+ *
+ * Example:
+ *      RTC_DATA_ATTR ulp_var_t ulp_now[HULP_TIMESTAMP_WORDS];
+ *      RTC_DATA_ATTR ulp_var_t ulp_led_last[HULP_TIMESTAMP_TIMER_WORDS];
+ *      RTC_DATA_ATTR ulp_var_t ulp_i2c_last[HULP_TIMESTAMP_TIMER_WORDS];
+ *
+ *      M_TIMESTAMP_UPDATE(ulp_now),
+ *      M_IF_TIMESTAMP_ELAPSED(LBL_LED, ulp_now, ulp_led_last, hulp_timestamp_ms_to_ticks(20), LBL_I2C),
+ *          //Handle LED
+ *      M_IF_TIMESTAMP_ELAPSED(LBL_I2C, ulp_now, ulp_i2c_last, hulp_timestamp_ms_to_ticks(3600000), LBL_HALT),
+ *          //Handle I2C
+ *      M_LABEL(LBL_HALT),
+ *          I_HALT(),
+ */
+
+/**
+ * Number of ulp_var_t in a timestamp: RTC ticks [15:0], [31:16], [47:32]
+ */
+#define HULP_TIMESTAMP_WORDS 3
+
+/**
+ * Number of ulp_var_t in a timer for M_IF_TIMESTAMP_ELAPSED: the lower 32 bits of the timestamp when it last elapsed.
+ */
+#define HULP_TIMESTAMP_TIMER_WORDS 2
+
+/**
+ * Longest interval_ticks for M_IF_TIMESTAMP_ELAPSED (about 4 hours at 150kHz).
+ */
+#define HULP_TIMESTAMP_MAX_INTERVAL_TICKS 0x7FFFFFFFUL
+
+/**
+ * Get the RTC ticks of a timestamp.
+ */
+uint64_t hulp_timestamp_get_ticks(const ulp_var_t* ts);
+
+/**
+ * Convert a time (in milliseconds) to a full resolution RTC tick count, eg. for M_IF_TIMESTAMP_ELAPSED.
+ * Longer times are limited to HULP_TIMESTAMP_MAX_INTERVAL_TICKS.
+ */
+uint32_t hulp_timestamp_ms_to_ticks(uint32_t time_ms);
+
+/**
+ * Get the esp_timer time (us, as esp_timer_get_time) of a timestamp.
+ * Timestamps from before this boot (eg. before deep sleep) are negative.
+ */
+int64_t hulp_timestamp_to_esp_timer_us(const ulp_var_t* ts);
+
+/**
+ * Get the wall time (as gettimeofday) of a timestamp.
+ */
+void hulp_timestamp_to_timeval(const ulp_var_t* ts, struct timeval* tv);
+
+/**
+ * Store the current RTC ticks in a timestamp.
+ *  Note: Uses R0 and R1 (see _ variant)
+ *
+ * ts: ulp_var_t[HULP_TIMESTAMP_WORDS]
+ */
+#define M_TIMESTAMP_UPDATE(ts) \
+    M_TIMESTAMP_UPDATE_(ts, R1)
+
+#define M_TIMESTAMP_UPDATE_(ts, reg_scr) \
+    M_UPDATE_TICKS(), \
+    I_MOVI(reg_scr, 0), \
+    I_RD_REG(RTC_CNTL_TIME0_REG, 0, 15), \
+    I_ST(R0, reg_scr, RTC_WORD_OFFSET((ts)[0])), \
+    I_RD_REG(RTC_CNTL_TIME0_REG, 16, 31), \
+    I_ST(R0, reg_scr, RTC_WORD_OFFSET((ts)[1])), \
+    I_RD_REG(RTC_CNTL_TIME1_REG, 0, 15), \
+    I_ST(R0, reg_scr, RTC_WORD_OFFSET((ts)[2]))
+
+/**
+ * As M_IF_TICKS_ELAPSED, but against a timestamp from M_TIMESTAMP_UPDATE: continues (and restarts the timer) if
+ * interval_ticks have elapsed since the timer last did, otherwise branches to else_goto_label.
+ *  Note: R0-R3 are clobbered. As with M_BX, the program should be loaded at 0.
+ *
+ * id_label: A unique label number for this block
+ * ts: ulp_var_t[HULP_TIMESTAMP_WORDS], updated this wake
+ * timer: ulp_var_t[HULP_TIMESTAMP_TIMER_WORDS] (initially 0)
+ * interval_ticks: Time between each execution (up to HULP_TIMESTAMP_MAX_INTERVAL_TICKS), eg. from hulp_timestamp_ms_to_ticks
+ * else_goto_label: The label number to branch to if interval_ticks has not elapsed
+ */
+#define M_IF_TIMESTAMP_ELAPSED(id_label, ts, timer, interval_ticks, else_goto_label) \
+    M_LABEL(id_label), \
+        I_MOVI(R3, 0), \
+        I_LD(R1, R3, RTC_WORD_OFFSET((ts)[0])), \
+        I_LD(R0, R3, RTC_WORD_OFFSET((timer)[0])), \
+        M_MOVL(R2, (id_label)), \
+        I_ADDI(R2, R2, 9), \
+        I_SUBR(R1, R1, R0),                         /*Elapsed [15:0], setting overflow on borrow*/ \
+        I_LD(R0, R3, RTC_WORD_OFFSET((ts)[1])), \
+        I_BXFR(R2), \
+        I_BGE(2, 0), \
+        I_SUBI(R0, R0, 1),                          /*Borrow*/ \
+        I_LD(R2, R3, RTC_WORD_OFFSET((timer)[1])), \
+        I_SUBR(R0, R0, R2),                         /*Elapsed [31:16]*/ \
+        I_BL(4, (uint16_t)((uint32_t)(interval_ticks) >> 16)), \
+        I_BGE(4, (uint16_t)(((uint32_t)(interval_ticks) >> 16) + 1)), \
+        I_MOVR(R0, R1), \
+        I_BGE(2, (uint16_t)((uint32_t)(interval_ticks) & 0xFFFF)), \
+        M_BX((else_goto_label)), \
+        I_LD(R0, R3, RTC_WORD_OFFSET((ts)[0])), \
+        I_ST(R0, R3, RTC_WORD_OFFSET((timer)[0])), \
+        I_LD(R0, R3, RTC_WORD_OFFSET((ts)[1])), \
+        I_ST(R0, R3, RTC_WORD_OFFSET((timer)[1]))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_TIMESTAMP_H */
@@ -0,0 +1,651 @@
+#include "hulp_timing.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "soc/rtc_io_reg.h"
+#include "soc/sens_reg.h"
+
+#include "hulp_cfg.h"
+
+static const char* TAG = "HULP-TIMING";
+
+#define HULP_TIMING_MEM_SLOTS 4
+
+// Bits of hulp_timing_state_t.known
+#define HULP_TIMING_KNOWN_REG(r) (1 << (r))
+#define HULP_TIMING_KNOWN_STAGE (1 << 4)
+#define HULP_TIMING_KNOWN_ZERO (1 << 5)
+#define HULP_TIMING_KNOWN_OVF (1 << 6)
+
+// Bits of hulp_timing_state_t.flags
+#define HULP_TIMING_FLAG_ZERO (1 << 0)
+#define HULP_TIMING_FLAG_OVF (1 << 1)
+#define HULP_TIMING_FLAG_ADC_ON (1 << 2)
+#define HULP_TIMING_FLAG_HALL_ON (1 << 3)
+
+// Costs accumulated along each path
+#define HULP_TIMING_COST_CYCLES 0
+#define HULP_TIMING_COST_ADC 1
+#define HULP_TIMING_COST_HALL 2
+#define HULP_TIMING_NUM_COSTS 3
+
+#define HULP_TIMING_NODE_ACTIVE 0
+#define HULP_TIMING_NODE_DONE 1
+
+/**
+ * Everything known about the ULP at an instruction. Unknown values are 0, so that states compare with memcmp.
+ * Laid out without padding for the same reason.
+ */
+typedef struct {
+    uint16_t pc;
+    uint16_t reg[4];
+    uint16_t mem_addr[HULP_TIMING_MEM_SLOTS];   /*!< Words stored on this path with a known address and value */
+    uint16_t mem_val[HULP_TIMING_MEM_SLOTS];
+    uint8_t stage;
+    uint8_t known;
+    uint8_t flags;
+    uint8_t num_mem;
+} hulp_timing_state_t;
+
+typedef struct {
+    hulp_timing_state_t state;
+    uint32_t best[HULP_TIMING_NUM_COSTS];
+    uint32_t worst[HULP_TIMING_NUM_COSTS];
+    uint8_t status;
+    bool bounded;
+} hulp_timing_node_t;
+
+typedef struct {
+    uint32_t node;
+    uint32_t best[HULP_TIMING_NUM_COSTS];
+    uint32_t worst[HULP_TIMING_NUM_COSTS];
+    uint8_t next;
+    bool has_best;
+    bool bounded;
+} hulp_timing_frame_t;
+
+typedef struct {
+    const ulp_insn_t* program;
+    size_t num_words;
+    hulp_timing_node_t* nodes;
+    size_t num_nodes;
+    size_t max_nodes;
+    int32_t* table;
+    size_t table_mask;
+    hulp_timing_t* result;
+} hulp_timing_ctx_t;
+
+static uint32_t hulp_timing_hash(const hulp_timing_state_t* state)
+{
+    const uint8_t* bytes = (const uint8_t*)state;
+    uint32_t hash = 2166136261UL;
+    for(size_t i = 0; i < sizeof(*state); ++i)
+    {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+static void hulp_timing_set_reg(hulp_timing_state_t* state, uint8_t reg, bool known, uint16_t value)
+{
+    if(known)
+    {
+        state->known |= HULP_TIMING_KNOWN_REG(reg);
+        state->reg[reg] = value;
+    }
+    else
+    {
+        state->known &= ~HULP_TIMING_KNOWN_REG(reg);
+        state->reg[reg] = 0;
+    }
+}
+
+static void hulp_timing_mem_remove(hulp_timing_state_t* state, uint8_t slot)
+{
+    for(uint8_t i = slot; i + 1 < state->num_mem; ++i)
+    {
+        state->mem_addr[i] = state->mem_addr[i + 1];
+        state->mem_val[i] = state->mem_val[i + 1];
+    }
+    --state->num_mem;
+    state->mem_addr[state->num_mem] = 0;
+    state->mem_val[state->num_mem] = 0;
+}
+
+static void hulp_timing_store(hulp_timing_state_t* state, const ulp_insn_t* insn)
+{
+    if(!(state->known & HULP_TIMING_KNOWN_REG(insn->st.sreg)))
+    {
+        // May have overwritten any of them
+        memset(state->mem_addr, 0, sizeof(state->mem_addr));
+        memset(state->mem_val, 0, sizeof(state->mem_val));
+        state->num_mem = 0;
+        return;
+    }
+    uint16_t addr = (state->reg[insn->st.sreg] + insn->st.offset) & 0x7FF;
+    for(uint8_t i = 0; i < state->num_mem; ++i)
+    {
+        if(state->mem_addr[i] == addr)
+        {
+            hulp_timing_mem_remove(state, i);
+            break;
+        }
+    }
+    if(!(state->known & HULP_TIMING_KNOWN_REG(insn->st.dreg)))
+    {
+        return;
+    }
+    if(state->num_mem == HULP_TIMING_MEM_SLOTS)
+    {
+        // Forget the oldest
+        hulp_timing_mem_remove(state, 0);
+    }
+    state->mem_addr[state->num_mem] = addr;
+    state->mem_val[state->num_mem] = state->reg[insn->st.dreg];
+    ++state->num_mem;
+}
+
+static void hulp_timing_load(hulp_timing_state_t* state, const ulp_insn_t* insn)
+{
+    if(state->known & HULP_TIMING_KNOWN_REG(insn->ld.sreg))
+    {
+        uint16_t addr = (state->reg[insn->ld.sreg] + insn->ld.offset) & 0x7FF;
+        for(uint8_t i = 0; i < state->num_mem; ++i)
+        {
+            if(state->mem_addr[i] == addr)
+            {
+                hulp_timing_set_reg(state, insn->ld.dreg, true, state->mem_val[i]);
+                return;
+            }
+        }
+    }
+    hulp_timing_set_reg(state, insn->ld.dreg, false, 0);
+}
+
+static void hulp_timing_alu(hulp_timing_state_t* state, uint8_t sel, uint8_t dreg, bool a_known, uint16_t a, bool b_known, uint16_t b)
+{
+    uint32_t result = 0;
+    bool known = a_known && b_known;
+    switch(sel)
+    {
+        case ALU_SEL_ADD:
+            result = (uint32_t)a + b;
+            break;
+        case ALU_SEL_SUB:
+            result = (uint32_t)a - b;
+            break;
+        case ALU_SEL_AND:
+            result = a & b;
+            break;
+        case ALU_SEL_OR:
+            result = a | b;
+            break;
+        case ALU_SEL_MOV:
+            known = b_known;
+            result = b;
+            break;
+        case ALU_SEL_LSH:
+            result = (b < 16) ? ((uint32_t)a << b) : 0;
+            break;
+        case ALU_SEL_RSH:
+            result = (b < 16) ? (a >> b) : 0;
+            break;
+        default:
+            known = false;
+            break;
+    }
+
+    hulp_timing_set_reg(state, dreg, known, (uint16_t)result);
+    state->known &= ~(HULP_TIMING_KNOWN_ZERO | HULP_TIMING_KNOWN_OVF);
+    state->flags &= ~(HULP_TIMING_FLAG_ZERO | HULP_TIMING_FLAG_OVF);
+    if(known)
+    {
+        state->known |= HULP_TIMING_KNOWN_ZERO;
+        state->flags |= ((uint16_t)result == 0) ? HULP_TIMING_FLAG_ZERO : 0;
+        if(sel == ALU_SEL_ADD || sel == ALU_SEL_SUB)
+        {
+            state->known |= HULP_TIMING_KNOWN_OVF;
+            state->flags |= (result > 0xFFFF) ? HULP_TIMING_FLAG_OVF : 0;
+        }
+    }
+}
+
+/**
+ * Whether an I_WR_REG writes all of bits [high:low]
+ */
+static bool hulp_timing_writes_bits(const ulp_insn_t* insn, uint8_t low, uint8_t high)
+{
+    return insn->wr_reg.low <= low && insn->wr_reg.high >= high;
+}
+
+/**
+ * Track power domains switched by the program (eg. I_ADC_POWER_ON, I_HALL_CONNECT)
+ */
+static void hulp_timing_write_reg(hulp_timing_state_t* state, const ulp_insn_t* insn)
+{
+    uint32_t reg = DR_REG_RTCCNTL_BASE + insn->wr_reg.periph_sel * 0x400 + insn->wr_reg.addr * sizeof(uint32_t);
+    if(reg == SENS_SAR_MEAS_WAIT2_REG && hulp_timing_writes_bits(insn, SENS_FORCE_XPD_SAR_S, SENS_FORCE_XPD_SAR_S + 1))
+    {
+        uint8_t xpd = (insn->wr_reg.data >> (SENS_FORCE_XPD_SAR_S - insn->wr_reg.low)) & SENS_FORCE_XPD_SAR_V;
+        state->flags = (xpd == SENS_FORCE_XPD_SAR_PU) ? (state->flags | HULP_TIMING_FLAG_ADC_ON) : (state->flags & ~HULP_TIMING_FLAG_ADC_ON);
+    }
+    else if(reg == RTC_IO_HALL_SENS_REG && hulp_timing_writes_bits(insn, RTC_IO_XPD_HALL_S, RTC_IO_XPD_HALL_S))
+    {
+        bool xpd = (insn->wr_reg.data >> (RTC_IO_XPD_HALL_S - insn->wr_reg.low)) & 1;
+        state->flags = xpd ? (state->flags | HULP_TIMING_FLAG_HALL_ON) : (state->flags & ~HULP_TIMING_FLAG_HALL_ON);
+    }
+}
+
+/**
+ * Apply the effects of the (non-branch) instruction at state->pc.
+ */
+static void hulp_timing_execute(hulp_timing_state_t* state, const ulp_insn_t* insn)
+{
+    switch(insn->b.opcode)
+    {
+        case OPCODE_ALU:
+            if(insn->alu_reg.sub_opcode == SUB_OPCODE_ALU_REG)
+            {
+                hulp_timing_alu(state, insn->alu_reg.sel, insn->alu_reg.dreg,
+                    state->known & HULP_TIMING_KNOWN_REG(insn->alu_reg.sreg), state->reg[insn->alu_reg.sreg],
+                    (insn->alu_reg.sel == ALU_SEL_MOV) ? (state->known & HULP_TIMING_KNOWN_REG(insn->alu_reg.sreg)) : (state->known & HULP_TIMING_KNOWN_REG(insn->alu_reg.treg)),
+                    (insn->alu_reg.sel == ALU_SEL_MOV) ? state->reg[insn->alu_reg.sreg] : state->reg[insn->alu_reg.treg]);
+            }
+            else if(insn->alu_imm.sub_opcode == SUB_OPCODE_ALU_IMM)
+            {
+                hulp_timing_alu(state, insn->alu_imm.sel, insn->alu_imm.dreg,
+                    state->known & HULP_TIMING_KNOWN_REG(insn->alu_imm.sreg), state->reg[insn->alu_imm.sreg],
+                    true, insn->alu_imm.imm);
+            }
+            else if(insn->alu_reg_s.sub_opcode == SUB_OPCODE_ALU_CNT)
+            {
+                switch(insn->alu_reg_s.sel)
+                {
+                    case ALU_SEL_SRST:
+                        state->known |= HULP_TIMING_KNOWN_STAGE;
+                        state->stage = 0;
+                        break;
+                    case ALU_SEL_SINC:
+                        state->stage = (state->known & HULP_TIMING_KNOWN_STAGE) ? (uint8_t)(state->stage + insn->alu_reg_s.imm) : 0;
+                        break;
+                    case ALU_SEL_SDEC:
+                        state->stage = (state->known & HULP_TIMING_KNOWN_STAGE) ? (uint8_t)(state->stage - insn->alu_reg_s.imm) : 0;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            break;
+        case OPCODE_LD:
+            hulp_timing_load(state, insn);
+            break;
+        case OPCODE_ST:
+            hulp_timing_store(state, insn);
+            break;
+        case OPCODE_RD_REG:
+            hulp_timing_set_reg(state, R0, false, 0);
+            break;
+        case OPCODE_I2C:
+            if(insn->i2c.rw == SUB_OPCODE_I2C_RD)
+            {
+                hulp_timing_set_reg(state, R0, false, 0);
+            }
+            break;
+        case OPCODE_ADC:
+            hulp_timing_set_reg(state, insn->adc.dreg, false, 0);
+            break;
+        case OPCODE_TSENS:
+            hulp_timing_set_reg(state, insn->tsens.dreg, false, 0);
+            break;
+        case OPCODE_WR_REG:
+            hulp_timing_write_reg(state, insn);
+            break;
+        default:
+            // I_DELAY, I_WAKE, I_SLEEP_CYCLE_SEL
+            break;
+    }
+}
+
+/**
+ * Get the states that may follow the instruction at state->pc.
+ * Sets *escapes if execution may also continue somewhere that cannot be determined (or beyond the program).
+ */
+static uint8_t hulp_timing_step(const hulp_timing_ctx_t* ctx, const hulp_timing_state_t* state, hulp_timing_state_t next[2], bool* escapes)
+{
+    const ulp_insn_t* insn = &ctx->program[state->pc];
+    int32_t target = -1;
+    bool taken = false;
+    bool not_taken = true;
+
+    *escapes = false;
+
+    if(insn->b.opcode == OPCODE_HALT)
+    {
+        return 0;
+    }
+    if(insn->b.opcode == OPCODE_MACRO)
+    {
+        // Unprocessed program
+        *escapes = true;
+        return 0;
+    }
+
+    if(insn->b.opcode == OPCODE_BRANCH)
+    {
+        if(insn->bx.sub_opcode == SUB_OPCODE_BX)
+        {
+            bool flag_known = true;
+            bool flag = true;
+            if(insn->bx.type == BX_JUMP_TYPE_ZERO)
+            {
+                flag_known = state->known & HULP_TIMING_KNOWN_ZERO;
+                flag = state->flags & HULP_TIMING_FLAG_ZERO;
+            }
+            else if(insn->bx.type == BX_JUMP_TYPE_OVF)
+            {
+                flag_known = state->known & HULP_TIMING_KNOWN_OVF;
+                flag = state->flags & HULP_TIMING_FLAG_OVF;
+            }
+            taken = !flag_known || flag;
+            not_taken = !flag_known || !flag;
+            if(!insn->bx.reg)
+            {
+                target = insn->bx.addr;
+            }
+            else if(state->known & HULP_TIMING_KNOWN_REG(insn->bx.dreg))
+            {
+                target = state->reg[insn->bx.dreg];
+            }
+        }
+        else if(insn->b.sub_opcode == SUB_OPCODE_BR)
+        {
+            target = (int32_t)state->pc + (insn->b.sign ? -(int32_t)insn->b.offset : (int32_t)insn->b.offset);
+            if(state->known & HULP_TIMING_KNOWN_REG(R0))
+            {
+                taken = (insn->b.cmp == B_CMP_L) ? (state->reg[R0] < insn->b.imm) : (state->reg[R0] >= insn->b.imm);
+                not_taken = !taken;
+            }
+            else
+            {
+                // As hulp_cfg_get_successors
+                taken = !(insn->b.cmp == B_CMP_L && insn->b.imm == 0);
+                not_taken = !(insn->b.cmp == B_CMP_GE && insn->b.imm == 0);
+            }
+        }
+        else if(insn->bs.sub_opcode == SUB_OPCODE_BS)
+        {
+            target = (int32_t)state->pc + (insn->bs.sign ? -(int32_t)insn->bs.offset : (int32_t)insn->bs.offset);
+            if(state->known & HULP_TIMING_KNOWN_STAGE)
+            {
+                switch(insn->bs.cmp)
+                {
+                    case JUMPS_LT:
+                        taken = state->stage < insn->bs.imm;
+                        break;
+                    case JUMPS_GE:
+                        taken = state->stage >= insn->bs.imm;
+                        break;
+                    default:
+                        taken = state->stage <= insn->bs.imm;
+                        break;
+                }
+                not_taken = !taken;
+            }
+            else
+            {
+                taken = !(insn->bs.cmp == JUMPS_LT && insn->bs.imm == 0);
+                not_taken = !((insn->bs.cmp == JUMPS_GE && insn->bs.imm == 0) || (insn->bs.cmp == JUMPS_LE && insn->bs.imm == 0xFF));
+            }
+        }
+    }
+
+    uint8_t count = 0;
+    if(taken)
+    {
+        if(target < 0 || target >= (int32_t)ctx->num_words)
+        {
+            *escapes = true;
+        }
+        else
+        {
+            memcpy(&next[count], state, sizeof(*state));
+            next[count].pc = (uint16_t)target;
+            ++count;
+        }
+    }
+    if(not_taken)
+    {
+        if((size_t)state->pc + 1 >= ctx->num_words)
+        {
+            *escapes = true;
+        }
+        else
+        {
+            memcpy(&next[count], state, sizeof(*state));
+            hulp_timing_execute(&next[count], insn);
+            next[count].pc = state->pc + 1;
+            ++count;
+        }
+    }
+    return count;
+}
+
+/**
+ * Find a state, or add it (as active). Returns its node index, or -1 if the state limit is reached.
+ */
+static int32_t hulp_timing_intern(hulp_timing_ctx_t* ctx, const hulp_timing_state_t* state, bool* found)
+{
+    size_t slot = hulp_timing_hash(state) & ctx->table_mask;
+    while(ctx->table[slot] >= 0)
+    {
+        if(memcmp(&ctx->nodes[ctx->table[slot]].state, state, sizeof(*state)) == 0)
+        {
+            *found = true;
+            return ctx->table[slot];
+        }
+        slot = (slot + 1) & ctx->table_mask;
+    }
+    *found = false;
+    if(ctx->num_nodes == ctx->max_nodes)
+    {
+        return -1;
+    }
+    hulp_timing_node_t* node = &ctx->nodes[ctx->num_nodes];
+    memcpy(&node->state, state, sizeof(*state));
+    node->status = HULP_TIMING_NODE_ACTIVE;
+    ctx->table[slot] = (int32_t)ctx->num_nodes;
+    return (int32_t)ctx->num_nodes++;
+}
+
+static void hulp_timing_lose_bound(hulp_timing_ctx_t* ctx, hulp_timing_frame_t* frame, uint16_t pc)
+{
+    if(ctx->result->bounded)
+    {
+        ctx->result->bounded = false;
+        ctx->result->unbounded_pc = pc;
+    }
+    frame->bounded = false;
+}
+
+/**
+ * Each cost is combined separately, so the worst (or best) of each may be from a different path.
+ */
+static void hulp_timing_combine(hulp_timing_frame_t* frame, const hulp_timing_node_t* child)
+{
+    for(int i = 0; i < HULP_TIMING_NUM_COSTS; ++i)
+    {
+        if(!frame->has_best || child->best[i] < frame->best[i])
+        {
+            frame->best[i] = child->best[i];
+        }
+        if(child->worst[i] > frame->worst[i])
+        {
+            frame->worst[i] = child->worst[i];
+        }
+    }
+    frame->has_best = true;
+    frame->bounded &= child->bounded;
+}
+
+static void hulp_timing_finish(hulp_timing_ctx_t* ctx, hulp_timing_node_t* node, const hulp_timing_frame_t* frame)
+{
+    const ulp_insn_t* insn = &ctx->program[node->state.pc];
+    uint32_t cost[HULP_TIMING_NUM_COSTS];
+    cost[HULP_TIMING_COST_CYCLES] = hulp_cfg_get_cycles(insn);
+    // The SAR ADC is also powered for the duration of conversions (I_ADC, I_TSENS)
+    cost[HULP_TIMING_COST_ADC] = ((node->state.flags & HULP_TIMING_FLAG_ADC_ON) || insn->b.opcode == OPCODE_ADC || insn->b.opcode == OPCODE_TSENS) ? cost[HULP_TIMING_COST_CYCLES] : 0;
+    cost[HULP_TIMING_COST_HALL] = (node->state.flags & HULP_TIMING_FLAG_HALL_ON) ? cost[HULP_TIMING_COST_CYCLES] : 0;
+
+    if(insn->b.opcode == OPCODE_HALT)
+    {
+        ctx->result->adc_left_on |= (node->state.flags & HULP_TIMING_FLAG_ADC_ON) != 0;
+        ctx->result->hall_left_on |= (node->state.flags & HULP_TIMING_FLAG_HALL_ON) != 0;
+    }
+
+    for(int i = 0; i < HULP_TIMING_NUM_COSTS; ++i)
+    {
+        node->best[i] = cost[i] + (frame->has_best ? frame->best[i] : 0);
+        node->worst[i] = (frame->worst[i] > UINT32_MAX - cost[i]) ? UINT32_MAX : cost[i] + frame->worst[i];
+    }
+    node->bounded = frame->bounded;
+    node->status = HULP_TIMING_NODE_DONE;
+}
+
+static void hulp_timing_search(hulp_timing_ctx_t* ctx, hulp_timing_frame_t* stack, uint16_t entry_pc)
+{
+    hulp_timing_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.pc = entry_pc;
+
+    bool found;
+    size_t depth = 0;
+    stack[depth++] = (hulp_timing_frame_t){ .node = (uint32_t)hulp_timing_intern(ctx, &state, &found), .bounded = true };
+
+    while(depth > 0)
+    {
+        hulp_timing_frame_t* frame = &stack[depth - 1];
+        hulp_timing_node_t* node = &ctx->nodes[frame->node];
+
+        // Successors are regenerated rather than kept on the stack, as they are cheap to compute.
+        hulp_timing_state_t next[2];
+        bool escapes;
+        uint8_t count = hulp_timing_step(ctx, &node->state, next, &escapes);
+        if(frame->next == 0 && escapes)
+        {
+            hulp_timing_lose_bound(ctx, frame, node->state.pc);
+        }
+
+        if(frame->next < count)
+        {
+            const hulp_timing_state_t* child_state = &next[frame->next++];
+            int32_t child = hulp_timing_intern(ctx, child_state, &found);
+            if(child < 0)
+            {
+                // Out of states: this path is not followed
+                if(ctx->result->bounded)
+                {
+                    ESP_LOGW(TAG, "[%s] exceeded %u states at pc %u", __func__, (unsigned)ctx->max_nodes, child_state->pc);
+                }
+                hulp_timing_lose_bound(ctx, frame, child_state->pc);
+            }
+            else if(!found)
+            {
+                stack[depth++] = (hulp_timing_frame_t){ .node = (uint32_t)child, .bounded = true };
+            }
+            else if(ctx->nodes[child].status == HULP_TIMING_NODE_ACTIVE)
+            {
+                // Back to a state on the current path with nothing known to have changed: may loop indefinitely
+                hulp_timing_lose_bound(ctx, frame, child_state->pc);
+            }
+            else
+            {
+                hulp_timing_combine(frame, &ctx->nodes[child]);
+            }
+            continue;
+        }
+
+        hulp_timing_finish(ctx, node, frame);
+
+        if(--depth > 0)
+        {
+            hulp_timing_combine(&stack[depth - 1], node);
+        }
+    }
+}
+
+esp_err_t hulp_timing_analyse(const ulp_insn_t* program, size_t num_words, uint16_t entry_pc, const hulp_timing_config_t* config, hulp_timing_t* result)
+{
+    const hulp_timing_config_t default_config = HULP_TIMING_CONFIG_DEFAULT();
+    if(!config)
+    {
+        config = &default_config;
+    }
+    if(!program || !result || entry_pc >= num_words)
+    {
+        ESP_LOGE(TAG, "[%s] invalid arg", __func__);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t max_states = config->max_states;
+    if(max_states == 0)
+    {
+        max_states = num_words * HULP_TIMING_STATES_PER_WORD;
+        max_states = (max_states < HULP_TIMING_MIN_STATES) ? HULP_TIMING_MIN_STATES : max_states;
+    }
+
+    size_t table_size = 1;
+    while(table_size < max_states * 2)
+    {
+        table_size <<= 1;
+    }
+
+    hulp_timing_ctx_t ctx = {
+        .program = program,
+        .num_words = num_words,
+        .nodes = (hulp_timing_node_t*)malloc(max_states * sizeof(hulp_timing_node_t)),
+        .max_nodes = max_states,
+        .table = (int32_t*)malloc(table_size * sizeof(int32_t)),
+        .table_mask = table_size - 1,
+        .result = result,
+    };
+    hulp_timing_frame_t* stack = (hulp_timing_frame_t*)malloc(max_states * sizeof(hulp_timing_frame_t));
+
+    esp_err_t err = ESP_OK;
+    if(ctx.nodes && ctx.table && stack)
+    {
+        memset(ctx.table, 0xFF, table_size * sizeof(int32_t));
+        result->bounded = true;
+        result->unbounded_pc = 0;
+        result->adc_left_on = false;
+        result->hall_left_on = false;
+        hulp_timing_search(&ctx, stack, entry_pc);
+        result->best_cycles = ctx.nodes[0].best[HULP_TIMING_COST_CYCLES];
+        result->worst_cycles = ctx.nodes[0].worst[HULP_TIMING_COST_CYCLES];
+        result->best_adc_cycles = ctx.nodes[0].best[HULP_TIMING_COST_ADC];
+        result->worst_adc_cycles = ctx.nodes[0].worst[HULP_TIMING_COST_ADC];
+        result->best_hall_cycles = ctx.nodes[0].best[HULP_TIMING_COST_HALL];
+        result->worst_hall_cycles = ctx.nodes[0].worst[HULP_TIMING_COST_HALL];
+        result->num_states = ctx.num_nodes;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "[%s] no memory for %u states", __func__, (unsigned)max_states);
+        err = ESP_ERR_NO_MEM;
+    }
+
+    free(stack);
+    free(ctx.table);
+    free(ctx.nodes);
+    return err;
+}
+
+uint32_t hulp_timing_cycles_to_us(uint32_t cycles, uint32_t fast_clk_hz)
+{
+    if(fast_clk_hz == 0)
+    {
+        return UINT32_MAX;
+    }
+    return (uint32_t)(((uint64_t)cycles * 1000000 + fast_clk_hz - 1) / fast_clk_hz);
+}
@@ -0,0 +1,77 @@
+#ifndef HULP_TIMING_H
+#define HULP_TIMING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "hulp_compat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Static timing analysis of processed ULP programs (eg. from hulp_process_macros), for sizing the wakeup period.
+ *
+ * Each path from an entry point to I_HALT is followed with the register, stage counter and flag values that can be
+ * determined statically (eg. I_MOVI, M_MOVL, I_STAGE_RST), so that counted loops (eg. I_JUMPS with I_STAGE_INC) and
+ * return addresses (eg. M_MOVL before M_BX, or saved with I_ST and restored with I_LD) are resolved. Values from
+ * peripherals and memory not written on the path are unknown, and both outcomes of any branch on them are followed.
+ *
+ * Cycle counts are as per hulp_cfg_get_cycles, so I_I2C_RW, I_ADC and I_TSENS are counted at their minimum.
+ * Cycles spent with the SAR ADC (I_ADC_POWER_ON) or hall sensor (I_HALL_CONNECT) powered are also counted, assuming
+ * that both are off at the entry point.
+ */
+
+/**
+ * With max_states 0, the number of states allowed for each instruction of the program, and the least allowed.
+ * Counted loops need a state for each iteration (eg. each bit of M_APA_TX, ~2000 states for 8 LEDs).
+ */
+#define HULP_TIMING_STATES_PER_WORD 128
+#define HULP_TIMING_MIN_STATES 1024
+
+typedef struct {
+    size_t max_states;      /*!< Maximum number of distinct states (PC and known values) to explore, or 0 for HULP_TIMING_STATES_PER_WORD per instruction. Each uses ~70 bytes while analysing. */
+} hulp_timing_config_t;
+
+#define HULP_TIMING_CONFIG_DEFAULT() {  \
+        .max_states = 0                 \
+    }
+
+typedef struct {
+    uint32_t best_cycles;       /*!< RTC_FAST_CLK cycles of the shortest path from the entry point to I_HALT */
+    uint32_t worst_cycles;      /*!< RTC_FAST_CLK cycles of the longest path from the entry point to I_HALT. Only an upper bound if bounded; otherwise the longest path explored, which may be far short of the worst case. */
+    bool bounded;               /*!< False if worst_cycles is not an upper bound, ie. a loop depends on unknown values (eg. polling a GPIO), a branch target could not be resolved, or max_states was reached */
+    uint16_t unbounded_pc;      /*!< If !bounded, the first instruction found to loop or branch to an unknown target */
+    size_t num_states;          /*!< Number of distinct states explored */
+    uint32_t best_adc_cycles;   /*!< Least cycles with the SAR ADC powered (forced on, or converting with I_ADC/I_TSENS) of any path */
+    uint32_t worst_adc_cycles;  /*!< Most cycles with the SAR ADC powered of any path */
+    uint32_t best_hall_cycles;  /*!< Least cycles with the hall sensor connected of any path */
+    uint32_t worst_hall_cycles; /*!< Most cycles with the hall sensor connected of any path */
+    bool adc_left_on;           /*!< Some path halts with the SAR ADC forced on, so it stays powered in sleep */
+    bool hall_left_on;          /*!< Some path halts with the hall sensor connected */
+} hulp_timing_t;
+
+/**
+ * Analyse best and worst case execution time from an entry point to I_HALT.
+ *
+ * program: processed program (no macros), eg. from hulp_process_macros
+ * num_words: number of instructions in program
+ * entry_pc: entry point (eg. 0, or the PC of a label from hulp_program_index_find_pc)
+ * config: NULL for HULP_TIMING_CONFIG_DEFAULT()
+ *
+ * If max_states is reached, the remaining paths are not followed and the result is unbounded. Loops whose count is
+ * read from memory (eg. the length of a M_INCLUDE_UART_TX string) are unbounded however many states are allowed.
+ */
+esp_err_t hulp_timing_analyse(const ulp_insn_t* program, size_t num_words, uint16_t entry_pc, const hulp_timing_config_t* config, hulp_timing_t* result);
+
+/**
+ * Convert a number of RTC_FAST_CLK cycles to microseconds (rounded up), at a given fast clock frequency (eg. hulp_get_fast_clk_freq()).
+ */
+uint32_t hulp_timing_cycles_to_us(uint32_t cycles, uint32_t fast_clk_hz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HULP_TIMING_H */
@@ -69,6 +69,15 @@ esp_err_t hulp_configure_touch_pin(gpio_num_t touch_gpio, const hulp_touch_pin_c
     I_TOUCH_GET_DONE_BIT(), \
     I_BL(-1,1)
 
+/**
+ * As M_TOUCH_WAIT_DONE, but sleep between polls rather than busy waiting. R0-R3 as per M_SLEEP_CONT.
+ */
+#define M_TOUCH_SLEEP_UNTIL_DONE(label_resume, label_entry, ctx, poll_period, wake_period) \
+    I_TOUCH_GET_DONE_BIT(), \
+    I_BGE(17, 1), \
+    M_SLEEP_CONT(label_resume, label_entry, ctx, poll_period, wake_period), \
+    I_BGE(-17, 0)
+
 #define M_TOUCH_BEGIN() \
     I_WR_REG_BIT(SENS_SAR_TOUCH_CTRL2_REG, SENS_TOUCH_START_EN_S, 0), \
     I_WR_REG_BIT(SENS_SAR_TOUCH_CTRL2_REG, SENS_TOUCH_START_EN_S, 1)
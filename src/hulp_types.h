@@ -31,6 +31,11 @@ typedef union {
 
 _Static_assert(sizeof(ulp_var_t) == 4, "ulp_var_t size should be 4 bytes");
 
+typedef struct {
+    uint16_t label;
+    uint16_t pc;
+} hulp_label_pc_t;
+
 #ifdef __cplusplus
 }
 #endif